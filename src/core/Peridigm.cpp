@@ -58,6 +58,7 @@
 #include <string>
 #include <unordered_set>
 #include <iterator>
+#include <limits>
 #include <cmath>
 
 #include "Peridigm_Field.hpp"
@@ -70,6 +71,7 @@
 #include "Peridigm_BoundaryAndInitialConditionManager.hpp"
 #include "Peridigm_DegreesOfFreedomManager.hpp"
 #include "Peridigm_CriticalTimeStep.hpp"
+#include "Peridigm_VerletUpdate.hpp"
 #include "Peridigm_Timer.hpp"
 #include "Peridigm_MaterialFactory.hpp"
 #include "Peridigm_DamageModelFactory.hpp"
@@ -135,6 +137,10 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     fluidFlowDensityFieldId(-1),
     numMultiphysDoFs(0),
     analysisHasBondAssociatedHypoelasticModel(false),
+    preconditionerAge(0),
+    maxPreconditionerAge(1),
+    maxLinearIterationsBeforeRecompute(std::numeric_limits<int>::max()),
+    numLinearIterations(0),
     damageFieldId(-1),
     jacobianDeterminantFieldId(-1),
     weightedVolumeFieldId(-1),
@@ -242,6 +248,9 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     if(solverParameters[i]->isSublist("ImplicitDiffusion")){
       implicitTimeIntegration = true;
     }
+    // The matrix-free quasi-static solver requires only the block diagonal, which is used as the preconditioner
+    if(solverParameters[i]->isSublist("QuasiStatic") && solverParameters[i]->sublist("QuasiStatic").get("Matrix-Free Jacobian", false))
+      userSpecifiedBlockDiagonalTangent = true;
     if(solverParameters[i]->isParameter("Peridigm Preconditioner")){
       std::string peridigmPreconditionerType = solverParameters[i]->get<string>("Peridigm Preconditioner");
       if(peridigmPreconditionerType == "Full Tangent")
@@ -532,6 +541,29 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
     blockIt->setAuxiliaryFieldIds(auxiliaryFieldIds);
 
+  // Optionally reorder the points in each block along a space-filling curve to improve cache locality
+  string pointOrderingString = discParams->get<string>("Point Ordering", "None");
+  SpaceFillingCurve::Type pointOrdering = SpaceFillingCurve::stringToType(pointOrderingString);
+  if(pointOrdering != SpaceFillingCurve::NONE){
+    Teuchos::RCP<Epetra_Vector> overlapCoordinates = Teuchos::rcp(new Epetra_Vector(*peridigmDiscretization->getGlobalOverlapMap(3)));
+    Epetra_Import overlapCoordinatesImporter(*peridigmDiscretization->getGlobalOverlapMap(3), *peridigmDiscretization->getGlobalOwnedMap(3));
+    overlapCoordinates->Import(*peridigmDiscretization->getInitialX(), overlapCoordinatesImporter, Insert);
+    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+      blockIt->setPointOrdering(pointOrdering, overlapCoordinates);
+  }
+
+  // Place points with no off-processor neighbors first if an explicit solver overlaps communication with computation
+  bool interiorPointsFirst = false;
+  for(unsigned int i=0 ; i<solverParameters.size() ; ++i){
+    if(solverParameters[i]->isSublist("Verlet")){
+      Teuchos::ParameterList& verletParams = solverParameters[i]->sublist("Verlet");
+      if(verletParams.isParameter("Overlap Communication") && verletParams.get<bool>("Overlap Communication"))
+        interiorPointsFirst = true;
+    }
+  }
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+    blockIt->setInteriorPointsFirst(interiorPointsFirst);
+
   // Initialize the blocks (creates maps, neighborhoods, DataManager)
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
     blockIt->initialize(peridigmDiscretization->getGlobalOwnedMap(1),
@@ -1326,8 +1358,10 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
 
   // Compute the approximate critical time step
   double criticalTimeStep = 1.0e50;
+  vector<double> blockCriticalTimeSteps;
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
     double blockCriticalTimeStep = ComputeCriticalTimeStep(*peridigmComm, *blockIt);
+    blockCriticalTimeSteps.push_back(blockCriticalTimeStep);
     if(blockCriticalTimeStep < criticalTimeStep)
       criticalTimeStep = blockCriticalTimeStep;
   }
@@ -1380,6 +1414,85 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     cout << "Total number of time steps " << nsteps << "\n" << endl;
   }
 
+  // Optionally overlap the import of ghosted kinematic data with the force evaluation at interior points
+  // Not supported with the bond-associated hypoelastic model or the data loader, which require all ghost data up front
+  bool overlapCommunication = false;
+  if(verletParams->isParameter("Overlap Communication"))
+    overlapCommunication = verletParams->get<bool>("Overlap Communication");
+  if(analysisHasBondAssociatedHypoelasticModel || analysisHasDataLoader)
+    overlapCommunication = false;
+  vector< Teuchos::RCP<const Epetra_Vector> > kinematicSources;
+  vector<int> kinematicFieldIds;
+  kinematicSources.push_back(u);
+  kinematicFieldIds.push_back(displacementFieldId);
+  kinematicSources.push_back(y);
+  kinematicFieldIds.push_back(coordinatesFieldId);
+  kinematicSources.push_back(v);
+  kinematicFieldIds.push_back(velocityFieldId);
+
+  // Optionally rebalance the blocks when the measured cost of the internal force evaluation becomes imbalanced
+  if(verletParams->isSublist("Load Balancing"))
+    loadBalancer = Teuchos::rcp(new PeridigmNS::LoadBalancer(verletParams->sublist("Load Balancing"),
+                                                             oneDimensionalMap,
+                                                             oneDimensionalOverlapMap,
+                                                             threeDimensionalMap,
+                                                             threeDimensionalOverlapMap,
+                                                             bondMap,
+                                                             blockIDs,
+                                                             globalNeighborhoodData,
+                                                             x));
+
+  // Optionally evaluate each block at its own stable time step (multi-rate explicit time integration)
+  // All points are advanced with the global time step, a block with subcycle ratio r is evaluated every r steps
+  // with a time step of r*dt, and its force contribution is held between evaluations
+  bool subcycling = false;
+  if(verletParams->isParameter("Subcycling"))
+    subcycling = verletParams->get<bool>("Subcycling");
+  if(analysisHasBondAssociatedHypoelasticModel || analysisHasDataLoader)
+    subcycling = false;
+  int maxSubcycleRatio = 16;
+  if(verletParams->isParameter("Maximum Subcycle Ratio"))
+    maxSubcycleRatio = verletParams->get<int>("Maximum Subcycle Ratio");
+  vector< Teuchos::RCP<Epetra_Vector> > heldForce(blocks->size());
+  if(subcycling){
+    overlapCommunication = false;
+    if(peridigmComm->MyPID() == 0)
+      cout << "Subcycle ratios:" << endl;
+    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+      int blockIndex = static_cast<int>(blockIt - blocks->begin());
+      int subcycleRatio = 1;
+      if(blockIt->getMaterialModel()->supportsSubcycling()){
+        while(2*subcycleRatio <= maxSubcycleRatio && 2*subcycleRatio*dt <= safetyFactor*blockCriticalTimeSteps[blockIndex])
+          subcycleRatio *= 2;
+      }
+      blockIt->setSubcycleRatio(subcycleRatio);
+      if(subcycleRatio > 1)
+        heldForce[blockIndex] = Teuchos::rcp(new Epetra_Vector(force->Map()));
+      if(peridigmComm->MyPID() == 0)
+        cout << "  " << blockIt->getName() << "  " << subcycleRatio << endl;
+    }
+    if(peridigmComm->MyPID() == 0)
+      cout << endl;
+  }
+
+  // Optionally re-estimate the stable time step during the run, accounting for bond damage
+  // Not supported with a user-defined time step or with subcycling, for which the subcycle ratios are fixed
+  bool adaptiveTimeStep = false;
+  if(verletParams->isParameter("Adaptive Time Step"))
+    adaptiveTimeStep = verletParams->get<bool>("Adaptive Time Step");
+  if(verletParams->isParameter("Fixed dt") || subcycling)
+    adaptiveTimeStep = false;
+  int timeStepUpdateInterval = 100;
+  if(verletParams->isParameter("Time Step Update Interval"))
+    timeStepUpdateInterval = verletParams->get<int>("Time Step Update Interval");
+  double maxTimeStepGrowth = 1.1;
+  if(verletParams->isParameter("Maximum Time Step Growth"))
+    maxTimeStepGrowth = verletParams->get<double>("Maximum Time Step Growth");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(adaptiveTimeStep && timeStepUpdateInterval < 1, "**** Error:  \"Time Step Update Interval\" must be a positive integer.\n");
+  // The time is measured from the most recent change in the time step
+  int timeStepOriginStep = 0;
+  double timeStepOriginTime = timeInitial;
+
   // Pointer index into sub-vectors for use with BLAS
   double *xPtr, *uPtr, *yPtr, *vPtr, *aPtr;
   x->ExtractView( &xPtr );
@@ -1388,6 +1501,10 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   v->ExtractView( &vPtr );
   a->ExtractView( &aPtr );
   int length = a->MyLength();
+  double *forcePtr, *externalForcePtr, *densityPtr;
+  force->ExtractView( &forcePtr );
+  externalForce->ExtractView( &externalForcePtr );
+  density->ExtractView( &densityPtr );
 
   // Set the prescribed displacements (allow for nonzero initial displacements).
   // Then back compute the displacement vector.  Leave the velocity as zero.
@@ -1489,9 +1606,12 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   PeridigmNS::Timer::self().startTimer("Gather/Scatter");
   force->PutScalar(0.0);
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-    scratch->PutScalar(0.0);
-    blockIt->exportData(scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
-    force->Update(1.0, *scratch, 1.0);
+    Teuchos::RCP<Epetra_Vector> blockForce = heldForce[blockIt - blocks->begin()];
+    if(blockForce.is_null())
+      blockForce = scratch;
+    blockForce->PutScalar(0.0);
+    blockIt->exportData(blockForce, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
+    force->Update(1.0, *blockForce, 1.0);
   }
   if(analysisHasContact){
     contactManager->exportData(contactForce);
@@ -1516,10 +1636,11 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
 
   // fill the acceleration vector
-  (*a) = (*force);
-  for(int i=0 ; i<a->MyLength() ; ++i){
-    (*a)[i] += (*externalForce)[i];
-    (*a)[i] /= (*density)[i/3];
+  bool initialForcesAreFinite = VerletComputeAcceleration(density->MyLength(), forcePtr, externalForcePtr, densityPtr, aPtr);
+  if(!initialForcesAreFinite){
+    for(int i=0 ; i<externalForce->MyLength() ; ++i)
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite((*externalForce)[i]), "**** NaN returned by external force evaluation.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** NaN returned by force evaluation.\n");
   }
   // Write initial configuration to disk
   PeridigmNS::Timer::self().startTimer("Output");
@@ -1545,7 +1666,7 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   for(int step=1; step<=nsteps; step++){
 
     timePrevious = timeCurrent;
-    timeCurrent = timeInitial + (step*dt);
+    timeCurrent = timeStepOriginTime + ((step - timeStepOriginStep)*dt);
 
     // TODO this should not be here
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
@@ -1569,6 +1690,8 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     // \todo Should we load updated information first?  If so, only do this if we're really going to rebalance.
     if(analysisHasContact)
       contactManager->rebalance(step);
+    if(!loadBalancer.is_null() && loadBalancer->rebalanceRequired(step))
+      loadBalancer->rebalance(blocks);
     PeridigmNS::Timer::self().stopTimer("Rebalance");
 
     // Do one step of velocity-Verlet
@@ -1589,23 +1712,26 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, timePrevious);
     PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
 
-    // Y^{n+1} = X_{o} + U^{n} + (dt)*V^{n+1/2}
-    // \todo Replace with blas call
-    for(int i=0 ; i<y->MyLength() ; ++i)
-      yPtr[i] = xPtr[i] + uPtr[i] + dt*vPtr[i];
-
     // U^{n+1} = U^{n} + (dt)*V^{n+1/2}
-    // blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
-    blas.AXPY(length, dt, vPtr, uPtr, 1, 1);
+    // Y^{n+1} = X_{o} + U^{n+1}
+    VerletUpdatePositions(length, dt, xPtr, vPtr, uPtr, yPtr);
 
     // \todo The velocity copied into the DataManager is actually the midstep velocity, not the NP1 velocity; this can be fixed by creating a midstep velocity field in the DataManager and setting the NP1 value as invalid.
 
     // Copy data from mothership vectors to overlap vectors in data manager
     PeridigmNS::Timer::self().startTimer("Gather/Scatter");
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      blockIt->importData(u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
+      // blocks that are not evaluated at this step do not require updated ghost data
+      if(step%blockIt->getSubcycleRatio() != 0)
+        continue;
+      if(overlapCommunication){
+        blockIt->beginImportData(kinematicSources, kinematicFieldIds, PeridigmField::STEP_NP1);
+      }
+      else{
+        blockIt->importData(u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
+        blockIt->importData(y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
+        blockIt->importData(v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
+      }
       blockIt->importData(deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
       blockIt->importData(temperature, temperatureFieldId, PeridigmField::STEP_NP1, Insert);
       blockIt->importData(concentration, concentrationFieldId, PeridigmField::STEP_NP1, Insert);
@@ -1690,17 +1816,48 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     }
 
     // Update forces based on new positions
-    PeridigmNS::Timer::self().startTimer("Internal Force");
-    modelEvaluator->evalModel(workset);
-    PeridigmNS::Timer::self().stopTimer("Internal Force");
+    if(overlapCommunication){
+      // Evaluate the interior points while the ghosted kinematic data is in transit
+      PeridigmNS::Timer::self().startTimer("Internal Force");
+      modelEvaluator->evalModelInterior(workset);
+      PeridigmNS::Timer::self().stopTimer("Internal Force");
+      PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+        blockIt->finishImportData();
+      PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+      PeridigmNS::Timer::self().startTimer("Internal Force");
+      modelEvaluator->evalModelBoundary(workset);
+      PeridigmNS::Timer::self().stopTimer("Internal Force");
+    }
+    else if(subcycling){
+      PeridigmNS::Timer::self().startTimer("Internal Force");
+      modelEvaluator->evalModelSubcycle(workset, step);
+      PeridigmNS::Timer::self().stopTimer("Internal Force");
+    }
+    else{
+      PeridigmNS::Timer::self().startTimer("Internal Force");
+      modelEvaluator->evalModel(workset);
+      PeridigmNS::Timer::self().stopTimer("Internal Force");
+    }
 
     // Copy force from the data manager to the mothership vector
     PeridigmNS::Timer::self().startTimer("Gather/Scatter");
     force->PutScalar(0.0);
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      scratch->PutScalar(0.0);
-      blockIt->exportData(scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
-      force->Update(1.0, *scratch, 1.0);
+      Teuchos::RCP<Epetra_Vector> blockForce = heldForce[blockIt - blocks->begin()];
+      if(blockForce.is_null()){
+        scratch->PutScalar(0.0);
+        blockIt->exportData(scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
+        force->Update(1.0, *scratch, 1.0);
+      }
+      else{
+        // subcycled block, the force is held between evaluations
+        if(step%blockIt->getSubcycleRatio() == 0){
+          blockForce->PutScalar(0.0);
+          blockIt->exportData(blockForce, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
+        }
+        force->Update(1.0, *blockForce, 1.0);
+      }
     }
     if(analysisHasBondAssociatedHypoelasticModel){
       damage->PutScalar(0.0);
@@ -1712,16 +1869,6 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     }
     PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
 
-    // Check for NaNs in force evaluation
-    // We'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
-    for(int i=0 ; i<force->MyLength() ; ++i)
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite((*force)[i]), "**** NaN returned by force evaluation.\n");
-
-    // Check for NaNs in force evaluation
-    // We'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
-    for(int i=0 ; i<externalForce->MyLength() ; ++i)
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite((*externalForce)[i]), "**** NaN returned by external force evaluation.\n");
-
     if(analysisHasContact){
       contactManager->exportData(contactForce);
       // Check for NaNs in contact force evaluation
@@ -1731,29 +1878,64 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
       force->Update(1.0, *contactForce, 1.0);
     }
 
-    // fill the acceleration vector
-    (*a) = (*force);
-    for(int i=0 ; i<a->MyLength() ; ++i){
-      (*a)[i] += (*externalForce)[i];
-      (*a)[i] /= (*density)[i/3];
-    }
-
+    // A^{n+1} = (F^{n+1} + F_ext^{n+1})/density
     // V^{n+1}   = V^{n+1/2} + (dt/2)*A^{n+1}
-    //blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
-    blas.AXPY(length, dt2, aPtr, vPtr, 1, 1);
+    // Also checks for NaNs in the force evaluation; we'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
+    bool forcesAreFinite = VerletUpdateAccelerationAndVelocity(density->MyLength(), dt2, forcePtr, externalForcePtr, densityPtr, aPtr, vPtr);
+    if(!forcesAreFinite){
+      for(int i=0 ; i<externalForce->MyLength() ; ++i)
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite((*externalForce)[i]), "**** NaN returned by external force evaluation.\n");
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** NaN returned by force evaluation.\n");
+    }
 
     PeridigmNS::Timer::self().startTimer("Output");
     synchDataManagers();
     if(analysisHasDataLoader){
       dataLoader->loadData(timeCurrent, blocks);
     }
-    outputManager->write(blocks, timeCurrent);
+    // output assumes the blocks are in the initial decomposition; rebalanced blocks are written from copies in that decomposition
+    Teuchos::RCP< std::vector<PeridigmNS::Block> > outputBlocks = blocks;
+    if(!loadBalancer.is_null() && loadBalancer->isRebalanced() && outputManager->writesNextCall())
+      outputBlocks = loadBalancer->initialDecompositionBlocks(blocks);
+    outputManager->write(outputBlocks, timeCurrent);
     PeridigmNS::Timer::self().stopTimer("Output");
 
     // swap state N and state NP1
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
-      blockIt->updateState();
+    // a subcycled block advances its state only prior to the steps at which it is evaluated
+    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+      if((step+1)%blockIt->getSubcycleRatio() == 0)
+        blockIt->updateState();
+    }
+
+    // Re-estimate the stable time step, limiting its growth
+    if(adaptiveTimeStep && step%timeStepUpdateInterval == 0 && step < nsteps){
+      PeridigmNS::Timer::self().startTimer("Critical Time Step");
+      double updatedCriticalTimeStep = 1.0e50;
+      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+        double blockCriticalTimeStep = ComputeCriticalTimeStep(*peridigmComm, *blockIt, true);
+        if(blockCriticalTimeStep < updatedCriticalTimeStep)
+          updatedCriticalTimeStep = blockCriticalTimeStep;
+      }
+      PeridigmNS::Timer::self().stopTimer("Critical Time Step");
+      double updatedTimeStep = safetyFactor*updatedCriticalTimeStep;
+      if(updatedTimeStep > maxTimeStepGrowth*dt)
+        updatedTimeStep = maxTimeStepGrowth*dt;
+      if(updatedTimeStep != dt){
+        dt = updatedTimeStep;
+        dt2 = dt/2.0;
+        workset->timeStep = dt;
+        timeStepOriginStep = step;
+        timeStepOriginTime = timeCurrent;
+        nsteps = step + static_cast<int>( floor((timeFinal-timeCurrent)/dt) );
+        if(peridigmComm->MyPID() == 0)
+          cout << "\nTime step updated to " << dt << " at step " << step << ", total number of time steps " << nsteps << endl;
+      }
+    }
   }
+  if(!loadBalancer.is_null())
+    loadBalancer->restoreInitialDecomposition(blocks);
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+    blockIt->setSubcycleRatio(1);
   displayProgress("Explicit time integration", 100.0);
   *out << "\n\n";
 }
@@ -2659,6 +2841,25 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
   double dampedNewtonDiagonalScaleFactor = quasiStaticParams->get("Damped Newton Diagonal Scale Factor", 1.0001);
   double dampedNewtonDiagonalShiftFactor = quasiStaticParams->get("Damped Newton Diagonal Shift Factor", 0.00001);
 
+  // Matrix-free Newton-Krylov:  the tangent is applied through directional derivatives of the residual,
+  // and only its block diagonal is assembled (for use as the preconditioner)
+  bool useMatrixFreeJacobian = quasiStaticParams->get("Matrix-Free Jacobian", false);
+  Teuchos::RCP<Epetra_Vector> kinematicBCDiagonal;
+  if(useMatrixFreeJacobian){
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "**** Error:  Matrix-Free Jacobian is not supported for multiphysics quasi-statics.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(jacobianType != PeridigmNS::Material::BLOCK_DIAGONAL,
+                                "**** Error:  Matrix-Free Jacobian requires the block diagonal tangent only (do not request the full tangent).\n");
+    double relativePerturbation = quasiStaticParams->get("Matrix-Free Perturbation", 1.0e-7);
+    matrixFreeJacobian = Teuchos::rcp(new PeridigmNS::MatrixFreeJacobianOperator(this, tangentMap, relativePerturbation));
+    kinematicBCDiagonal = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+    if(peridigmComm->MyPID() == 0)
+      cout << "Quasi-statics using matrix-free Jacobian with block diagonal preconditioner.\n" << endl;
+  }
+
+  // The matrix-free solver relies on the block diagonal preconditioner, otherwise the default is no preconditioner
+  const bool userSpecifiedPreconditioner = quasiStaticParams->isParameter("Preconditioner");
+  initializeLinearSolverPreconditioner(quasiStaticParams, useMatrixFreeJacobian ? "ILU" : "None");
+
   // Determine tolerance
   double tolerance = quasiStaticParams->get("Relative Tolerance", 1.0e-6);
   bool useAbsoluteTolerance = false;
@@ -2887,8 +3088,9 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
 
     int solverIteration = 1;
     bool dampedNewton = false;
-    bool usePreconditioner = false; // \todo Determine why ifpack preconditioners started exhibiting problems with Trilinos 11.2.5 (Jul-11-2013).
-                                    //       For the record, Trilinos 11.2.4 (Jun-20-2013) works.
+    // \todo Determine why ifpack preconditioners started exhibiting problems with Trilinos 11.2.5 (Jul-11-2013).
+    //       For the record, Trilinos 11.2.4 (Jun-20-2013) works.  For this reason no preconditioner is used by default.
+    bool usePreconditioner = (linearSolverPreconditionerType != "None");
     int numPureNewtonSteps = 50;//8;
     int numPreconditionerSteps = 24;
     int dampedNewtonNumStepsBetweenTangentUpdates = 8;
@@ -2934,7 +3136,8 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
         }
 
         // Disable the preconditioner if the user specifies disable heuristics
-        if(disableHeuristics) usePreconditioner = false;
+        // (a preconditioner requested explicitly, or required by the matrix-free solver, is retained)
+        if(disableHeuristics && !useMatrixFreeJacobian && !userSpecifiedPreconditioner) usePreconditioner = false;
 
         // Compute the tangent
         if( !dampedNewton || (solverIteration-numPureNewtonSteps-1)%dampedNewtonNumStepsBetweenTangentUpdates==0 ){
@@ -2949,12 +3152,31 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
           boundaryAndInitialConditionManager->applyKinematicBC_InsertZerosAndSetDiagonal(tangent);
           tangent->Scale(-1.0);
 
+          // The matrix-free operator takes the diagonal entries for kinematic B.C. rows from the assembled block diagonal
+          if(useMatrixFreeJacobian){
+            Epetra_Vector nonKinematicBCDiagonal(tangent->Map());
+            tangent->ExtractDiagonalCopy(*kinematicBCDiagonal);
+            nonKinematicBCDiagonal = *kinematicBCDiagonal;
+            boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(Teuchos::rcpFromRef(nonKinematicBCDiagonal));
+            kinematicBCDiagonal->Update(-1.0, nonKinematicBCDiagonal, 1.0);
+            matrixFreeJacobian->setKinematicBCDiagonal(kinematicBCDiagonal);
+          }
+
+          // For the matrix-free solver, damping modifies only the preconditioner
           if(dampedNewton)
             quasiStaticsDampTangent(dampedNewtonDiagonalScaleFactor, dampedNewtonDiagonalShiftFactor);
           if(usePreconditioner)
             quasiStaticsSetPreconditioner(linearProblem);
         }
 
+        if(useMatrixFreeJacobian){
+          double uNorm, deltaUNorm;
+          u->Norm2(&uNorm);
+          deltaU->Norm2(&deltaUNorm);
+          matrixFreeJacobian->setBaseResidual(residual);
+          matrixFreeJacobian->setSolutionNorm(uNorm + deltaUNorm);
+        }
+
         // Solve linear system
         isConverged = quasiStaticsSolveSystem(residual, lhs, linearProblem, belosSolver);
 
@@ -3188,6 +3410,9 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
     executeExplicit(explicitSolverParams);
   }
 
+  // Subsequent solvers apply the assembled tangent
+  matrixFreeJacobian = Teuchos::null;
+
   if(peridigmComm->MyPID() == 0)
     cout << endl;
 }
@@ -3240,6 +3465,9 @@ void PeridigmNS::Peridigm::executeImplicitDiffusion(Teuchos::RCP<Teuchos::Parame
     belosSolver = Teuchos::rcp( new Belos::BlockCGSolMgr<double,Epetra_MultiVector,Epetra_Operator>(Teuchos::rcp(&linearProblem,false), Teuchos::rcp(&belosList,false)) );
   }
 
+  // The preconditioner settings of any previously executed solver do not carry over to the diffusion solve
+  initializeLinearSolverPreconditioner(implicitSolverParams, "ILU");
+
   // Create list of time steps
 
   // Case 1:  User provided initial time, final time, and number of load steps
@@ -3427,26 +3655,164 @@ void PeridigmNS::Peridigm::executeImplicitDiffusion(Teuchos::RCP<Teuchos::Parame
     cout << endl;
 }
 
+void PeridigmNS::Peridigm::initializeLinearSolverPreconditioner(Teuchos::RCP<Teuchos::ParameterList> params,
+                                                               const std::string& defaultPreconditionerType) {
+
+  linearSolverPreconditionerType = defaultPreconditionerType;
+  if(params->isParameter("Preconditioner"))
+    linearSolverPreconditionerType = params->get<std::string>("Preconditioner");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(linearSolverPreconditionerType != "None" && linearSolverPreconditionerType != "ILU" && linearSolverPreconditionerType != "AMG",
+                              "**** Error:  Unknown Preconditioner \"" + linearSolverPreconditionerType + "\", valid options are \"None\", \"ILU\", and \"AMG\".\n");
+
+  // Preconditioner reuse across Newton iterations and load steps
+  preconditionerReusePolicy = "Reuse Symbolic";
+  if(params->isParameter("Preconditioner Reuse Policy"))
+    preconditionerReusePolicy = params->get<std::string>("Preconditioner Reuse Policy");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(preconditionerReusePolicy != "Rebuild" && preconditionerReusePolicy != "Reuse Symbolic" && preconditionerReusePolicy != "Reuse",
+                              "**** Error:  Unknown Preconditioner Reuse Policy \"" + preconditionerReusePolicy + "\", valid options are \"Rebuild\", \"Reuse Symbolic\", and \"Reuse\".\n");
+  maxPreconditionerAge = params->get("Max Age Of Prec", 1);
+  maxLinearIterationsBeforeRecompute = params->get("Max Linear Iterations Before Recompute", std::numeric_limits<int>::max());
+  preconditionerAge = 0;
+  numLinearIterations = 0;
+  ifpackPreconditioner = Teuchos::null;
+
+  amgPreconditionerParams = Teuchos::ParameterList();
+  if(linearSolverPreconditionerType == "AMG"){
+#ifdef USE_ML
+    if(params->isSublist("AMG"))
+      amgPreconditionerParams = params->sublist("AMG");
+    amgPreconditioner = Teuchos::null;
+    computeRigidBodyModes();
+#else
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error:  AMG preconditioner not available.  Trilinos must be compiled with ML to enable this feature.\n");
+#endif
+  }
+}
+
+void PeridigmNS::Peridigm::computeRigidBodyModes() {
+
+  // Rigid-body modes are defined for the displacement degrees of freedom only
+  int numDofs = PeridigmNS::DegreesOfFreedomManager::self().totalNumberOfDegreesOfFreedom();
+  rigidBodyModes.clear();
+  if(numDofs != 3)
+    return;
+
+  // Rotations are taken about the centroid of the model to improve the conditioning of the null space
+  double *xPtr;
+  x->ExtractView( &xPtr );
+  int numOwnedPoints = x->MyLength()/3;
+  double localSum[3] = {0.0, 0.0, 0.0};
+  double centroid[3];
+  for(int i=0 ; i<numOwnedPoints ; ++i)
+    for(int dof=0 ; dof<3 ; ++dof)
+      localSum[dof] += xPtr[3*i+dof];
+  peridigmComm->SumAll(localSum, centroid, 3);
+  int numGlobalPoints = x->GlobalLength()/3;
+  for(int dof=0 ; dof<3 ; ++dof)
+    centroid[dof] /= numGlobalPoints;
+
+  // Three translations followed by three rotations, stored one vector after another
+  int length = 3*numOwnedPoints;
+  rigidBodyModes.resize(6*length, 0.0);
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    double X = xPtr[3*i]   - centroid[0];
+    double Y = xPtr[3*i+1] - centroid[1];
+    double Z = xPtr[3*i+2] - centroid[2];
+    for(int dof=0 ; dof<3 ; ++dof)
+      rigidBodyModes[dof*length + 3*i + dof] = 1.0;
+    // rotation about x
+    rigidBodyModes[3*length + 3*i + 1] = -Z;
+    rigidBodyModes[3*length + 3*i + 2] =  Y;
+    // rotation about y
+    rigidBodyModes[4*length + 3*i]     =  Z;
+    rigidBodyModes[4*length + 3*i + 2] = -X;
+    // rotation about z
+    rigidBodyModes[5*length + 3*i]     = -Y;
+    rigidBodyModes[5*length + 3*i + 1] =  X;
+  }
+}
+
 void PeridigmNS::Peridigm::quasiStaticsSetPreconditioner(Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>& linearProblem) {
-  Ifpack IFPFactory;
-  Teuchos::ParameterList ifpackList;
-
-  std::string PrecType = "ILU"; // incomplete LU
-  int OverlapLevel = 1; // must be >= 0. If Comm.NumProc() == 1, param is ignored.
-  Teuchos::RCP<Ifpack_Preconditioner> Prec = Teuchos::rcp( IFPFactory.Create(PrecType, &(*tangent), OverlapLevel) );
-  // ifpackList.set("fact: drop tolerance", 1e-9);
-  ifpackList.set("fact: ilut level-of-fill", 0);
-  TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->SetParameters(ifpackList),
-                              "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->SetParameters() returned nonzero error code.\n");
-  TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->Initialize(),
-                              "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Initialize() returned nonzero error code.\n");
-  TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->Compute(),
-                              "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Compute() returned nonzero error code.\n");
-  // Create the Belos preconditioned operator from the Ifpack preconditioner.
+
+  // Create the Belos preconditioned operator from the Ifpack or ML preconditioner.
   // NOTE:  This is necessary because Belos expects an operator to apply the
   //        preconditioner with Apply() NOT ApplyInverse().
-  Teuchos::RCP<Belos::EpetraPrecOp> belosPrec = Teuchos::rcp( new Belos::EpetraPrecOp( Prec ) );
-  linearProblem.setLeftPrec( belosPrec );
+  Teuchos::RCP<Epetra_Operator> Prec = ifpackPreconditioner;
+#ifdef USE_ML
+  if(linearSolverPreconditionerType == "AMG")
+    Prec = amgPreconditioner;
+#endif
+
+  // With the "Reuse" policy, an existing preconditioner is applied to the updated tangent until it is either too old
+  // or the linear solver required too many iterations with it
+  if(!Prec.is_null() && preconditionerReusePolicy == "Reuse"){
+    if(preconditionerAge < maxPreconditionerAge && numLinearIterations <= maxLinearIterationsBeforeRecompute){
+      preconditionerAge += 1;
+      linearProblem.setLeftPrec( Teuchos::rcp( new Belos::EpetraPrecOp( Prec ) ) );
+      return;
+    }
+  }
+
+  // The symbolic phase (ILU graph, multigrid aggregates and transfer operators) is retained unless the policy is "Rebuild".
+  // Note that the sparsity pattern of the tangent is fixed at allocation, so the symbolic phase never needs to be repeated
+  // (with the exception of the overlapping ILU in parallel, see below).
+  bool reuseSymbolic = !Prec.is_null() && preconditionerReusePolicy != "Rebuild";
+
+  PeridigmNS::Timer::self().startTimer("Compute Preconditioner");
+
+  if(linearSolverPreconditionerType == "AMG"){
+#ifdef USE_ML
+    if(reuseSymbolic){
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(amgPreconditioner->ReComputePreconditioner() != 0,
+                                  "**** PeridigmNS::Peridigm::quasiStaticsSetPreconditioner(), ReComputePreconditioner() returned nonzero error code.\n");
+    }
+    else{
+      int numDofs = PeridigmNS::DegreesOfFreedomManager::self().totalNumberOfDegreesOfFreedom();
+      Teuchos::ParameterList mlList;
+      ML_Epetra::SetDefaults("SA", mlList);
+      mlList.set("ML output", 0);
+      mlList.set("PDE equations", numDofs);
+      if(!rigidBodyModes.empty()){
+        mlList.set("null space: type", "pre-computed");
+        mlList.set("null space: dimension", 6);
+        mlList.set("null space: vectors", &rigidBodyModes[0]);
+      }
+      // User-supplied ML parameters take precedence
+      mlList.setParameters(amgPreconditionerParams);
+      amgPreconditioner = Teuchos::rcp(new ML_Epetra::MultiLevelPreconditioner(*tangent, mlList, true));
+    }
+    Prec = amgPreconditioner;
+#endif
+  }
+  else{
+    const int OverlapLevel = 1; // must be >= 0. If Comm.NumProc() == 1, param is ignored.
+    if(!reuseSymbolic){
+      Ifpack IFPFactory;
+      Teuchos::ParameterList ifpackList;
+
+      std::string PrecType = "ILU"; // incomplete LU
+      ifpackPreconditioner = Teuchos::rcp( IFPFactory.Create(PrecType, &(*tangent), OverlapLevel) );
+      // ifpackList.set("fact: drop tolerance", 1e-9);
+      ifpackList.set("fact: ilut level-of-fill", 0);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(ifpackPreconditioner->SetParameters(ifpackList),
+                                  "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->SetParameters() returned nonzero error code.\n");
+    }
+    // In parallel, the additive Schwarz wrapper imports the overlapping rows of the tangent in Initialize(),
+    // so calling Compute() alone would factor stale off-processor values; the symbolic phase is reused only in serial.
+    if(!reuseSymbolic || (peridigmComm->NumProc() > 1 && OverlapLevel > 0)){
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(ifpackPreconditioner->Initialize(),
+                                  "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Initialize() returned nonzero error code.\n");
+    }
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(ifpackPreconditioner->Compute(),
+                                "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Compute() returned nonzero error code.\n");
+    Prec = ifpackPreconditioner;
+  }
+
+  PeridigmNS::Timer::self().stopTimer("Compute Preconditioner");
+
+  preconditionerAge = 1;
+  numLinearIterations = 0;
+  linearProblem.setLeftPrec( Teuchos::rcp( new Belos::EpetraPrecOp( Prec ) ) );
 }
 
 void PeridigmNS::Peridigm::quasiStaticsDampTangent(double dampedNewtonDiagonalScaleFactor,
@@ -3478,11 +3844,15 @@ Belos::ReturnType PeridigmNS::Peridigm::quasiStaticsSolveSystem(Teuchos::RCP<Epe
   Belos::ReturnType isConverged(Belos::Unconverged);
 
   lhs->PutScalar(0.0);
-  linearProblem.setOperator(tangent);
+  if(!matrixFreeJacobian.is_null())
+    linearProblem.setOperator(matrixFreeJacobian);
+  else
+    linearProblem.setOperator(tangent);
   bool isSet = linearProblem.setProblem(lhs, residual);
   TEUCHOS_TEST_FOR_EXCEPT_MSG(!isSet, "**** Belos::LinearProblem::setProblem() returned nonzero error code.\n");
   try{
     isConverged = belosSolver->solve();
+    numLinearIterations = belosSolver->getNumIters();
   }
   catch(const std::exception &e){
     if(peridigmComm->MyPID() == 0)
@@ -3798,6 +4168,7 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
   double dt                      = implicitParams->get<double>("Fixed dt");
   double beta                    = implicitParams->get("Beta", 0.25);
   double gamma                   = implicitParams->get("Gamma", 0.50);
+  initializeLinearSolverPreconditioner(implicitParams, "None");
   workset->timeStep = dt;
   double dt2 = dt*dt;
   int nsteps = (int)floor((timeFinal-timeInitial)/dt);
@@ -4021,6 +4392,9 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
       // Want to solve J*displacementIncrement = -residual
       residual->Scale(-1.0);
 
+      if(linearSolverPreconditionerType != "None")
+        quasiStaticsSetPreconditioner(linearProblem);
+
       // Solve linear system
       displacementIncrement->PutScalar(0.0);
       if(analysisHasMultiphysics){
@@ -4033,6 +4407,7 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
       TEUCHOS_TEST_FOR_EXCEPT_MSG(!isSet, "**** Peridigm::executeImplicit(), failed to set linear problem.\n");
       PeridigmNS::Timer::self().startTimer("Solve Linear System");
       Belos::ReturnType isConverged = belosSolver->solve();
+      numLinearIterations = belosSolver->getNumIters();
       if(isConverged != Belos::Converged && peridigmComm->MyPID() == 0)
         cout << "Warning:  Belos linear solver failed to converge!  Proceeding with nonconverged solution..." << endl;
       PeridigmNS::Timer::self().stopTimer("Solve Linear System");
@@ -4467,6 +4842,48 @@ double PeridigmNS::Peridigm::computeQuasiStaticResidual(Teuchos::RCP<Epetra_Vect
   return residualNorm2 + 20.0*residualNormInf;
 }
 
+void PeridigmNS::Peridigm::computeQuasiStaticPerturbedResidual(const Epetra_Vector& direction,
+                                                               double perturbation,
+                                                               Teuchos::RCP<Epetra_Vector> perturbedResidual) {
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "**** PeridigmNS::Peridigm::computeQuasiStaticPerturbedResidual(), multiphysics is not supported.\n");
+
+  // Store the unperturbed displacement increment so that it can be restored exactly
+  if(perturbedResidualUnperturbedDeltaU.is_null() || !perturbedResidualUnperturbedDeltaU->Map().SameAs(deltaU->Map()))
+    perturbedResidualUnperturbedDeltaU = Teuchos::rcp(new Epetra_Vector(deltaU->Map()));
+  *perturbedResidualUnperturbedDeltaU = *deltaU;
+
+  // The kinematic B.C. columns are zero in the assembled tangent, so the prescribed degrees of freedom are not perturbed
+  if(perturbedResidualDirection.is_null() || !perturbedResidualDirection->Map().SameAs(direction.Map()))
+    perturbedResidualDirection = Teuchos::rcp(new Epetra_Vector(direction.Map()));
+  *perturbedResidualDirection = direction;
+  boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(perturbedResidualDirection);
+
+  double *xPtr, *uPtr, *yPtr, *vPtr, *deltaUPtr, *unperturbedDeltaUPtr;
+  x->ExtractView( &xPtr );
+  u->ExtractView( &uPtr );
+  y->ExtractView( &yPtr );
+  v->ExtractView( &vPtr );
+  deltaU->ExtractView( &deltaUPtr );
+  perturbedResidualUnperturbedDeltaU->ExtractView( &unperturbedDeltaUPtr );
+  const double* directionPtr = perturbedResidualDirection->Values();
+  double dt = workset->timeStep;
+
+  for(int i=0 ; i<y->MyLength() ; ++i){
+    deltaUPtr[i] += perturbation*directionPtr[i];
+    yPtr[i] = xPtr[i] + uPtr[i] + deltaUPtr[i];
+    vPtr[i] = deltaUPtr[i]/dt;
+  }
+
+  computeQuasiStaticResidual(perturbedResidual);
+
+  for(int i=0 ; i<y->MyLength() ; ++i){
+    deltaUPtr[i] = unperturbedDeltaUPtr[i];
+    yPtr[i] = xPtr[i] + uPtr[i] + deltaUPtr[i];
+    vPtr[i] = deltaUPtr[i]/dt;
+  }
+}
+
 void PeridigmNS::Peridigm::computeImplicitJacobian(double beta, double dt) {
 //TODO make multiphysics
   // Compute the tangent
@@ -67,16 +67,22 @@
 #include <Teuchos_FancyOStream.hpp>
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
+#include <Ifpack_Preconditioner.h>
+#ifdef USE_ML
+  #include <ml_MultiLevelPreconditioner.h>
+#endif
 
 #include "Peridigm_Block.hpp"
 #include "Peridigm_Discretization.hpp"
 #include "Peridigm_ModelEvaluator.hpp"
 #include "Peridigm_DataManager.hpp"
 #include "Peridigm_SerialMatrix.hpp"
+#include "Peridigm_MatrixFreeJacobianOperator.hpp"
 #include "Peridigm_OutputManagerContainer.hpp"
 #include "Peridigm_ComputeManager.hpp"
 #include "Peridigm_BoundaryAndInitialConditionManager.hpp"
 #include "Peridigm_ContactManager.hpp"
+#include "Peridigm_LoadBalancer.hpp"
 #include "Peridigm_ServiceManager.hpp"
 #include "Peridigm_DataLoader.hpp"
 #include "Peridigm_Memstat.hpp"
@@ -279,9 +285,16 @@ namespace PeridigmNS {
     //! Main routine to drive problem solution for quasistatics using NOX
     void executeNOXQuasiStatic(Teuchos::RCP<Teuchos::ParameterList> solverParams);
 
+    //! Read the preconditioner settings for the global linear system from the solver parameter list
+    void initializeLinearSolverPreconditioner(Teuchos::RCP<Teuchos::ParameterList> params,
+                                              const std::string& defaultPreconditionerType);
+
     //! Set the preconditioner for the global linear system
     void quasiStaticsSetPreconditioner(Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>& linearProblem);
 
+    //! Compute the rigid-body modes of the model configuration, used as the near null space for algebraic multigrid
+    void computeRigidBodyModes();
+
     //! Damp the tangent matrix by scaling the diagonal and adding a small value to each entry in the diagonal
     void quasiStaticsDampTangent(double dampedNewtonDiagonalScaleFactor,
                                  double dampedNewtonDiagonalShiftFactor);
@@ -312,6 +325,11 @@ namespace PeridigmNS {
     //! Compute the residual for quasi-statics
     double computeQuasiStaticResidual(Teuchos::RCP<Epetra_Vector> residual);
 
+    //! Compute the quasi-statics residual at the current state perturbed by perturbation*direction, then restore the current state; kinematic B.C. entries of the direction are ignored
+    void computeQuasiStaticPerturbedResidual(const Epetra_Vector& direction,
+                                             double perturbation,
+                                             Teuchos::RCP<Epetra_Vector> perturbedResidual);
+
     //! Synchronize data in DataManagers across processes (needed before call to OutputManager::write() )
     void synchDataManagers();
 
@@ -376,6 +394,9 @@ namespace PeridigmNS {
     //! Accessor for node sets
     Teuchos::RCP< std::map< std::string, std::vector<int> > > getExodusNodeSets();
 
+    //! Accessor for boundary and initial condition manager
+    Teuchos::RCP<PeridigmNS::BoundaryAndInitialConditionManager> getBoundaryAndInitialConditionManager() { return boundaryAndInitialConditionManager; }
+
     //! Accessor for compute manager
     Teuchos::RCP< PeridigmNS::ComputeManager > getComputeManager() { return computeManager; }
 
@@ -445,6 +466,9 @@ namespace PeridigmNS {
     //! Contact manager
     Teuchos::RCP<PeridigmNS::ContactManager> contactManager;
 
+    //! Load balancer for the material blocks
+    Teuchos::RCP<PeridigmNS::LoadBalancer> loadBalancer;
+
     //! Compute manager
     Teuchos::RCP<PeridigmNS::ComputeManager> computeManager;
 
@@ -612,6 +636,45 @@ namespace PeridigmNS {
     //! Block diagonal of global tangent matrix
     Teuchos::RCP<Epetra_FECrsMatrix> blockDiagonalTangent;
 
+    //! Matrix-free tangent operator for quasi-statics (null unless "Matrix-Free Jacobian" is requested)
+    Teuchos::RCP<PeridigmNS::MatrixFreeJacobianOperator> matrixFreeJacobian;
+
+    //! Work vectors for computeQuasiStaticPerturbedResidual()
+    Teuchos::RCP<Epetra_Vector> perturbedResidualUnperturbedDeltaU;
+    Teuchos::RCP<Epetra_Vector> perturbedResidualDirection;
+
+    //! Preconditioner for the quasi-static and implicit linear systems ("None", "ILU", or "AMG")
+    std::string linearSolverPreconditionerType;
+
+    //! User-supplied ML parameters for the algebraic multigrid preconditioner
+    Teuchos::ParameterList amgPreconditionerParams;
+
+    //! Reuse policy for the quasi-static and implicit preconditioner ("Rebuild", "Reuse Symbolic", or "Reuse")
+    std::string preconditionerReusePolicy;
+
+    //! Number of tangent updates the current preconditioner has been used for
+    int preconditionerAge;
+
+    //! Maximum number of tangent updates a preconditioner is used for under the "Reuse" policy
+    int maxPreconditionerAge;
+
+    //! Under the "Reuse" policy, the preconditioner is recomputed if the previous linear solve took more iterations than this
+    int maxLinearIterationsBeforeRecompute;
+
+    //! Number of iterations taken by the most recent linear solve
+    int numLinearIterations;
+
+    //! Incomplete factorization preconditioner
+    Teuchos::RCP<Ifpack_Preconditioner> ifpackPreconditioner;
+
+    //! Rigid-body modes (AMG near null space), stored here because ML does not copy them
+    std::vector<double> rigidBodyModes;
+
+#ifdef USE_ML
+    //! Algebraic multigrid preconditioner
+    Teuchos::RCP<ML_Epetra::MultiLevelPreconditioner> amgPreconditioner;
+#endif
+
     //! Tracker for total number of iterations taken by the nonlinear solver for implicit time integration
     Teuchos::RCP<int> nonlinearSolverIterations;
 
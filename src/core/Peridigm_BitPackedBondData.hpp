@@ -0,0 +1,101 @@
+/*! \file Peridigm_BitPackedBondData.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_BITPACKEDBONDDATA_HPP
+#define PERIDIGM_BITPACKEDBONDDATA_HPP
+
+#include <cstdint>
+
+namespace PeridigmNS {
+
+//! Number of bonds stored in each word of bit-packed bond data.
+const int bondsPerBitPackedWord = 32;
+
+//! Returns the number of words required to store the given number of bonds.
+inline int numBitPackedWords(int numBonds) { return (numBonds + bondsPerBitPackedWord - 1)/bondsPerBitPackedWord; }
+
+//! Returns the bit for the given bond.
+inline bool testBondBit(const std::uint32_t* words, int bondIndex)
+{
+  return ((words[bondIndex/bondsPerBitPackedWord] >> (bondIndex%bondsPerBitPackedWord)) & 1u) != 0;
+}
+
+//! Sets the bit for the given bond without branching on the value.
+inline void setBondBit(std::uint32_t* words, int bondIndex, bool value)
+{
+  std::uint32_t& word = words[bondIndex/bondsPerBitPackedWord];
+  const int shift = bondIndex%bondsPerBitPackedWord;
+  word = (word & ~(1u << shift)) | (static_cast<std::uint32_t>(value) << shift);
+}
+
+//! @name Accessors allowing kernels templated on the storage type to read and write double, float, and bit-packed bond data.
+//@{
+inline double getBondValue(const double* bondData, int bondIndex) { return bondData[bondIndex]; }
+inline double getBondValue(const float* bondData, int bondIndex) { return bondData[bondIndex]; }
+inline double getBondValue(const std::uint32_t* bondData, int bondIndex) { return static_cast<double>(testBondBit(bondData, bondIndex)); }
+inline void setBondValue(double* bondData, int bondIndex, double value) { bondData[bondIndex] = value; }
+inline void setBondValue(float* bondData, int bondIndex, double value) { bondData[bondIndex] = static_cast<float>(value); }
+inline void setBondValue(std::uint32_t* bondData, int bondIndex, double value) { setBondBit(bondData, bondIndex, value != 0.0); }
+//@}
+
+/*! \brief Read-only view of bit-packed bond data that can be indexed like an array of doubles.
+ *
+ *  Allows kernels templated on the bond data type to operate on bit-packed damage (0 or 1 per bond).
+ */
+class BitPackedBondView {
+public:
+  explicit BitPackedBondView(const std::uint32_t* words_) : words(words_) {}
+
+  double operator[](int bondIndex) const { return static_cast<double>(testBondBit(words, bondIndex)); }
+
+private:
+  const std::uint32_t* words;
+};
+
+}
+
+#endif // PERIDIGM_BITPACKEDBONDDATA_HPP
@@ -50,9 +50,51 @@
 #include <vector>
 #include <set>
 #include <sstream>
+#include <algorithm>
 
 using namespace std;
 
+namespace {
+
+//! Returns true if a model with the given field ids either does not use fieldId or lists it among its supported field ids.
+bool modelSupportsStorage(const vector<int>& modelFieldIds,
+                          const vector<int>& modelSupportedFieldIds,
+                          int fieldId)
+{
+  if(find(modelFieldIds.begin(), modelFieldIds.end(), fieldId) == modelFieldIds.end())
+    return true;
+  return find(modelSupportedFieldIds.begin(), modelSupportedFieldIds.end(), fieldId) != modelSupportedFieldIds.end();
+}
+
+/*! \brief Returns the bond fields that may use a compact storage format (single precision or bit packed).
+ *
+ *  A field qualifies only if every model that uses it supports the format; auxiliary fields (e.g., those
+ *  requested by compute classes) always access data through getData() and are kept in double precision.
+ */
+vector<int> compactStorageFieldIds(const vector<int>& materialFieldIds,
+                                   const vector<int>& materialSupportedFieldIds,
+                                   const vector<int>& damageFieldIds,
+                                   const vector<int>& damageSupportedFieldIds,
+                                   const vector<int>& auxiliaryFieldIds)
+{
+  vector<int> candidates(materialSupportedFieldIds);
+  candidates.insert(candidates.end(), damageSupportedFieldIds.begin(), damageSupportedFieldIds.end());
+  sort(candidates.begin(), candidates.end());
+  candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+
+  vector<int> fieldIds;
+  for(unsigned int i=0 ; i<candidates.size() ; ++i){
+    int fieldId = candidates[i];
+    if(find(auxiliaryFieldIds.begin(), auxiliaryFieldIds.end(), fieldId) == auxiliaryFieldIds.end() &&
+       modelSupportsStorage(materialFieldIds, materialSupportedFieldIds, fieldId) &&
+       modelSupportsStorage(damageFieldIds, damageSupportedFieldIds, fieldId))
+      fieldIds.push_back(fieldId);
+  }
+  return fieldIds;
+}
+
+}
+
 void PeridigmNS::Block::initialize(Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarPointMap,
                                    Teuchos::RCP<const Epetra_BlockMap> globalOverlapScalarPointMap,
                                    Teuchos::RCP<const Epetra_BlockMap> globalOwnedVectorPointMap,
@@ -81,12 +123,103 @@ void PeridigmNS::Block::initialize(Teuchos::RCP<const Epetra_BlockMap> globalOwn
   vector<int> materialModelFieldIds = materialModel->FieldIds();
   fieldIds.insert(fieldIds.end(), materialModelFieldIds.begin(), materialModelFieldIds.end());
   // Damage model field Ids (if any)
+  vector<int> damageModelFieldIds, damageModelSinglePrecisionFieldIds, damageModelBitPackedFieldIds;
   if(!damageModel.is_null()){
-    vector<int> damageModelFieldIds = damageModel->FieldIds();
+    damageModelFieldIds = damageModel->FieldIds();
     fieldIds.insert(fieldIds.end(), damageModelFieldIds.begin(), damageModelFieldIds.end());
   }
 
-  BlockBase::initializeDataManager(fieldIds);
+  // Optionally store bond fields in compact form, either in single precision or as one bit per bond
+  if(!damageModel.is_null()){
+    damageModelSinglePrecisionFieldIds = damageModel->SinglePrecisionBondFieldIds();
+    damageModelBitPackedFieldIds = damageModel->BitPackedBondFieldIds();
+  }
+  vector<int> singlePrecisionFieldIds;
+  if(blockParams.isParameter("Single Precision Bond Data") && blockParams.get<bool>("Single Precision Bond Data"))
+    singlePrecisionFieldIds = compactStorageFieldIds(materialModelFieldIds, materialModel->SinglePrecisionBondFieldIds(),
+                                                     damageModelFieldIds, damageModelSinglePrecisionFieldIds,
+                                                     auxiliaryFieldIds);
+  vector<int> bitPackedFieldIds;
+  if(blockParams.isParameter("Bit Packed Bond Data") && blockParams.get<bool>("Bit Packed Bond Data"))
+    bitPackedFieldIds = compactStorageFieldIds(materialModelFieldIds, materialModel->BitPackedBondFieldIds(),
+                                               damageModelFieldIds, damageModelBitPackedFieldIds,
+                                               auxiliaryFieldIds);
+
+  BlockBase::initializeDataManager(fieldIds, singlePrecisionFieldIds, bitPackedFieldIds);
+}
+
+void PeridigmNS::Block::rebalance(Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarPointMap,
+                                  Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOverlapScalarPointMap,
+                                  Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedVectorPointMap,
+                                  Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOverlapVectorPointMap,
+                                  Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarBondMap,
+                                  Teuchos::RCP<const Epetra_Vector> rebalancedGlobalBlockIds,
+                                  Teuchos::RCP<const PeridigmNS::NeighborhoodData> rebalancedGlobalNeighborhoodData,
+                                  Teuchos::RCP<const Epetra_BlockMap> importSourceMap,
+                                  Teuchos::RCP<const Epetra_Vector> rebalancedGlobalOverlapCoordinates,
+                                  bool preserveNeighborOrder_)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(dataManager.is_null(),
+                      "\n**** DataManager must be initialized via Block::initializeDataManager() prior to calling Block::rebalance()\n");
+
+  interiorPointSourceMap = importSourceMap;
+  if(pointOrdering != SpaceFillingCurve::NONE)
+    pointOrderingCoordinates = rebalancedGlobalOverlapCoordinates;
+  preserveNeighborOrder = preserveNeighborOrder_;
+
+  createMapsFromGlobalMaps(rebalancedGlobalOwnedScalarPointMap,
+                           rebalancedGlobalOverlapScalarPointMap,
+                           rebalancedGlobalOwnedVectorPointMap,
+                           rebalancedGlobalOverlapVectorPointMap,
+                           rebalancedGlobalOwnedScalarBondMap,
+                           rebalancedGlobalBlockIds,
+                           rebalancedGlobalNeighborhoodData);
+
+  neighborhoodData = createNeighborhoodDataFromGlobalNeighborhoodData(rebalancedGlobalOverlapScalarPointMap,
+                                                                      rebalancedGlobalNeighborhoodData);
+
+  preserveNeighborOrder = false;
+
+  dataManager->rebalance(ownedScalarPointMap,
+                         overlapScalarPointMap,
+                         ownedVectorPointMap,
+                         overlapVectorPointMap,
+                         ownedScalarBondMap);
+}
+
+PeridigmNS::Block PeridigmNS::Block::createCopy(Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarPointMap,
+                                                Teuchos::RCP<const Epetra_BlockMap> globalOverlapScalarPointMap,
+                                                Teuchos::RCP<const Epetra_BlockMap> globalOwnedVectorPointMap,
+                                                Teuchos::RCP<const Epetra_BlockMap> globalOverlapVectorPointMap,
+                                                Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarBondMap,
+                                                Teuchos::RCP<const Epetra_Vector> globalBlockIds,
+                                                Teuchos::RCP<const PeridigmNS::NeighborhoodData> globalNeighborhoodData,
+                                                Teuchos::RCP<const Epetra_Vector> globalOverlapCoordinates) const
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(dataManager.is_null(),
+                      "\n**** DataManager must be initialized via Block::initializeDataManager() prior to calling Block::createCopy()\n");
+
+  Block copy(*this);
+  copy.interiorPointSourceMap = Teuchos::RCP<const Epetra_BlockMap>();
+  if(pointOrdering != SpaceFillingCurve::NONE)
+    copy.pointOrderingCoordinates = globalOverlapCoordinates;
+  copy.preserveNeighborOrder = false;
+  copy.importPending = false;
+  copy.pendingImportTargets.clear();
+
+  copy.BlockBase::initialize(globalOwnedScalarPointMap,
+                             globalOverlapScalarPointMap,
+                             globalOwnedVectorPointMap,
+                             globalOverlapVectorPointMap,
+                             globalOwnedScalarBondMap,
+                             globalBlockIds,
+                             globalNeighborhoodData);
+
+  copy.initializeDataManager(dataManager->getFieldIds(),
+                             dataManager->getSinglePrecisionFieldIds(),
+                             dataManager->getBitPackedFieldIds());
+
+  return copy;
 }
 
 void PeridigmNS::Block::initializeMaterialModel(double timeStep)
@@ -79,6 +79,41 @@ namespace PeridigmNS {
                     Teuchos::RCP<const Epetra_Vector> globalBlockIds,
                     Teuchos::RCP<const PeridigmNS::NeighborhoodData> globalNeighborhoodData);
 
+    /*! \brief Rebalance the block based on rebalanced global maps and neighborhood information.
+     *
+     *  The neighborhood data, maps, and DataManager are migrated to the new partitioning.  Ghost data for the block
+     *  will continue to be imported from vectors defined on importSourceMap.  If a point ordering is in use, the
+     *  model coordinates must be provided on the rebalanced global overlap map.  When preserveNeighborOrder is true,
+     *  the neighbor list of each point keeps the order given in the global neighborhood data, which must then match
+     *  the order of the bond data currently held by the block.
+     */
+    void rebalance(Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarPointMap,
+                   Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOverlapScalarPointMap,
+                   Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedVectorPointMap,
+                   Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOverlapVectorPointMap,
+                   Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarBondMap,
+                   Teuchos::RCP<const Epetra_Vector> rebalancedGlobalBlockIds,
+                   Teuchos::RCP<const PeridigmNS::NeighborhoodData> rebalancedGlobalNeighborhoodData,
+                   Teuchos::RCP<const Epetra_BlockMap> importSourceMap,
+                   Teuchos::RCP<const Epetra_Vector> rebalancedGlobalOverlapCoordinates,
+                   bool preserveNeighborOrder);
+
+    /*! \brief Creates a copy of the block in the decomposition defined by the given global maps and neighborhood information.
+     *
+     *  The copy shares the material and damage models and has its own DataManager holding the same fields in the same
+     *  storage formats; no data is copied.  If a point ordering is in use, the model coordinates must be provided on the
+     *  given global overlap map.  The neighbor lists are created as in initialize(), so a copy in the initial decomposition
+     *  holds its bond data in the same order as a block that was rebalanced from it.
+     */
+    Block createCopy(Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarPointMap,
+                     Teuchos::RCP<const Epetra_BlockMap> globalOverlapScalarPointMap,
+                     Teuchos::RCP<const Epetra_BlockMap> globalOwnedVectorPointMap,
+                     Teuchos::RCP<const Epetra_BlockMap> globalOverlapVectorPointMap,
+                     Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarBondMap,
+                     Teuchos::RCP<const Epetra_Vector> globalBlockIds,
+                     Teuchos::RCP<const PeridigmNS::NeighborhoodData> globalNeighborhoodData,
+                     Teuchos::RCP<const Epetra_Vector> globalOverlapCoordinates) const;
+
     //! Get the material model
     Teuchos::RCP<const PeridigmNS::Material> getMaterialModel(){
       return materialModel;
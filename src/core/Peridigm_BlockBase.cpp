@@ -49,11 +49,22 @@
 #include "Peridigm_Field.hpp"
 #include <vector>
 #include <set>
+#include <algorithm>
 
 using namespace std;
 
+namespace {
+  //! Predicate identifying the global IDs of interior points.
+  struct InteriorPointPredicate {
+    InteriorPointPredicate(const set<int>& interiorIDs_) : interiorIDs(interiorIDs_) {}
+    bool operator()(int globalID) const { return interiorIDs.count(globalID) != 0; }
+    const set<int>& interiorIDs;
+  };
+}
+
 PeridigmNS::BlockBase::BlockBase(std::string blockName_, int blockID_, Teuchos::ParameterList& blockParams_)
-  : blockName(blockName_), blockID(blockID_), blockParams(blockParams_)
+  : blockName(blockName_), blockID(blockID_), pointOrdering(SpaceFillingCurve::NONE), preserveNeighborOrder(false),
+    interiorPointsFirst(false), interiorPointCount(0), subcycleRatio(1), importPending(false), blockParams(blockParams_)
 {}
 
 void PeridigmNS::BlockBase::initialize(Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarPointMap,
@@ -116,6 +127,102 @@ void PeridigmNS::BlockBase::exportData(Teuchos::RCP<Epetra_Vector> target, int f
   }
 }
 
+void PeridigmNS::BlockBase::beginImportData(const vector< Teuchos::RCP<const Epetra_Vector> >& sources, const vector<int>& fieldIds, PeridigmField::Step step)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(sources.size() != fieldIds.size(),
+                              "\n**** Error in BlockBase::beginImportData(), the number of sources does not match the number of field ids.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(importPending || !pendingImportTargets.empty(),
+                              "\n**** Error in BlockBase::beginImportData(), the previous import has not been finished.\n");
+
+  vector< Teuchos::RCP<const Epetra_Vector> > pendingImportSources;
+  for(unsigned int i=0 ; i<sources.size() ; ++i){
+    if(dataManager->hasData(fieldIds[i], step) && !sources[i].is_null()){
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(sources[i]->Map().ElementSize() != 3,
+                                  "\n**** Error in BlockBase::beginImportData(), only vector data is supported.\n");
+      pendingImportSources.push_back(sources[i]);
+      pendingImportTargets.push_back(dataManager->getData(fieldIds[i], step));
+    }
+  }
+  if(pendingImportSources.empty())
+    return;
+
+  if(threeDimensionalImporter.is_null())
+    threeDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapVectorPointMap(), pendingImportSources[0]->Map()));
+  const Epetra_Import& importer = *threeDimensionalImporter;
+  const int numFields = static_cast<int>(pendingImportSources.size());
+
+  // Copy the entries that are available on-processor
+  const int numSameIDs = importer.NumSameIDs();
+  const int numPermuteIDs = importer.NumPermuteIDs();
+  const int* permuteFromLIDs = importer.PermuteFromLIDs();
+  const int* permuteToLIDs = importer.PermuteToLIDs();
+  for(int iField=0 ; iField<numFields ; ++iField){
+    double *source, *target;
+    pendingImportSources[iField]->ExtractView(&source);
+    pendingImportTargets[iField]->ExtractView(&target);
+    if(source != target)
+      std::copy(source, source + 3*numSameIDs, target);
+    for(int i=0 ; i<numPermuteIDs ; ++i){
+      for(int dof=0 ; dof<3 ; ++dof)
+        target[3*permuteToLIDs[i]+dof] = source[3*permuteFromLIDs[i]+dof];
+    }
+  }
+
+  // On a single processor every entry is available locally
+  if(pendingImportSources[0]->Map().Comm().NumProc() == 1)
+    return;
+
+  // Pack the data requested by other processors, all fields for a given point are sent together
+  const int numExportIDs = importer.NumExportIDs();
+  const int* exportLIDs = importer.ExportLIDs();
+  importSendBuffer.resize(3*numFields*numExportIDs);
+  for(int iField=0 ; iField<numFields ; ++iField){
+    double* source;
+    pendingImportSources[iField]->ExtractView(&source);
+    for(int i=0 ; i<numExportIDs ; ++i){
+      for(int dof=0 ; dof<3 ; ++dof)
+        importSendBuffer[3*(i*numFields+iField)+dof] = source[3*exportLIDs[i]+dof];
+    }
+  }
+
+  // Post the sends and receives; the receive buffer is sized exactly so the distributor does not reallocate it
+  importReceiveBuffer.resize(3*numFields*importer.NumRemoteIDs());
+  char* exports = importSendBuffer.empty() ? 0 : reinterpret_cast<char*>(&importSendBuffer[0]);
+  char* imports = importReceiveBuffer.empty() ? 0 : reinterpret_cast<char*>(&importReceiveBuffer[0]);
+  char* const importsBegin = imports;
+  int objectSize = 3*numFields*static_cast<int>(sizeof(double));
+  int lengthImports = static_cast<int>(importReceiveBuffer.size()*sizeof(double));
+  int returnCode = importer.Distributor().DoPosts(exports, objectSize, lengthImports, imports);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(returnCode != 0 || imports != importsBegin,
+                              "\n**** Error in BlockBase::beginImportData(), failed to post communication.\n");
+  importPending = true;
+}
+
+void PeridigmNS::BlockBase::finishImportData()
+{
+  if(importPending){
+    const Epetra_Import& importer = *threeDimensionalImporter;
+    int returnCode = importer.Distributor().DoWaits();
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(returnCode != 0,
+                                "\n**** Error in BlockBase::finishImportData(), failed to complete communication.\n");
+
+    // Unpack the off-processor entries
+    const int numFields = static_cast<int>(pendingImportTargets.size());
+    const int numRemoteIDs = importer.NumRemoteIDs();
+    const int* remoteLIDs = importer.RemoteLIDs();
+    for(int iField=0 ; iField<numFields ; ++iField){
+      double* target;
+      pendingImportTargets[iField]->ExtractView(&target);
+      for(int i=0 ; i<numRemoteIDs ; ++i){
+        for(int dof=0 ; dof<3 ; ++dof)
+          target[3*remoteLIDs[i]+dof] = importReceiveBuffer[3*(i*numFields+iField)+dof];
+      }
+    }
+    importPending = false;
+  }
+  pendingImportTargets.clear();
+}
+
 void PeridigmNS::BlockBase::createMapsFromGlobalMaps(Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarPointMap,
                                                      Teuchos::RCP<const Epetra_BlockMap> globalOverlapScalarPointMap,
                                                      Teuchos::RCP<const Epetra_BlockMap> globalOwnedVectorPointMap,
@@ -143,16 +250,44 @@ void PeridigmNS::BlockBase::createMapsFromGlobalMaps(Teuchos::RCP<const Epetra_B
     }
   }
 
+  // Optionally order the owned points along a space-filling curve for improved cache locality
+  if(pointOrdering != SpaceFillingCurve::NONE)
+    orderGlobalIds(IDs, globalOverlapScalarPointMap);
+
+  // Optionally move the points whose neighbors are all on-processor to the front of the list,
+  // these can be evaluated while ghost data is in transit
+  interiorPointCount = 0;
+  if(interiorPointsFirst){
+    Teuchos::RCP<const Epetra_BlockMap> sourceMap = interiorPointSourceMap.is_null() ? globalOwnedScalarPointMap : interiorPointSourceMap;
+    set<int> interiorIDs;
+    int* const neighborhoodList = globalNeighborhoodData->NeighborhoodList();
+    int neighborhoodListIndex = 0;
+    for(int iLID=0 ; iLID<globalNeighborhoodData->NumOwnedPoints() ; ++iLID){
+      int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+      if(globalBlockIdsPtr[iLID] == blockID) {
+        bool isInterior = sourceMap->MyGID( globalOwnedScalarPointMap->GID(iLID) );
+        for(int i=0 ; i<numNeighbors && isInterior ; ++i)
+          isInterior = sourceMap->MyGID( globalOverlapScalarPointMap->GID(neighborhoodList[neighborhoodListIndex + i]) );
+        if(isInterior)
+          interiorIDs.insert(globalOwnedScalarPointMap->GID(iLID));
+      }
+      neighborhoodListIndex += numNeighbors;
+    }
+    vector<int>::iterator boundaryBegin = stable_partition(IDs.begin(), IDs.end(), InteriorPointPredicate(interiorIDs));
+    interiorPointCount = static_cast<int>(boundaryBegin - IDs.begin());
+  }
+
   // Record the size of these elements in the bond map
   // Note that if an element has no bonds, it has no entry in the bondMap
   // So, the bond map and the scalar map can have a different number of entries (different local IDs)
+  // The bond map must follow the same ordering as the owned point map
 
-  for(int iLID=0 ; iLID<globalOwnedScalarBondMap->NumMyElements() ; ++iLID){
-    int globalID = globalOwnedScalarBondMap->GID(iLID);
-    int localID = globalOwnedScalarPointMap->LID(globalID);
-    if(globalBlockIdsPtr[localID] == blockID){
+  for(unsigned int i=0 ; i<IDs.size() ; ++i){
+    int globalID = IDs[i];
+    int bondLID = globalOwnedScalarBondMap->LID(globalID);
+    if(bondLID != -1){
       bondIDs.push_back(globalID);
-      bondElementSize.push_back(globalOwnedScalarBondMap->ElementSize(iLID));
+      bondElementSize.push_back(globalOwnedScalarBondMap->ElementSize(bondLID));
     }
   }
 
@@ -206,10 +341,14 @@ void PeridigmNS::BlockBase::createMapsFromGlobalMaps(Teuchos::RCP<const Epetra_B
   // Copy IDs, this is the owned global ID list
   vector<int> ownedIDs(IDs.begin(), IDs.end());
 
+  // Optionally order the ghosts along a space-filling curve; ghosts are always placed after the owned points
+  vector<int> ghostIDs(ghosts.begin(), ghosts.end());
+  if(pointOrdering != SpaceFillingCurve::NONE)
+    orderGlobalIds(ghostIDs, globalOverlapScalarPointMap);
+
   // Append ghosts to IDs
   // This creates the overlap global ID list
-  for(set<int>::iterator it=ghosts.begin() ; it!=ghosts.end() ; ++it)
-    IDs.push_back(*it);
+  IDs.insert(IDs.end(), ghostIDs.begin(), ghostIDs.end());
 
   // Create the overlap scalar point map and the overlap vector point map
 
@@ -258,6 +397,9 @@ Teuchos::RCP<PeridigmNS::NeighborhoodData> PeridigmNS::BlockBase::createNeighbor
       int globalNeighborID = globalOverlapScalarPointMap->GID(globalNeighborhoodList[globalNeighborhoodListIndex++]);
       neighborhoodList.push_back( overlapScalarPointMap->LID(globalNeighborID) );
     }
+    // When the points have been reordered for locality, visit the neighbors in memory order
+    if(pointOrdering != SpaceFillingCurve::NONE && !preserveNeighborOrder)
+      sort(neighborhoodList.end() - numNeighbors, neighborhoodList.end());
   }
 
   // create the NeighborhoodData for this block
@@ -284,7 +426,40 @@ Teuchos::RCP<PeridigmNS::NeighborhoodData> PeridigmNS::BlockBase::createNeighbor
   return blockNeighborhoodData;
 }
 
-void PeridigmNS::BlockBase::initializeDataManager(vector<int> fieldIds)
+void PeridigmNS::BlockBase::orderGlobalIds(std::vector<int>& globalIds,
+                                           Teuchos::RCP<const Epetra_BlockMap> globalOverlapScalarPointMap) const
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(pointOrderingCoordinates.is_null(),
+                              "\n**** Coordinates must be provided via BlockBase::setPointOrdering() when a point ordering is requested.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(pointOrderingCoordinates->Map().NumMyElements() != globalOverlapScalarPointMap->NumMyElements(),
+                              "\n**** Error in BlockBase::orderGlobalIds(), coordinates are not defined on the global overlap map.\n");
+
+  int numPoints = static_cast<int>(globalIds.size());
+  if(numPoints < 2)
+    return;
+
+  double* coordinatesPtr;
+  pointOrderingCoordinates->ExtractView(&coordinatesPtr);
+
+  vector<double> coordinates(3*numPoints);
+  for(int i=0 ; i<numPoints ; ++i){
+    int overlapLID = globalOverlapScalarPointMap->LID(globalIds[i]);
+    for(int dof=0 ; dof<3 ; ++dof)
+      coordinates[3*i+dof] = coordinatesPtr[3*overlapLID+dof];
+  }
+
+  vector<int> order;
+  SpaceFillingCurve::computeOrder(pointOrdering, &coordinates[0], numPoints, order);
+
+  vector<int> orderedIds(numPoints);
+  for(int i=0 ; i<numPoints ; ++i)
+    orderedIds[i] = globalIds[order[i]];
+  globalIds.swap(orderedIds);
+}
+
+void PeridigmNS::BlockBase::initializeDataManager(vector<int> fieldIds,
+                                                  vector<int> singlePrecisionFieldIds,
+                                                  vector<int> bitPackedFieldIds)
 {
   // The material model must be set prior to initializing the data manager.
   // Note that not all the maps are strictly required, so these conditions could be relaxed somewhat.
@@ -309,6 +484,8 @@ void PeridigmNS::BlockBase::initializeDataManager(vector<int> fieldIds)
   fieldIds.erase(newEnd, fieldIds.end());
 
   // Allocate data in the data manager
+  dataManager->setSinglePrecisionFieldIds(singlePrecisionFieldIds);
+  dataManager->setBitPackedFieldIds(bitPackedFieldIds);
   dataManager->allocateData(fieldIds);
 }
 
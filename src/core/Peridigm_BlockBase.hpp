@@ -60,6 +60,7 @@
 
 #include "Peridigm_NeighborhoodData.hpp"
 #include "Peridigm_DataManager.hpp"
+#include "Peridigm_SpaceFillingCurve.hpp"
 
 namespace PeridigmNS {
 
@@ -67,7 +68,8 @@ namespace PeridigmNS {
   public:
 
     //! Constructor
-    BlockBase() : blockName("Undefined"), blockID(-1) {}
+    BlockBase() : blockName("Undefined"), blockID(-1), pointOrdering(SpaceFillingCurve::NONE), preserveNeighborOrder(false),
+                  interiorPointsFirst(false), interiorPointCount(0), subcycleRatio(1), importPending(false) {}
 
     //! Constructor
     BlockBase(std::string blockName_, int blockID_, Teuchos::ParameterList& blockParams_);
@@ -111,6 +113,41 @@ namespace PeridigmNS {
       auxiliaryFieldIds = fieldIds;
     }
 
+    /*! \brief Requests that the owned points and the ghosts be ordered along a space-filling curve.
+     *
+     *  Must be called prior to initialize().  The coordinates vector must be defined on the global
+     *  three-dimensional overlap map.  When an ordering is set, the neighbor list of each point is
+     *  also sorted by local ID.
+     */
+    void setPointOrdering(SpaceFillingCurve::Type ordering, Teuchos::RCP<const Epetra_Vector> globalOverlapCoordinates){
+      pointOrdering = ordering;
+      pointOrderingCoordinates = globalOverlapCoordinates;
+    }
+
+    /*! \brief Requests that owned points with no off-processor neighbors be placed ahead of all other owned points.
+     *
+     *  Must be called prior to initialize().  The interior points can be evaluated before ghost data
+     *  has arrived, see numInteriorPoints() and beginImportData().
+     */
+    void setInteriorPointsFirst(bool interiorFirst){
+      interiorPointsFirst = interiorFirst;
+    }
+
+    //! Get the number of leading owned points whose neighbors are all on-processor (zero unless requested via setInteriorPointsFirst()).
+    int numInteriorPoints() const {
+      return interiorPointCount;
+    }
+
+    //! Sets the number of global time steps between evaluations of the block in multi-rate explicit time integration.
+    void setSubcycleRatio(int ratio){
+      subcycleRatio = ratio;
+    }
+
+    //! Get the number of global time steps between evaluations of the block.
+    int getSubcycleRatio() const {
+      return subcycleRatio;
+    }
+
     //! Get the DataManager.
     Teuchos::RCP<PeridigmNS::DataManager> getDataManager(){
       return dataManager;
@@ -142,6 +179,32 @@ namespace PeridigmNS {
       return dataManager->getData(fieldId, step);
     }
 
+    //! Returns true if the given bond field is stored in single precision.
+    bool isSinglePrecision(int fieldId) const {
+      return !dataManager.is_null() && dataManager->isSinglePrecision(fieldId);
+    }
+
+    //! Method for accessing single-precision bond data from the DataManager.
+    float* getSinglePrecisionData(int fieldId, PeridigmField::Step step){
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(
+        dataManager.is_null(),
+        "\n**** DataManager must be initialized via BlockBase::initializeDataManager() prior to calling BlockBase::getSinglePrecisionData()\n");
+      return dataManager->getSinglePrecisionData(fieldId, step);
+    }
+
+    //! Returns true if the given bond field is stored as one bit per bond.
+    bool isBitPacked(int fieldId) const {
+      return !dataManager.is_null() && dataManager->isBitPacked(fieldId);
+    }
+
+    //! Method for accessing bit-packed bond data from the DataManager.
+    std::uint32_t* getBitPackedData(int fieldId, PeridigmField::Step step){
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(
+        dataManager.is_null(),
+        "\n**** DataManager must be initialized via BlockBase::initializeDataManager() prior to calling BlockBase::getBitPackedData()\n");
+      return dataManager->getBitPackedData(fieldId, step);
+    }
+
     //! Method for querying the DataManager for the presence of a field spec.
     bool hasData(int fieldId, PeridigmField::Step step) const {
       TEUCHOS_TEST_FOR_EXCEPT_MSG(
@@ -166,6 +229,18 @@ namespace PeridigmNS {
      */
     void exportData(Teuchos::RCP<Epetra_Vector> target, int fieldId, PeridigmField::Step step, Epetra_CombineMode combineMode);
 
+    /*! \brief Start a non-blocking import of vector data from the given source vectors.
+     *
+     *  Behaves as importData() with Insert for each source and field spec, except that only the entries
+     *  available on-processor are copied before returning.  Off-processor entries are posted for communication
+     *  and are not valid until finishImportData() has been called.  All processors must begin and finish
+     *  the import for every block, in the same order.
+     */
+    void beginImportData(const std::vector< Teuchos::RCP<const Epetra_Vector> >& sources, const std::vector<int>& fieldIds, PeridigmField::Step step);
+
+    //! Complete an import started with beginImportData().
+    void finishImportData();
+
     //! Swaps STATE_N and STATE_NP1.
     void updateState(){ dataManager->updateState(); };
 
@@ -198,13 +273,42 @@ namespace PeridigmNS {
     /*! \brief Initialize the data manager.
      *
      *  The DataManager will include all the field specs requested by the material model and
-     *  the contact model, as well as those provided by setAuxiliaryFieldIds().
+     *  the contact model, as well as those provided by setAuxiliaryFieldIds().  Bond fields listed in
+     *  singlePrecisionFieldIds are stored in single precision, bond fields listed in bitPackedFieldIds
+     *  are stored as one bit per bond.
      */
-    void initializeDataManager(std::vector<int> fieldIds);
+    void initializeDataManager(std::vector<int> fieldIds,
+                               std::vector<int> singlePrecisionFieldIds = std::vector<int>(),
+                               std::vector<int> bitPackedFieldIds = std::vector<int>());
+
+    //! Reorders a list of global IDs along the space-filling curve given by pointOrdering.
+    void orderGlobalIds(std::vector<int>& globalIds,
+                        Teuchos::RCP<const Epetra_BlockMap> globalOverlapScalarPointMap) const;
 
     std::string blockName;
     int blockID;
 
+    //! Ordering applied to the owned points and to the ghosts when the maps are created.
+    SpaceFillingCurve::Type pointOrdering;
+
+    //! Model coordinates on the global overlap map, used to compute the point ordering.
+    Teuchos::RCP<const Epetra_Vector> pointOrderingCoordinates;
+
+    //! Flag indicating that neighbor lists keep the order of the global neighborhood data, required when bond data is migrated.
+    bool preserveNeighborOrder;
+
+    //! Flag indicating that interior points are placed ahead of the other owned points.
+    bool interiorPointsFirst;
+
+    //! Number of leading owned points with no off-processor neighbors.
+    int interiorPointCount;
+
+    //! Number of global time steps between evaluations of the block.
+    int subcycleRatio;
+
+    //! Map of the vectors from which ghost data is imported, defaults to the global owned map when null.
+    Teuchos::RCP<const Epetra_BlockMap> interiorPointSourceMap;
+
     //! @name Maps
     //@{
     //! One-dimensional map for owned points.
@@ -225,6 +329,18 @@ namespace PeridigmNS {
     //! One-dimensional Importer from global to overlapped vectors
     Teuchos::RCP<const Epetra_Import> threeDimensionalImporter;
 
+    //! @name Data for imports posted with beginImportData()
+    //@{
+    //! Flag indicating that off-processor data has been posted and not yet received.
+    bool importPending;
+    //! Target vectors of the pending import.
+    std::vector< Teuchos::RCP<Epetra_Vector> > pendingImportTargets;
+    //! Packed data sent to other processors.
+    std::vector<double> importSendBuffer;
+    //! Packed data received from other processors, ordered as the importer's remote IDs.
+    std::vector<double> importReceiveBuffer;
+    //@}
+
     //! The neighborhood data
     Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData;
 
@@ -49,9 +49,10 @@
 #include "Peridigm_HorizonManager.hpp"
 #include "Peridigm_Field.hpp"
 #include "Peridigm_Constants.hpp"
+#include "Peridigm_BitPackedBondData.hpp"
 #include <cmath>
 
-double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block){
+double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block, bool accountForBondDamage){
 
   Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = block.getNeighborhoodData();
   const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
@@ -74,6 +75,19 @@ double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::
   block.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
   block.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE)->ExtractView(&x);
 
+  double *bondDamage(0);
+  float *singlePrecisionBondDamage(0);
+  std::uint32_t *bitPackedBondDamage(0);
+  if(accountForBondDamage && fieldManager.hasField("Bond_Damage")){
+    int bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+    if(block.isBitPacked(bondDamageFieldId))
+      bitPackedBondDamage = block.getBitPackedData(bondDamageFieldId, PeridigmField::STEP_NP1);
+    else if(block.isSinglePrecision(bondDamageFieldId))
+      singlePrecisionBondDamage = block.getSinglePrecisionData(bondDamageFieldId, PeridigmField::STEP_NP1);
+    else if(block.hasData(bondDamageFieldId, PeridigmField::STEP_NP1))
+      block.getData(bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+  }
+
   const double pi = value_of_pi();
   double springConstant(0.0);
   if(blockHasConstantHorizon)
@@ -82,6 +96,7 @@ double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::
   double minCriticalTimeStep = 1.0e50;
 
   int neighborhoodListIndex = 0;
+  int bondIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
 
     double timestepDenominator = 0.0;
@@ -109,11 +124,20 @@ double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::
         warningGiven = true;
       }
 
-      timestepDenominator += neighborVolume*springConstant/initialDistance;
+      double bondStrength = 1.0;
+      if(bondDamage != 0)
+        bondStrength -= bondDamage[bondIndex];
+      else if(singlePrecisionBondDamage != 0)
+        bondStrength -= singlePrecisionBondDamage[bondIndex];
+      else if(bitPackedBondDamage != 0)
+        bondStrength -= getBondValue(bitPackedBondDamage, bondIndex);
+      bondIndex++;
+
+      timestepDenominator += bondStrength*neighborVolume*springConstant/initialDistance;
     }
 
     double criticalTimeStep = 1.0e50;
-    if(numNeighbors > 0)
+    if(numNeighbors > 0 && timestepDenominator > 0.0)
       criticalTimeStep = sqrt(2.0*density/timestepDenominator);
     if(criticalTimeStep < minCriticalTimeStep)
       minCriticalTimeStep = criticalTimeStep;
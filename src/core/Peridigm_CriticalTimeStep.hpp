@@ -53,7 +53,12 @@
 
 namespace PeridigmNS {
 
-double ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block);
+/*! \brief Estimates the stable time step for a block, reduced across all processors.
+ *
+ *  If accountForBondDamage is true and the block carries bond damage, each bond contributes to the
+ *  stiffness of a point in proportion to its remaining strength.
+ */
+double ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block, bool accountForBondDamage = false);
 
 }
 
@@ -243,7 +243,7 @@ void PeridigmNS::DataManager::allocateData(vector<int> fieldIds)
       stateNONE->allocatePointData(length, fieldIds, map);
     }
     if(statelessBondFieldIds.size() > 0){
-      stateNONE->allocateBondData(statelessBondFieldIds, ownedBondMap);
+      stateNONE->allocateBondData(statelessBondFieldIds, ownedBondMap, singlePrecisionFieldIds, bitPackedFieldIds);
     }
   }
   if(statefulPointFieldIds.size() + statefulBondFieldIds.size() > 0){
@@ -267,8 +267,8 @@ void PeridigmNS::DataManager::allocateData(vector<int> fieldIds)
       stateNP1->allocatePointData(length, fieldIds, map);
     }
     if(statefulBondFieldIds.size() > 0){
-      stateN->allocateBondData(statefulBondFieldIds, ownedBondMap);
-      stateNP1->allocateBondData(statefulBondFieldIds, ownedBondMap);
+      stateN->allocateBondData(statefulBondFieldIds, ownedBondMap, singlePrecisionFieldIds, bitPackedFieldIds);
+      stateNP1->allocateBondData(statefulBondFieldIds, ownedBondMap, singlePrecisionFieldIds, bitPackedFieldIds);
     }
   }
 }
@@ -441,9 +441,17 @@ void PeridigmNS::DataManager::rebalance(Teuchos::RCP<const Epetra_BlockMap> reba
 
       // Allocate bond data and import from the old State to the rebalanced State
       if(bondFieldIds->size() > 0){
-        rebalancedState->allocateBondData(*bondFieldIds, rebalancedOwnedBondMap);      
+        rebalancedState->allocateBondData(*bondFieldIds, rebalancedOwnedBondMap, singlePrecisionFieldIds, bitPackedFieldIds);
         Epetra_Import importer(*rebalancedOwnedBondMap, *ownedBondMap);
-        rebalancedState->getBondMultiVector()->Import(*state->getBondMultiVector(), importer, Insert);
+        if(!state->getBondMultiVector().is_null())
+          rebalancedState->getBondMultiVector()->Import(*state->getBondMultiVector(), importer, Insert);
+        // Single-precision and bit-packed bond data are routed through a temporary double-precision multivector
+        Teuchos::RCP<Epetra_MultiVector> compactData = state->getCompactBondMultiVectorCopy();
+        if(!compactData.is_null()){
+          Epetra_MultiVector rebalancedCompactData(*rebalancedOwnedBondMap, compactData->NumVectors());
+          rebalancedCompactData.Import(*compactData, importer, Insert);
+          rebalancedState->setCompactBondData(rebalancedCompactData);
+        }
       }
 
       // Set the State to the rebalanced State
@@ -464,6 +472,75 @@ void PeridigmNS::DataManager::rebalance(Teuchos::RCP<const Epetra_BlockMap> reba
   ownedBondMap = rebalancedOwnedBondMap;
 }
 
+void PeridigmNS::DataManager::importDataFromDataManager(PeridigmNS::DataManager& source)
+{
+  // As in rebalance(), the ghosted values must agree across processors prior to the import
+  source.scatterToGhosts();
+
+  // The importers depend only on the maps, which are replaced each time the source is rebalanced
+  if(source.overlapScalarPointMap.get() != importSourceOverlapScalarPointMap.get() || source.ownedBondMap.get() != importSourceBondMap.get()){
+    pointDataImporters.clear();
+    bondDataImporter = Teuchos::RCP<const Epetra_Import>();
+    importSourceOverlapScalarPointMap = source.overlapScalarPointMap;
+    importSourceBondMap = source.ownedBondMap;
+  }
+
+  map< PeridigmField::Length, vector<int> >::iterator it;
+
+  for(int iState=0 ; iState<3 ; ++iState){
+
+    Teuchos::RCP<State> state, sourceState;
+    std::map< PeridigmField::Length, vector<int> > *pointFieldIds(NULL);
+    vector<int> *bondFieldIds(NULL);
+    if(iState == 0){
+      state = stateNONE;
+      sourceState = source.stateNONE;
+      pointFieldIds = &statelessPointFieldIds;
+      bondFieldIds = &statelessBondFieldIds;
+    }
+    else if(iState == 1){
+      state = stateN;
+      sourceState = source.stateN;
+      pointFieldIds = &statefulPointFieldIds;
+      bondFieldIds = &statefulBondFieldIds;
+    }
+    else if(iState == 2){
+      state = stateNP1;
+      sourceState = source.stateNP1;
+      pointFieldIds = &statefulPointFieldIds;
+      bondFieldIds = &statefulBondFieldIds;
+    }
+
+    if(state.is_null())
+      continue;
+    TEUCHOS_TEST_FOR_EXCEPTION(sourceState.is_null(), Teuchos::NullReferenceError, "PeridigmNS::DataManager::importDataFromDataManager() called with incompatible source and target.\n");
+
+    for(it = pointFieldIds->begin() ; it != pointFieldIds->end() ; ++it){
+      PeridigmField::Length length = it->first;
+      Teuchos::RCP<Epetra_MultiVector> target = state->getPointMultiVector(length);
+      Teuchos::RCP<Epetra_MultiVector> sourceData = sourceState->getPointMultiVector(length);
+      Teuchos::RCP<const Epetra_Import>& importer = pointDataImporters[length];
+      if(importer.is_null())
+        importer = Teuchos::rcp(new Epetra_Import(target->Map(), sourceData->Map()));
+      target->Import(*sourceData, *importer, Insert);
+    }
+
+    if(bondFieldIds->size() > 0){
+      if(bondDataImporter.is_null())
+        bondDataImporter = Teuchos::rcp(new Epetra_Import(*ownedBondMap, *source.ownedBondMap));
+      if(!state->getBondMultiVector().is_null())
+        state->getBondMultiVector()->Import(*sourceState->getBondMultiVector(), *bondDataImporter, Insert);
+      // Single-precision and bit-packed bond data are routed through a temporary double-precision multivector
+      Teuchos::RCP<Epetra_MultiVector> compactData = sourceState->getCompactBondMultiVectorCopy();
+      if(!compactData.is_null()){
+        Epetra_MultiVector importedCompactData(*ownedBondMap, compactData->NumVectors());
+        importedCompactData.Import(*compactData, *bondDataImporter, Insert);
+        state->setCompactBondData(importedCompactData);
+      }
+    }
+  }
+}
+
 Teuchos::RCP<const Epetra_Comm> PeridigmNS::DataManager::getEpetraComm()
 {
   Teuchos::RCP<const Epetra_Comm> comm;
@@ -563,7 +640,12 @@ Teuchos::RCP<Epetra_Vector> PeridigmNS::DataManager::getData(int fieldId, Peridi
 
   if(data.is_null()){
     stringstream ss;
-    ss << "**** Error, PeridigmNS::DataManager::getData(), fieldId and Step not found!\n";
+    if(isSinglePrecision(fieldId))
+      ss << "**** Error, PeridigmNS::DataManager::getData(), field is stored in single precision, use getSinglePrecisionData()!\n";
+    else if(isBitPacked(fieldId))
+      ss << "**** Error, PeridigmNS::DataManager::getData(), field is bit packed, use getBitPackedData()!\n";
+    else
+      ss << "**** Error, PeridigmNS::DataManager::getData(), fieldId and Step not found!\n";
     ss << "**** Spec: " << fieldManager.getFieldSpec(fieldId) << "\n";
     ss << "**** Step: " << step << "\n";
     TEUCHOS_TEST_FOR_EXCEPTION(data.is_null(), Teuchos::RangeError, ss.str());
@@ -571,3 +653,45 @@ Teuchos::RCP<Epetra_Vector> PeridigmNS::DataManager::getData(int fieldId, Peridi
 
   return data;
 }
+
+float* PeridigmNS::DataManager::getSinglePrecisionData(int fieldId, PeridigmField::Step step)
+{
+  float* data(NULL);
+
+  if(step == PeridigmField::STEP_NONE){
+    data = stateNONE->getSinglePrecisionData(fieldId);
+  }
+  else if(step == PeridigmField::STEP_N){
+    data = stateN->getSinglePrecisionData(fieldId);
+  }
+  else if(step == PeridigmField::STEP_NP1){
+    data = stateNP1->getSinglePrecisionData(fieldId);
+  }
+  else{
+    TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::RangeError, 
+                               "PeridigmNS::DataManager::getSinglePrecisionData, invalid fieldId and step!");
+  }
+
+  return data;
+}
+
+std::uint32_t* PeridigmNS::DataManager::getBitPackedData(int fieldId, PeridigmField::Step step)
+{
+  std::uint32_t* data(NULL);
+
+  if(step == PeridigmField::STEP_NONE){
+    data = stateNONE->getBitPackedData(fieldId);
+  }
+  else if(step == PeridigmField::STEP_N){
+    data = stateN->getBitPackedData(fieldId);
+  }
+  else if(step == PeridigmField::STEP_NP1){
+    data = stateNP1->getBitPackedData(fieldId);
+  }
+  else{
+    TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::RangeError, 
+                               "PeridigmNS::DataManager::getBitPackedData, invalid fieldId and step!");
+  }
+
+  return data;
+}
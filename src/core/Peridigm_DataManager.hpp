@@ -49,6 +49,8 @@
 #define PERIDIGM_DATAMANAGER_HPP
 
 #include "Peridigm_State.hpp"
+#include <Epetra_Import.h>
+#include <algorithm>
 
 namespace PeridigmNS {
 
@@ -99,6 +101,24 @@ public:
     ownedBondMap = ownedBondMap_;
   }
 
+  //! Sets the bond field ids to be stored in single precision; must be called prior to allocating data.
+  void setSinglePrecisionFieldIds(std::vector<int> fieldIds) { singlePrecisionFieldIds = fieldIds; }
+
+  //! Sets the bond field ids to be stored as one bit per bond; must be called prior to allocating data.
+  void setBitPackedFieldIds(std::vector<int> fieldIds) { bitPackedFieldIds = fieldIds; }
+
+  //! Requests the same bond storage formats as the given data manager; must be called prior to allocating data.
+  void setStorageFormats(const DataManager& source){
+    singlePrecisionFieldIds = source.singlePrecisionFieldIds;
+    bitPackedFieldIds = source.bitPackedFieldIds;
+  }
+
+  //! Returns the bond field ids requested to be stored in single precision.
+  std::vector<int> getSinglePrecisionFieldIds() const { return singlePrecisionFieldIds; }
+
+  //! Returns the bond field ids requested to be stored as one bit per bond.
+  std::vector<int> getBitPackedFieldIds() const { return bitPackedFieldIds; }
+
   //! Instantiates State objects corresponding to the given list of field Ids. 
   void allocateData(std::vector<int> fieldIds);
 
@@ -139,6 +159,13 @@ public:
   //! Returns RCP to the State NONE object
   Teuchos::RCP<State> getStateNONE(){ return stateNONE; }
 
+  /*! \brief Imports all data from a data manager that holds the same fields in a different decomposition.
+   *
+   * The maps of this data manager are unchanged.  The importers are stored and reused until the maps
+   * of the source data manager change, so repeated calls between rebalances involve communication only.
+   */
+  void importDataFromDataManager(PeridigmNS::DataManager& source);
+
   /*! \brief Copies data from a different data manager based on global IDs.
    *
    * Functions only if all the local IDs in the target map exist in and are
@@ -152,6 +179,25 @@ public:
   //! Provides access to the Epetra_Vector specified by the given field Id and step.
   Teuchos::RCP<Epetra_Vector> getData(int fieldId, PeridigmField::Step step);
 
+  //! Returns true if the given bond field is stored in single precision.
+  bool isSinglePrecision(int fieldId){
+    return !isBitPacked(fieldId) &&
+      std::find(singlePrecisionFieldIds.begin(), singlePrecisionFieldIds.end(), fieldId) != singlePrecisionFieldIds.end() &&
+      std::find(allFieldIds.begin(), allFieldIds.end(), fieldId) != allFieldIds.end();
+  }
+
+  //! Returns true if the given bond field is stored as one bit per bond.
+  bool isBitPacked(int fieldId){
+    return std::find(bitPackedFieldIds.begin(), bitPackedFieldIds.end(), fieldId) != bitPackedFieldIds.end() &&
+      std::find(allFieldIds.begin(), allFieldIds.end(), fieldId) != allFieldIds.end();
+  }
+
+  //! Provides access to single-precision bond data specified by the given field Id and step.
+  float* getSinglePrecisionData(int fieldId, PeridigmField::Step step);
+
+  //! Provides access to bit-packed bond data specified by the given field Id and step.
+  std::uint32_t* getBitPackedData(int fieldId, PeridigmField::Step step);
+
   //! Returns the complete list of field ids.
   std::vector<int> getFieldIds() { return allFieldIds; }
 
@@ -206,6 +252,10 @@ protected:
   std::map< PeridigmField::Length, std::vector<int> > statefulPointFieldIds;
   //! Field specs for stateful bond data.
   std::vector<int> statefulBondFieldIds;
+  //! Bond field ids requested to be stored in single precision.
+  std::vector<int> singlePrecisionFieldIds;
+  //! Bond field ids requested to be stored as one bit per bond.
+  std::vector<int> bitPackedFieldIds;
   //@}
 
   //! @name Maps
@@ -226,6 +276,18 @@ protected:
   Teuchos::RCP<const Epetra_BlockMap> ownedBondMap;
   //@}
 
+  //! @name Importers used by importDataFromDataManager()
+  //@{
+  //! Overlap map of the source data manager for which the importers were created.
+  Teuchos::RCP<const Epetra_BlockMap> importSourceOverlapScalarPointMap;
+  //! Bond map of the source data manager for which the importers were created.
+  Teuchos::RCP<const Epetra_BlockMap> importSourceBondMap;
+  //! Importers for point data, one for each length.
+  std::map< PeridigmField::Length, Teuchos::RCP<const Epetra_Import> > pointDataImporters;
+  //! Importer for bond data.
+  Teuchos::RCP<const Epetra_Import> bondDataImporter;
+  //@}
+
   //! @name Global data
   //@{
   //! Map between field ids and data
@@ -65,12 +65,14 @@ namespace PeridigmInfluenceFunction {
 
 // Built-in influence functions should be implemented here
 // and associated with a string in InfluenceFunction::setInfluenceFunction(), below.
+// They are declared inline rather than static so that each has a single address
+// across translation units, which InfluenceFunction::getInfluenceFunctionType() relies on.
 
-static double one(double zeta, double horizon){
+inline double one(double zeta, double horizon){
   return 1.0;
 }
 
-static double parabolicDecay(double zeta, double horizon){
+inline double parabolicDecay(double zeta, double horizon){
   if(zeta > horizon)
     return 0.0;
 
@@ -79,13 +81,29 @@ static double parabolicDecay(double zeta, double horizon){
   return value;
 }
 
-static double gaussian(double zeta, double horizon)
+inline double gaussian(double zeta, double horizon)
 {
   double h2=horizon*horizon*0.4*0.4;
   double xi2=zeta*zeta;
   return exp(-xi2/h2);
 }
 
+// Function objects for the built-in influence functions.  Kernels templated on the
+// influence function are instantiated with these so that the weight is inlined in
+// the bond loop; a plain functionPointer is used for user-defined functions.
+
+struct One {
+  double operator()(double zeta, double horizon) const { return one(zeta, horizon); }
+};
+
+struct ParabolicDecay {
+  double operator()(double zeta, double horizon) const { return parabolicDecay(zeta, horizon); }
+};
+
+struct Gaussian {
+  double operator()(double zeta, double horizon) const { return gaussian(zeta, horizon); }
+};
+
 }
 
 class InfluenceFunction {
@@ -95,6 +113,42 @@ public:
   //! Type definition for the function pointer to an influence function
   typedef double (*functionPointer)(double, double);
 
+  //! Influence functions for which compile-time specializations of the material kernels exist.
+  enum Type { ONE, PARABOLIC_DECAY, GAUSSIAN, USER_DEFINED };
+
+  //! Identifies the built-in influence function behind a function pointer; anything else is USER_DEFINED.
+  static Type getInfluenceFunctionType(functionPointer influenceFunction) {
+    if(influenceFunction == &PeridigmInfluenceFunction::one)
+      return ONE;
+    if(influenceFunction == &PeridigmInfluenceFunction::parabolicDecay)
+      return PARABOLIC_DECAY;
+    if(influenceFunction == &PeridigmInfluenceFunction::gaussian)
+      return GAUSSIAN;
+    return USER_DEFINED;
+  }
+
+  /*! \brief Calls functor(f), where f is the function object for a built-in influence function or the function pointer itself otherwise.
+   *
+   *  Material kernels templated on the influence function are called from the functor, so that the
+   *  built-in influence functions are inlined in the bond loop.
+   */
+  template<typename FunctorT>
+  static void dispatch(functionPointer influenceFunction, FunctorT& functor) {
+    switch(getInfluenceFunctionType(influenceFunction)){
+    case ONE:
+      functor(PeridigmInfluenceFunction::One());
+      break;
+    case PARABOLIC_DECAY:
+      functor(PeridigmInfluenceFunction::ParabolicDecay());
+      break;
+    case GAUSSIAN:
+      functor(PeridigmInfluenceFunction::Gaussian());
+      break;
+    default:
+      functor(influenceFunction);
+    }
+  }
+
   //! Singleton.
   static InfluenceFunction & self();
 
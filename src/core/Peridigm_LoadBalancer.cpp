@@ -0,0 +1,436 @@
+/*! \file Peridigm_LoadBalancer.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_LoadBalancer.hpp"
+#include "Peridigm_Timer.hpp"
+#include <Epetra_Import.h>
+#include <Teuchos_Assert.hpp>
+#include <algorithm>
+#include <iostream>
+#include <set>
+#include "zoltan.h"
+
+using namespace std;
+
+namespace {
+
+  //! Data passed to the Zoltan query functions
+  struct PointData {
+    int numPoints;
+    const int* globalIds;
+    const double* coordinates;
+    const float* weights;
+  };
+
+  int getNumPoints(void *data, int *ierr)
+  {
+    *ierr = ZOLTAN_OK;
+    return static_cast<PointData*>(data)->numPoints;
+  }
+
+  void getPointIds(void *data, int numGids, int numLids, ZOLTAN_ID_PTR zoltanGlobalIds, ZOLTAN_ID_PTR zoltanLocalIds,
+                   int numWeights, float *objectWeights, int *ierr)
+  {
+    *ierr = ZOLTAN_OK;
+    PointData* pointData = static_cast<PointData*>(data);
+    for(int i=0 ; i<pointData->numPoints ; ++i){
+      zoltanGlobalIds[i] = pointData->globalIds[i];
+      zoltanLocalIds[i] = i;
+      objectWeights[i] = pointData->weights[i];
+    }
+  }
+
+  int getDimension(void *unused, int *ierr)
+  {
+    *ierr = ZOLTAN_OK;
+    return 3;
+  }
+
+  void getPointCoordinates(void *data, int numGids, int numLids, int numPoints, ZOLTAN_ID_PTR zoltanGlobalIds,
+                           ZOLTAN_ID_PTR zoltanLocalIds, int numDim, double *geometryVector, int *ierr)
+  {
+    *ierr = ZOLTAN_OK;
+    PointData* pointData = static_cast<PointData*>(data);
+    for(int i=0 ; i<numPoints ; ++i){
+      int localId = zoltanLocalIds[i];
+      for(int dof=0 ; dof<3 ; ++dof)
+        geometryVector[3*i+dof] = pointData->coordinates[3*localId+dof];
+    }
+  }
+
+  //! Creates a bond map from a list of points and their bond counts; points without bonds have no entry.
+  Teuchos::RCP<Epetra_BlockMap> createBondMap(const Epetra_BlockMap& pointMap, const Epetra_Vector& numberOfBonds)
+  {
+    vector<int> myGlobalElements;
+    vector<int> elementSizeList;
+    myGlobalElements.reserve(pointMap.NumMyElements());
+    elementSizeList.reserve(pointMap.NumMyElements());
+    for(int i=0 ; i<pointMap.NumMyElements() ; ++i){
+      int numBonds = static_cast<int>(numberOfBonds[i]);
+      if(numBonds > 0){
+        myGlobalElements.push_back(pointMap.GID(i));
+        elementSizeList.push_back(numBonds);
+      }
+    }
+    int numGlobalElements = -1;
+    int numMyElements = static_cast<int>(myGlobalElements.size());
+    int indexBase = 0;
+    return Teuchos::rcp(new Epetra_BlockMap(numGlobalElements,
+                                            numMyElements,
+                                            numMyElements > 0 ? &myGlobalElements[0] : 0,
+                                            numMyElements > 0 ? &elementSizeList[0] : 0,
+                                            indexBase,
+                                            pointMap.Comm()));
+  }
+
+}
+
+PeridigmNS::LoadBalancer::LoadBalancer(const Teuchos::ParameterList& params,
+                                       Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarPointMap,
+                                       Teuchos::RCP<const Epetra_BlockMap> globalOverlapScalarPointMap,
+                                       Teuchos::RCP<const Epetra_BlockMap> globalOwnedVectorPointMap,
+                                       Teuchos::RCP<const Epetra_BlockMap> globalOverlapVectorPointMap,
+                                       Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarBondMap,
+                                       Teuchos::RCP<const Epetra_Vector> globalBlockIds,
+                                       Teuchos::RCP<const PeridigmNS::NeighborhoodData> globalNeighborhoodData,
+                                       Teuchos::RCP<const Epetra_Vector> modelCoordinates_)
+  : checkFrequency(100), imbalanceTolerance(1.1), verbose(false), previousInternalForceTime(0.0), measuredInternalForceTime(0.0),
+    rebalanced(false), rebalanceCount(0),
+    initialOwnedScalarPointMap(globalOwnedScalarPointMap), initialOverlapScalarPointMap(globalOverlapScalarPointMap),
+    initialOwnedVectorPointMap(globalOwnedVectorPointMap), initialOverlapVectorPointMap(globalOverlapVectorPointMap),
+    initialOwnedScalarBondMap(globalOwnedScalarBondMap), initialBlockIds(globalBlockIds),
+    initialNeighborhoodData(globalNeighborhoodData), modelCoordinates(modelCoordinates_)
+{
+  if(params.isParameter("Check Frequency"))
+    checkFrequency = params.get<int>("Check Frequency");
+  if(params.isParameter("Imbalance Tolerance"))
+    imbalanceTolerance = params.get<double>("Imbalance Tolerance");
+  if(params.isParameter("Verbose"))
+    verbose = params.get<bool>("Verbose");
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(checkFrequency < 1, "**** Error:  Load Balancing \"Check Frequency\" must be a positive integer.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(imbalanceTolerance < 1.0, "**** Error:  Load Balancing \"Imbalance Tolerance\" must be greater than or equal to 1.0.\n");
+}
+
+bool PeridigmNS::LoadBalancer::rebalanceRequired(int step)
+{
+  if(step%checkFrequency != 0)
+    return false;
+
+  double internalForceTime = PeridigmNS::Timer::self().elapsedTime("Internal Force");
+  measuredInternalForceTime = internalForceTime - previousInternalForceTime;
+  previousInternalForceTime = internalForceTime;
+
+  const Epetra_Comm& comm = initialOwnedScalarPointMap->Comm();
+  if(comm.NumProc() == 1)
+    return false;
+
+  double maxTime(0.0), sumTime(0.0);
+  comm.MaxAll(&measuredInternalForceTime, &maxTime, 1);
+  comm.SumAll(&measuredInternalForceTime, &sumTime, 1);
+  double averageTime = sumTime/comm.NumProc();
+  if(averageTime <= 0.0)
+    return false;
+
+  double imbalance = maxTime/averageTime;
+  if(verbose && comm.MyPID() == 0)
+    cout << "Load balancer: step " << step << ", internal force imbalance " << imbalance << " (tolerance " << imbalanceTolerance << ")" << endl;
+
+  return imbalance > imbalanceTolerance;
+}
+
+void PeridigmNS::LoadBalancer::rebalance(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks)
+{
+  const Epetra_Comm& comm = initialOwnedScalarPointMap->Comm();
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+
+  // Gather the owned points of all blocks in the current decomposition, along with their neighbor lists
+  // The neighbors are recorded in the order of the bond data held by the blocks
+  vector<int> currentGlobalIds;
+  vector<double> currentBlockIds;
+  vector<double> currentNumNeighbors;
+  vector<double> currentNeighborGlobalIds;
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    Teuchos::RCP<const Epetra_BlockMap> overlapMap = blockIt->getOverlapScalarPointMap();
+    Teuchos::RCP<const PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
+    const int* ownedIds = neighborhoodData->OwnedIDs();
+    const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+    int neighborhoodListIndex = 0;
+    for(int i=0 ; i<neighborhoodData->NumOwnedPoints() ; ++i){
+      int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+      currentGlobalIds.push_back(overlapMap->GID(ownedIds[i]));
+      currentBlockIds.push_back(static_cast<double>(blockIt->getID()));
+      currentNumNeighbors.push_back(static_cast<double>(numNeighbors));
+      for(int j=0 ; j<numNeighbors ; ++j)
+        currentNeighborGlobalIds.push_back(static_cast<double>(overlapMap->GID(neighborhoodList[neighborhoodListIndex++])));
+    }
+  }
+
+  int numCurrentPoints = static_cast<int>(currentGlobalIds.size());
+  int numGlobalElements = -1;
+  int indexBase = 0;
+  Epetra_BlockMap currentOwnedScalarPointMap(numGlobalElements, numCurrentPoints, numCurrentPoints > 0 ? &currentGlobalIds[0] : 0, 1, indexBase, comm);
+  Epetra_BlockMap currentOwnedVectorPointMap(numGlobalElements, numCurrentPoints, numCurrentPoints > 0 ? &currentGlobalIds[0] : 0, 3, indexBase, comm);
+  Epetra_Vector numberOfBonds(View, currentOwnedScalarPointMap, numCurrentPoints > 0 ? &currentNumNeighbors[0] : 0);
+  Epetra_Vector blockIds(View, currentOwnedScalarPointMap, numCurrentPoints > 0 ? &currentBlockIds[0] : 0);
+  Teuchos::RCP<Epetra_BlockMap> currentOwnedScalarBondMap = createBondMap(currentOwnedScalarPointMap, numberOfBonds);
+  Epetra_Vector neighborGlobalIds(View, *currentOwnedScalarBondMap, currentNeighborGlobalIds.size() > 0 ? &currentNeighborGlobalIds[0] : 0);
+
+  // Model coordinates in the current decomposition
+  Epetra_Vector coordinates(currentOwnedVectorPointMap);
+  Epetra_Import coordinatesImporter(currentOwnedVectorPointMap, *initialOwnedVectorPointMap);
+  coordinates.Import(*modelCoordinates, coordinatesImporter, Insert);
+
+  // The weight of each point is its number of bonds scaled by the cost per bond measured on this processor
+  int numBonds = static_cast<int>(currentNeighborGlobalIds.size());
+  double costPerBond = 1.0;
+  if(measuredInternalForceTime > 0.0)
+    costPerBond = measuredInternalForceTime/(numBonds + numCurrentPoints);
+  vector<float> weights(numCurrentPoints);
+  for(int i=0 ; i<numCurrentPoints ; ++i)
+    weights[i] = static_cast<float>(costPerBond*(currentNumNeighbors[i] + 1.0));
+
+  // Partition with weighted recursive coordinate bisection
+  PointData pointData;
+  pointData.numPoints = numCurrentPoints;
+  pointData.globalIds = numCurrentPoints > 0 ? &currentGlobalIds[0] : 0;
+  pointData.coordinates = numCurrentPoints > 0 ? &coordinates[0] : 0;
+  pointData.weights = numCurrentPoints > 0 ? &weights[0] : 0;
+
+  float version(0.0);
+  int zoltanErr = Zoltan_Initialize(0, 0, &version);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(zoltanErr != ZOLTAN_OK, "**** Error:  Zoltan_Initialize() failed in LoadBalancer::rebalance().\n");
+
+  struct Zoltan_Struct* zoltan = Zoltan_Create(MPI_COMM_WORLD);
+  Zoltan_Set_Param(zoltan, "DEBUG_LEVEL", "0");
+  Zoltan_Set_Param(zoltan, "LB_METHOD", "RCB");
+  Zoltan_Set_Param(zoltan, "NUM_GID_ENTRIES", "1");
+  Zoltan_Set_Param(zoltan, "NUM_LID_ENTRIES", "1");
+  Zoltan_Set_Param(zoltan, "OBJ_WEIGHT_DIM", "1");
+  Zoltan_Set_Param(zoltan, "RETURN_LISTS", "ALL");
+  Zoltan_Set_Param(zoltan, "RCB_OUTPUT_LEVEL", "0");
+  Zoltan_Set_Param(zoltan, "RCB_RECTILINEAR_BLOCKS", "0");
+  Zoltan_Set_Num_Obj_Fn(zoltan, &getNumPoints, &pointData);
+  Zoltan_Set_Obj_List_Fn(zoltan, &getPointIds, &pointData);
+  Zoltan_Set_Num_Geom_Fn(zoltan, &getDimension, NULL);
+  Zoltan_Set_Geom_Multi_Fn(zoltan, &getPointCoordinates, &pointData);
+
+  int changes(0), numGidEntries(0), numLidEntries(0), numImport(0), numExport(0);
+  ZOLTAN_ID_PTR importGlobalIds(0), importLocalIds(0), exportGlobalIds(0), exportLocalIds(0);
+  int *importProcs(0), *importParts(0), *exportProcs(0), *exportParts(0);
+  zoltanErr = Zoltan_LB_Partition(zoltan, &changes, &numGidEntries, &numLidEntries,
+                                  &numImport, &importGlobalIds, &importLocalIds, &importProcs, &importParts,
+                                  &numExport, &exportGlobalIds, &exportLocalIds, &exportProcs, &exportParts);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(zoltanErr != ZOLTAN_OK, "**** Error:  Zoltan_LB_Partition() failed in LoadBalancer::rebalance().\n");
+
+  // The rebalanced owned points are the current points less the exports, plus the imports
+  set<int> exportedIds;
+  for(int i=0 ; i<numExport ; ++i)
+    exportedIds.insert(static_cast<int>(exportGlobalIds[i]));
+  vector<int> rebalancedGlobalIds;
+  rebalancedGlobalIds.reserve(numCurrentPoints - numExport + numImport);
+  for(int i=0 ; i<numCurrentPoints ; ++i){
+    if(exportedIds.find(currentGlobalIds[i]) == exportedIds.end())
+      rebalancedGlobalIds.push_back(currentGlobalIds[i]);
+  }
+  for(int i=0 ; i<numImport ; ++i)
+    rebalancedGlobalIds.push_back(static_cast<int>(importGlobalIds[i]));
+  sort(rebalancedGlobalIds.begin(), rebalancedGlobalIds.end());
+
+  Zoltan_LB_Free_Part(&importGlobalIds, &importLocalIds, &importProcs, &importParts);
+  Zoltan_LB_Free_Part(&exportGlobalIds, &exportLocalIds, &exportProcs, &exportParts);
+  Zoltan_Destroy(&zoltan);
+
+  // Create the rebalanced owned maps and migrate the block ids and bond counts
+  int numRebalancedPoints = static_cast<int>(rebalancedGlobalIds.size());
+  int* rebalancedGlobalIdsPtr = numRebalancedPoints > 0 ? &rebalancedGlobalIds[0] : 0;
+  Teuchos::RCP<Epetra_BlockMap> rebalancedOwnedScalarPointMap =
+    Teuchos::rcp(new Epetra_BlockMap(numGlobalElements, numRebalancedPoints, rebalancedGlobalIdsPtr, 1, indexBase, comm));
+  Teuchos::RCP<Epetra_BlockMap> rebalancedOwnedVectorPointMap =
+    Teuchos::rcp(new Epetra_BlockMap(numGlobalElements, numRebalancedPoints, rebalancedGlobalIdsPtr, 3, indexBase, comm));
+
+  Epetra_Import oneDimensionalImporter(*rebalancedOwnedScalarPointMap, currentOwnedScalarPointMap);
+  Teuchos::RCP<Epetra_Vector> rebalancedBlockIds = Teuchos::rcp(new Epetra_Vector(*rebalancedOwnedScalarPointMap));
+  rebalancedBlockIds->Import(blockIds, oneDimensionalImporter, Insert);
+  Epetra_Vector rebalancedNumberOfBonds(*rebalancedOwnedScalarPointMap);
+  rebalancedNumberOfBonds.Import(numberOfBonds, oneDimensionalImporter, Insert);
+
+  // Create the rebalanced bond map and migrate the neighbor lists
+  Teuchos::RCP<Epetra_BlockMap> rebalancedOwnedScalarBondMap = createBondMap(*rebalancedOwnedScalarPointMap, rebalancedNumberOfBonds);
+  Epetra_Import bondImporter(*rebalancedOwnedScalarBondMap, *currentOwnedScalarBondMap);
+  Epetra_Vector rebalancedNeighborGlobalIds(*rebalancedOwnedScalarBondMap);
+  rebalancedNeighborGlobalIds.Import(neighborGlobalIds, bondImporter, Insert);
+
+  // Create the rebalanced overlap maps, the owned points are followed by the off-processor neighbors
+  set<int> offProcessorIds;
+  for(int i=0 ; i<rebalancedNeighborGlobalIds.MyLength() ; ++i){
+    int globalId = static_cast<int>(rebalancedNeighborGlobalIds[i]);
+    if(!rebalancedOwnedScalarPointMap->MyGID(globalId))
+      offProcessorIds.insert(globalId);
+  }
+  vector<int> overlapGlobalIds(rebalancedGlobalIds);
+  overlapGlobalIds.insert(overlapGlobalIds.end(), offProcessorIds.begin(), offProcessorIds.end());
+  int numOverlapPoints = static_cast<int>(overlapGlobalIds.size());
+  int* overlapGlobalIdsPtr = numOverlapPoints > 0 ? &overlapGlobalIds[0] : 0;
+  Teuchos::RCP<Epetra_BlockMap> rebalancedOverlapScalarPointMap =
+    Teuchos::rcp(new Epetra_BlockMap(numGlobalElements, numOverlapPoints, overlapGlobalIdsPtr, 1, indexBase, comm));
+  Teuchos::RCP<Epetra_BlockMap> rebalancedOverlapVectorPointMap =
+    Teuchos::rcp(new Epetra_BlockMap(numGlobalElements, numOverlapPoints, overlapGlobalIdsPtr, 3, indexBase, comm));
+
+  // Create the rebalanced neighborhood data, with the neighbors given as local ids in the rebalanced overlap map
+  Teuchos::RCP<PeridigmNS::NeighborhoodData> rebalancedNeighborhoodData = Teuchos::rcp(new PeridigmNS::NeighborhoodData);
+  rebalancedNeighborhoodData->SetNumOwned(numRebalancedPoints);
+  rebalancedNeighborhoodData->SetNeighborhoodListSize(numRebalancedPoints + rebalancedNeighborGlobalIds.MyLength());
+  int* ownedIds = rebalancedNeighborhoodData->OwnedIDs();
+  int* neighborhoodPtr = rebalancedNeighborhoodData->NeighborhoodPtr();
+  int* neighborhoodList = rebalancedNeighborhoodData->NeighborhoodList();
+  int neighborhoodListIndex = 0;
+  for(int i=0 ; i<numRebalancedPoints ; ++i){
+    int numNeighbors = static_cast<int>(rebalancedNumberOfBonds[i]);
+    ownedIds[i] = i;
+    neighborhoodPtr[i] = neighborhoodListIndex;
+    neighborhoodList[neighborhoodListIndex++] = numNeighbors;
+    if(numNeighbors > 0){
+      int firstNeighbor = rebalancedOwnedScalarBondMap->FirstPointInElementList()[rebalancedOwnedScalarBondMap->LID(rebalancedGlobalIds[i])];
+      for(int j=0 ; j<numNeighbors ; ++j)
+        neighborhoodList[neighborhoodListIndex++] = rebalancedOverlapScalarPointMap->LID( static_cast<int>(rebalancedNeighborGlobalIds[firstNeighbor + j]) );
+    }
+  }
+
+  // Model coordinates on the rebalanced overlap map, used for point ordering within the blocks
+  Teuchos::RCP<Epetra_Vector> rebalancedOverlapCoordinates = Teuchos::rcp(new Epetra_Vector(*rebalancedOverlapVectorPointMap));
+  Epetra_Import overlapCoordinatesImporter(*rebalancedOverlapVectorPointMap, *initialOwnedVectorPointMap);
+  rebalancedOverlapCoordinates->Import(*modelCoordinates, overlapCoordinatesImporter, Insert);
+
+  // Migrate the blocks, ghost data continues to be imported from the mothership vectors in the initial decomposition
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+    blockIt->rebalance(rebalancedOwnedScalarPointMap,
+                       rebalancedOverlapScalarPointMap,
+                       rebalancedOwnedVectorPointMap,
+                       rebalancedOverlapVectorPointMap,
+                       rebalancedOwnedScalarBondMap,
+                       rebalancedBlockIds,
+                       rebalancedNeighborhoodData,
+                       initialOwnedScalarPointMap,
+                       rebalancedOverlapCoordinates,
+                       true);
+
+  // The mothership vectors are not migrated, so the ghosted data of each rebalanced block is imported from the
+  // initial decomposition at every step; report that off-processor traffic against the initial decomposition
+  if(verbose){
+    Epetra_Import rebalancedGhostImporter(*rebalancedOverlapScalarPointMap, *initialOwnedScalarPointMap);
+    Epetra_Import initialGhostImporter(*initialOverlapScalarPointMap, *initialOwnedScalarPointMap);
+    int localNumRemoteIds[2] = {rebalancedGhostImporter.NumRemoteIDs(), initialGhostImporter.NumRemoteIDs()};
+    int numRemoteIds[2];
+    comm.SumAll(localNumRemoteIds, numRemoteIds, 2);
+    if(comm.MyPID() == 0)
+      cout << "Load balancer: rebalanced, " << numRemoteIds[0] << " off-processor points imported per vector per step ("
+           << numRemoteIds[1] << " in the initial decomposition)" << endl;
+  }
+
+  rebalanced = true;
+  rebalanceCount++;
+}
+
+void PeridigmNS::LoadBalancer::restoreInitialDecomposition(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks)
+{
+  if(!rebalanced)
+    return;
+
+  // Restoring the initial global neighborhood data reproduces the initial neighbor ordering within each block,
+  // which is the order in which the bond data was preserved during rebalance()
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+    blockIt->rebalance(initialOwnedScalarPointMap,
+                       initialOverlapScalarPointMap,
+                       initialOwnedVectorPointMap,
+                       initialOverlapVectorPointMap,
+                       initialOwnedScalarBondMap,
+                       initialBlockIds,
+                       initialNeighborhoodData,
+                       initialOwnedScalarPointMap,
+                       getInitialOverlapCoordinates(),
+                       false);
+
+  rebalanced = false;
+}
+
+Teuchos::RCP< std::vector<PeridigmNS::Block> > PeridigmNS::LoadBalancer::initialDecompositionBlocks(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks)
+{
+  if(!rebalanced)
+    return blocks;
+
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+  if(initialBlocks.is_null()){
+    initialBlocks = Teuchos::rcp(new std::vector<PeridigmNS::Block>);
+    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+      initialBlocks->push_back(blockIt->createCopy(initialOwnedScalarPointMap,
+                                                   initialOverlapScalarPointMap,
+                                                   initialOwnedVectorPointMap,
+                                                   initialOverlapVectorPointMap,
+                                                   initialOwnedScalarBondMap,
+                                                   initialBlockIds,
+                                                   initialNeighborhoodData,
+                                                   getInitialOverlapCoordinates()));
+  }
+
+  std::vector<PeridigmNS::Block>::iterator initialBlockIt = initialBlocks->begin();
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++, initialBlockIt++)
+    initialBlockIt->getDataManager()->importDataFromDataManager(*blockIt->getDataManager());
+
+  return initialBlocks;
+}
+
+Teuchos::RCP<const Epetra_Vector> PeridigmNS::LoadBalancer::getInitialOverlapCoordinates()
+{
+  if(initialOverlapCoordinates.is_null()){
+    initialOverlapCoordinates = Teuchos::rcp(new Epetra_Vector(*initialOverlapVectorPointMap));
+    Epetra_Import overlapCoordinatesImporter(*initialOverlapVectorPointMap, *initialOwnedVectorPointMap);
+    initialOverlapCoordinates->Import(*modelCoordinates, overlapCoordinatesImporter, Insert);
+  }
+  return initialOverlapCoordinates;
+}
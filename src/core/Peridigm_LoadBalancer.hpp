@@ -0,0 +1,168 @@
+/*! \file Peridigm_LoadBalancer.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_LOADBALANCER_HPP
+#define PERIDIGM_LOADBALANCER_HPP
+
+#include <Epetra_BlockMap.h>
+#include <Epetra_Vector.h>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <vector>
+#include "Peridigm_Block.hpp"
+#include "Peridigm_NeighborhoodData.hpp"
+
+namespace PeridigmNS {
+
+/*! \brief Rebalances the material blocks based on the measured cost of the internal force evaluation.
+ *
+ *  The time spent in the internal force evaluation is sampled at a user-specified step interval.  If the
+ *  ratio of the maximum to the average time across processors exceeds the imbalance tolerance, the points
+ *  are repartitioned with weighted recursive coordinate bisection, where the weight of each point is its
+ *  number of bonds scaled by the measured cost per bond on its current processor.  Only the blocks are
+ *  migrated; the mothership vectors remain in the initial decomposition and ghost data continues to be
+ *  imported from them.  This is deliberate: the boundary conditions, contact, computes, and output all index
+ *  the mothership vectors by their initial local IDs.  The cost is that after a rebalance the kinematics and
+ *  forces of points that moved are communicated at every step, and output requires copies of the blocks in
+ *  the initial decomposition.  With "Verbose" set, the number of off-processor imports is reported at each
+ *  rebalance alongside the number in the initial decomposition.
+ */
+class LoadBalancer {
+
+public:
+
+  //! Constructor; the maps, block ids, neighborhood data, and model coordinates define the initial decomposition.
+  LoadBalancer(const Teuchos::ParameterList& params,
+               Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarPointMap,
+               Teuchos::RCP<const Epetra_BlockMap> globalOverlapScalarPointMap,
+               Teuchos::RCP<const Epetra_BlockMap> globalOwnedVectorPointMap,
+               Teuchos::RCP<const Epetra_BlockMap> globalOverlapVectorPointMap,
+               Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarBondMap,
+               Teuchos::RCP<const Epetra_Vector> globalBlockIds,
+               Teuchos::RCP<const PeridigmNS::NeighborhoodData> globalNeighborhoodData,
+               Teuchos::RCP<const Epetra_Vector> modelCoordinates);
+
+  //! Destructor.
+  ~LoadBalancer(){}
+
+  //! Samples the internal force timer and returns true if the measured imbalance exceeds the tolerance; must be called on all processors.
+  bool rebalanceRequired(int step);
+
+  //! Repartitions the blocks based on the most recently measured cost.
+  void rebalance(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
+
+  //! Returns the blocks to the initial decomposition.
+  void restoreInitialDecomposition(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
+
+  /*! \brief Returns the blocks in the initial decomposition, as required for output.
+   *
+   *  If the blocks are rebalanced, their data is imported into copies of the blocks held in the initial
+   *  decomposition and the copies are returned; the blocks themselves are not migrated.  The copies are
+   *  created on first use and are reused for the remainder of the run.
+   */
+  Teuchos::RCP< std::vector<PeridigmNS::Block> > initialDecompositionBlocks(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
+
+  //! Returns true if the blocks are currently in a rebalanced decomposition.
+  bool isRebalanced() const { return rebalanced; }
+
+  //! Returns the number of times the blocks have been rebalanced.
+  int getRebalanceCount() const { return rebalanceCount; }
+
+private:
+
+  //! Copy constructor.
+  LoadBalancer(const LoadBalancer& other);
+
+  //! Assignment operator.
+  LoadBalancer& operator=(const LoadBalancer& other);
+
+  //! Number of steps between checks of the load imbalance
+  int checkFrequency;
+
+  //! Ratio of the maximum to the average internal force time that triggers a rebalance
+  double imbalanceTolerance;
+
+  //! Flag for reporting the measured imbalance
+  bool verbose;
+
+  //! Internal force time at the most recent check
+  double previousInternalForceTime;
+
+  //! Internal force time on this processor between the two most recent checks
+  double measuredInternalForceTime;
+
+  //! Flag indicating that the blocks are in a rebalanced decomposition
+  bool rebalanced;
+
+  //! Number of rebalances performed
+  int rebalanceCount;
+
+  //! Initial decomposition
+  Teuchos::RCP<const Epetra_BlockMap> initialOwnedScalarPointMap;
+  Teuchos::RCP<const Epetra_BlockMap> initialOverlapScalarPointMap;
+  Teuchos::RCP<const Epetra_BlockMap> initialOwnedVectorPointMap;
+  Teuchos::RCP<const Epetra_BlockMap> initialOverlapVectorPointMap;
+  Teuchos::RCP<const Epetra_BlockMap> initialOwnedScalarBondMap;
+  Teuchos::RCP<const Epetra_Vector> initialBlockIds;
+  Teuchos::RCP<const PeridigmNS::NeighborhoodData> initialNeighborhoodData;
+
+  //! Model coordinates on the initial owned vector map
+  Teuchos::RCP<const Epetra_Vector> modelCoordinates;
+
+  //! Returns the model coordinates on the initial overlap vector map
+  Teuchos::RCP<const Epetra_Vector> getInitialOverlapCoordinates();
+
+  //! Model coordinates on the initial overlap vector map, created on first use
+  Teuchos::RCP<Epetra_Vector> initialOverlapCoordinates;
+
+  //! Copies of the blocks in the initial decomposition, used for output while the blocks are rebalanced
+  Teuchos::RCP< std::vector<PeridigmNS::Block> > initialBlocks;
+};
+
+}
+
+#endif // PERIDIGM_LOADBALANCER_HPP
@@ -0,0 +1,107 @@
+/*! \file Peridigm_MatrixFreeJacobianOperator.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <cmath>
+
+#include <Teuchos_Assert.hpp>
+
+#include "Peridigm_MatrixFreeJacobianOperator.hpp"
+#include "Peridigm.hpp"
+
+PeridigmNS::MatrixFreeJacobianOperator::MatrixFreeJacobianOperator(PeridigmNS::Peridigm* peridigm_,
+                                                                   Teuchos::RCP<const Epetra_Map> map_,
+                                                                   double relativePerturbation_)
+  : peridigm(peridigm_), map(map_), relativePerturbation(relativePerturbation_), solutionNorm(0.0), numApplications(0)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(relativePerturbation <= 0.0, "**** PeridigmNS::MatrixFreeJacobianOperator, the perturbation must be positive.\n");
+  direction = Teuchos::rcp(new Epetra_Vector(*map));
+  perturbedResidual = Teuchos::rcp(new Epetra_Vector(*map));
+}
+
+int PeridigmNS::MatrixFreeJacobianOperator::Apply(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(baseResidual.is_null(), "**** PeridigmNS::MatrixFreeJacobianOperator::Apply(), base residual has not been set.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(kinematicBCDiagonal.is_null(), "**** PeridigmNS::MatrixFreeJacobianOperator::Apply(), kinematic B.C. diagonal has not been set.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(X.NumVectors() != Y.NumVectors(), "**** PeridigmNS::MatrixFreeJacobianOperator::Apply(), incompatible multivectors.\n");
+
+  const double* baseResidualPtr = baseResidual->Values();
+  const double* bcDiagonalPtr = kinematicBCDiagonal->Values();
+  int length = X.MyLength();
+
+  // X and Y may be the same object, so the direction is copied before Y is overwritten
+  for(int col=0 ; col<X.NumVectors() ; ++col){
+    const double* xPtr = X[col];
+    double* directionPtr = direction->Values();
+    for(int i=0 ; i<length ; ++i)
+      directionPtr[i] = xPtr[i];
+
+    double directionNorm;
+    direction->Norm2(&directionNorm);
+
+    double* yPtr = Y[col];
+    if(directionNorm == 0.0){
+      for(int i=0 ; i<length ; ++i)
+        yPtr[i] = 0.0;
+      continue;
+    }
+
+    // Forward-difference directional derivative of the residual, which does not perturb the kinematic B.C. degrees of freedom
+    double epsilon = relativePerturbation*(1.0 + solutionNorm)/directionNorm;
+    peridigm->computeQuasiStaticPerturbedResidual(*direction, epsilon, perturbedResidual);
+    numApplications += 1;
+
+    const double* perturbedResidualPtr = perturbedResidual->Values();
+    for(int i=0 ; i<length ; ++i)
+      yPtr[i] = -1.0*(perturbedResidualPtr[i] - baseResidualPtr[i])/epsilon;
+
+    // Rows with kinematic boundary conditions
+    for(int i=0 ; i<length ; ++i)
+      yPtr[i] += bcDiagonalPtr[i]*directionPtr[i];
+  }
+
+  return 0;
+}
@@ -0,0 +1,152 @@
+/*! \file Peridigm_MatrixFreeJacobianOperator.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_MATRIXFREEJACOBIANOPERATOR_HPP
+#define PERIDIGM_MATRIXFREEJACOBIANOPERATOR_HPP
+
+#include <Teuchos_RCP.hpp>
+#include <Epetra_Operator.h>
+#include <Epetra_Map.h>
+#include <Epetra_Vector.h>
+
+namespace PeridigmNS {
+
+class Peridigm;
+
+/*! \brief Epetra_Operator that applies the quasi-static tangent without assembling it.
+ *
+ *  The product J*v is approximated with a forward-difference directional derivative of the quasi-static
+ *  residual, J*v = -(R(u + epsilon*v) - R(u))/epsilon, which is consistent with the sign convention of the
+ *  assembled tangent (tangent->Scale(-1.0)).  As in applyKinematicBC_InsertZerosAndSetDiagonal(), the rows
+ *  and columns corresponding to kinematic boundary conditions are zero apart from the diagonal:  the
+ *  residual is perturbed only in the unconstrained degrees of freedom, and the kinematic B.C. rows apply
+ *  the diagonal value placed in the assembled tangent.
+ */
+class MatrixFreeJacobianOperator : public Epetra_Operator {
+
+public:
+
+  //! Constructor.
+  MatrixFreeJacobianOperator(PeridigmNS::Peridigm* peridigm,
+                             Teuchos::RCP<const Epetra_Map> map,
+                             double relativePerturbation);
+
+  //! Destructor.
+  virtual ~MatrixFreeJacobianOperator(){}
+
+  //! Set the residual at the current (unperturbed) state, R(u).
+  void setBaseResidual(Teuchos::RCP<const Epetra_Vector> residual) { baseResidual = residual; }
+
+  //! Set the diagonal entries applied to rows with kinematic boundary conditions (zero for all other rows).
+  void setKinematicBCDiagonal(Teuchos::RCP<const Epetra_Vector> diagonal) { kinematicBCDiagonal = diagonal; }
+
+  //! Set the norm of the current solution, used to scale the finite-difference perturbation.
+  void setSolutionNorm(double norm) { solutionNorm = norm; }
+
+  //! Number of operator applications (i.e., residual evaluations) since construction.
+  int getNumApplications() const { return numApplications; }
+
+  //! Compute Y = J*X.
+  virtual int Apply(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const;
+
+  //! Not supported.
+  virtual int ApplyInverse(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const { return -1; }
+
+  //! Transpose is not supported.
+  virtual int SetUseTranspose(bool UseTranspose) { return UseTranspose ? -1 : 0; }
+
+  virtual double NormInf() const { return 0.0; }
+
+  virtual const char* Label() const { return "PeridigmNS::MatrixFreeJacobianOperator"; }
+
+  virtual bool UseTranspose() const { return false; }
+
+  virtual bool HasNormInf() const { return false; }
+
+  virtual const Epetra_Comm& Comm() const { return map->Comm(); }
+
+  virtual const Epetra_Map& OperatorDomainMap() const { return *map; }
+
+  virtual const Epetra_Map& OperatorRangeMap() const { return *map; }
+
+private:
+
+  //! Private to prohibit copying.
+  MatrixFreeJacobianOperator(const MatrixFreeJacobianOperator&);
+
+  //! Private to prohibit copying.
+  MatrixFreeJacobianOperator& operator=(const MatrixFreeJacobianOperator&);
+
+  //! Peridigm object used to evaluate the residual at perturbed states
+  PeridigmNS::Peridigm* peridigm;
+
+  //! Map for the global linear system
+  Teuchos::RCP<const Epetra_Map> map;
+
+  //! Relative size of the finite-difference perturbation (approximately the square root of machine precision)
+  double relativePerturbation;
+
+  //! Norm of the current solution
+  double solutionNorm;
+
+  //! Residual at the unperturbed state
+  Teuchos::RCP<const Epetra_Vector> baseResidual;
+
+  //! Diagonal entries for rows with kinematic boundary conditions
+  Teuchos::RCP<const Epetra_Vector> kinematicBCDiagonal;
+
+  //! Work vectors
+  Teuchos::RCP<Epetra_Vector> direction;
+  Teuchos::RCP<Epetra_Vector> perturbedResidual;
+
+  //! Counter for operator applications
+  mutable int numApplications;
+};
+
+}
+
+#endif // PERIDIGM_MATRIXFREEJACOBIANOPERATOR_HPP
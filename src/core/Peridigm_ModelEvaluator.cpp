@@ -56,13 +56,22 @@ PeridigmNS::ModelEvaluator::~ModelEvaluator(){
 void
 PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
 {
-  const double dt = workset->timeStep;
+  evalModelSubcycle(workset, 0);
+}
+
+void
+PeridigmNS::ModelEvaluator::evalModelSubcycle(Teuchos::RCP<Workset> workset, int step) const
+{
   std::vector<PeridigmNS::Block>::iterator blockIt;
 
   // ---- Evaluate Damage ---
 
   for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
 
+    if(step%blockIt->getSubcycleRatio() != 0)
+      continue;
+    const double dt = workset->timeStep*blockIt->getSubcycleRatio();
+
     Teuchos::RCP<const PeridigmNS::DamageModel> damageModel = blockIt->getDamageModel();
     if(!damageModel.is_null()){
       Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
@@ -82,6 +91,10 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
 
   for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
 
+    if(step%blockIt->getSubcycleRatio() != 0)
+      continue;
+    const double dt = workset->timeStep*blockIt->getSubcycleRatio();
+
     Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
     const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
     const int* ownedIDs = neighborhoodData->OwnedIDs();
@@ -104,6 +117,10 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
 
   for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
 
+    if(step%blockIt->getSubcycleRatio() != 0)
+      continue;
+    const double dt = workset->timeStep*blockIt->getSubcycleRatio();
+
     Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
     const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
     const int* ownedIDs = neighborhoodData->OwnedIDs();
@@ -126,6 +143,151 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
 
   // ---- Evaluate Contact ----
 
+  if(!workset->contactManager.is_null())
+    workset->contactManager->evaluateContactForce(workset->timeStep);
+}
+
+bool
+PeridigmNS::ModelEvaluator::splitsEvaluation(PeridigmNS::Block& block) const
+{
+  Teuchos::RCP<const PeridigmNS::DamageModel> damageModel = block.getDamageModel();
+  return block.numInteriorPoints() > 0 &&
+    block.getMaterialModel()->supportsPartialForceEvaluation() &&
+    (damageModel.is_null() || damageModel->supportsPartialDamageEvaluation());
+}
+
+void
+PeridigmNS::ModelEvaluator::evalModelInterior(Teuchos::RCP<Workset> workset) const
+{
+  const double dt = workset->timeStep;
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+
+  // ---- Evaluate Damage and Internal Force at the interior points ----
+
+  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
+
+    if(!splitsEvaluation(*blockIt))
+      continue;
+
+    Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
+    const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
+    const int* ownedIDs = neighborhoodData->OwnedIDs();
+    const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+    const int numInteriorPoints = blockIt->numInteriorPoints();
+    Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
+    Teuchos::RCP<const PeridigmNS::Material> materialModel = blockIt->getMaterialModel();
+    Teuchos::RCP<const PeridigmNS::DamageModel> damageModel = blockIt->getDamageModel();
+
+    if(!damageModel.is_null())
+      damageModel->computeDamageOnPoints(dt,
+                                         numOwnedPoints,
+                                         ownedIDs,
+                                         neighborhoodList,
+                                         *dataManager,
+                                         0,
+                                         numInteriorPoints);
+
+    materialModel->computeForceOnPoints(dt,
+                                        numOwnedPoints,
+                                        ownedIDs,
+                                        neighborhoodList,
+                                        *dataManager,
+                                        0,
+                                        numInteriorPoints);
+  }
+}
+
+void
+PeridigmNS::ModelEvaluator::evalModelBoundary(Teuchos::RCP<Workset> workset) const
+{
+  const double dt = workset->timeStep;
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+
+  // ---- Evaluate Damage ---
+
+  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
+
+    Teuchos::RCP<const PeridigmNS::DamageModel> damageModel = blockIt->getDamageModel();
+    if(!damageModel.is_null()){
+      Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
+      const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
+      const int* ownedIDs = neighborhoodData->OwnedIDs();
+      const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+      Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
+      if(splitsEvaluation(*blockIt))
+        damageModel->computeDamageOnPoints(dt,
+                                           numOwnedPoints,
+                                           ownedIDs,
+                                           neighborhoodList,
+                                           *dataManager,
+                                           blockIt->numInteriorPoints(),
+                                           numOwnedPoints);
+      else
+        damageModel->computeDamage(dt,
+                                   numOwnedPoints,
+                                   ownedIDs,
+                                   neighborhoodList,
+                                   *dataManager);
+    }
+  }
+
+  // ---- Evaluate Precompute ----
+
+  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
+
+    Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
+    const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
+    const int* ownedIDs = neighborhoodData->OwnedIDs();
+    const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+    Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
+    Teuchos::RCP<const PeridigmNS::Material> materialModel = blockIt->getMaterialModel();
+
+    materialModel->precompute(dt,
+                              numOwnedPoints,
+                              ownedIDs,
+                              neighborhoodList,
+                              *dataManager);
+  }
+
+  // ---- Synchronize data computed in precompute ----
+
+  PeridigmNS::DataManagerSynchronizer::self().synchronizeDataAfterPrecompute(workset->blocks);
+
+  // ---- Evaluate Internal Force ----
+
+  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
+
+    Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
+    const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
+    const int* ownedIDs = neighborhoodData->OwnedIDs();
+    const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+    Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
+    Teuchos::RCP<const PeridigmNS::Material> materialModel = blockIt->getMaterialModel();
+
+    if(splitsEvaluation(*blockIt))
+      materialModel->computeForceOnPoints(dt,
+                                          numOwnedPoints,
+                                          ownedIDs,
+                                          neighborhoodList,
+                                          *dataManager,
+                                          blockIt->numInteriorPoints(),
+                                          numOwnedPoints);
+    else
+      materialModel->computeForce(dt,
+                                  numOwnedPoints,
+                                  ownedIDs,
+                                  neighborhoodList,
+                                  *dataManager);
+
+    materialModel->computeFluxDivergence(dt,
+                                         numOwnedPoints,
+                                         ownedIDs,
+                                         neighborhoodList,
+                                         *dataManager);
+  }
+
+  // ---- Evaluate Contact ----
+
   if(!workset->contactManager.is_null())
     workset->contactManager->evaluateContactForce(dt);
 }
@@ -77,6 +77,23 @@ namespace PeridigmNS {
     //! Model evaluation that acts directly on the workset
     void evalModel(Teuchos::RCP<Workset> workset) const;
 
+    /*! \brief Model evaluation for multi-rate explicit time integration.
+     *
+     *  Only the blocks whose subcycle ratio divides the given step are evaluated, each with a time step equal to the
+     *  workset time step multiplied by its subcycle ratio.  Contact is evaluated at every step.
+     */
+    void evalModelSubcycle(Teuchos::RCP<Workset> workset, int step) const;
+
+    /*! \brief Evaluate damage and internal force at the interior points of each block that supports split evaluation.
+     *
+     *  Interior points have no off-processor neighbors, so this may be called while ghost data is in transit.
+     *  The evaluation must be completed with evalModelBoundary(); together the two calls are equivalent to evalModel().
+     */
+    void evalModelInterior(Teuchos::RCP<Workset> workset) const;
+
+    //! Complete a model evaluation started with evalModelInterior(), ghost data must be up to date.
+    void evalModelBoundary(Teuchos::RCP<Workset> workset) const;
+
     //! Jacobian evaluation that acts directly on the workset
     void evalJacobian(Teuchos::RCP<Workset> workset) const;
 
@@ -86,6 +103,9 @@ namespace PeridigmNS {
 
   private:
 
+    //! Returns true if the block's owned points are split into interior points and boundary points for evaluation.
+    bool splitsEvaluation(PeridigmNS::Block& block) const;
+
     //! Private to prohibit copying
     ModelEvaluator(const ModelEvaluator&);
 
@@ -106,6 +106,30 @@ void PeridigmNS::SerialMatrix::addValues(int numIndices, const int* globalIndice
   }
 }
 
+// This is like the SerialMatrix::addValues routine above, but sums a single row and so avoids carrying the (often empty) rows of the neighbors
+void PeridigmNS::SerialMatrix::addRowValues(int globalRow, int numIndices, const int* globalColIndices, const double* values)
+{
+  int localRowIndex = FECrsMatrix->LRID(globalRow);
+
+  // If the row is locally owned, then sum into the global tangent with Epetra_CrsMatrix::SumIntoMyValues().
+  if(localRowIndex != -1){
+    vector<int> localColIndices(numIndices);
+    for(int i=0 ; i<numIndices ; ++i){
+      int localColIndex = FECrsMatrix->LCID(globalColIndices[i]);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(localColIndex == -1, "Error in PeridigmNS::SerialMatrix::addRowValues(), bad column index.");
+      localColIndices[i] = localColIndex;
+    }
+    int err = FECrsMatrix->SumIntoMyValues(localRowIndex, numIndices, values, &localColIndices[0]);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::addRowValues(), SumIntoMyValues() returned nonzero error code.\n");
+  }
+  // If the row is not locally owned, then sum into the global tangent with Epetra_FECrsMatrix::SumIntoGlobalValues().
+  // This is expensive.
+  else{
+    int err = FECrsMatrix->SumIntoGlobalValues(globalRow, numIndices, values, globalColIndices);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::addRowValues(), SumIntoGlobalValues() returned nonzero error code.\n");
+  }
+}
+
 // This is like the SerialMatrix::addValues routine above, but inserts only the block diagonal values and filters out the rest
 void PeridigmNS::SerialMatrix::addBlockDiagonalValues(int numIndices, const int* globalIndices, const double *const * values)
 {
@@ -0,0 +1,175 @@
+/*! \file Peridigm_SpaceFillingCurve.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_SpaceFillingCurve.hpp"
+#include <Teuchos_Assert.hpp>
+#include <algorithm>
+#include <utility>
+#include <limits>
+
+using namespace std;
+
+PeridigmNS::SpaceFillingCurve::Type PeridigmNS::SpaceFillingCurve::stringToType(const std::string& str)
+{
+  Type type(NONE);
+  if(str == "None")
+    type = NONE;
+  else if(str == "Morton")
+    type = MORTON;
+  else if(str == "Hilbert")
+    type = HILBERT;
+  else
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "\n**** Error:  Invalid \"Point Ordering\" option \"" + str + "\", valid options are \"None\", \"Morton\", and \"Hilbert\".\n");
+  return type;
+}
+
+namespace {
+
+  //! Spreads the lower 21 bits of value so that there are two zero bits between each original bit.
+  uint64_t spreadBits(uint32_t value)
+  {
+    uint64_t x = value & 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffffULL;
+    x = (x | x << 16) & 0x1f0000ff0000ffULL;
+    x = (x | x << 8)  & 0x100f00f00f00f00fULL;
+    x = (x | x << 4)  & 0x10c30c30c30c30c3ULL;
+    x = (x | x << 2)  & 0x1249249249249249ULL;
+    return x;
+  }
+
+}
+
+uint64_t PeridigmNS::SpaceFillingCurve::mortonKey(uint32_t x, uint32_t y, uint32_t z)
+{
+  return (spreadBits(x) << 2) | (spreadBits(y) << 1) | spreadBits(z);
+}
+
+uint64_t PeridigmNS::SpaceFillingCurve::hilbertKey(uint32_t x, uint32_t y, uint32_t z)
+{
+  // Transform the coordinates to the "transposed" Hilbert index, following
+  // J. Skilling, "Programming the Hilbert curve," AIP Conf. Proc. 707, 381 (2004).
+  const int n = 3;
+  uint32_t X[3] = {x, y, z};
+  uint32_t M = 1u << (bitsPerDimension - 1);
+  uint32_t P, Q, t;
+
+  // Inverse undo
+  for(Q=M ; Q>1 ; Q>>=1){
+    P = Q - 1;
+    for(int i=0 ; i<n ; ++i){
+      if(X[i] & Q){
+        X[0] ^= P;
+      }
+      else{
+        t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for(int i=1 ; i<n ; ++i)
+    X[i] ^= X[i-1];
+  t = 0;
+  for(Q=M ; Q>1 ; Q>>=1){
+    if(X[n-1] & Q)
+      t ^= Q - 1;
+  }
+  for(int i=0 ; i<n ; ++i)
+    X[i] ^= t;
+
+  // The transposed index stores the most significant bit of the key in X[0]
+  return mortonKey(X[0], X[1], X[2]);
+}
+
+void PeridigmNS::SpaceFillingCurve::computeOrder(Type type, const double* coordinates, int numPoints, std::vector<int>& order)
+{
+  order.resize(numPoints);
+  for(int i=0 ; i<numPoints ; ++i)
+    order[i] = i;
+
+  if(type == NONE || numPoints < 2)
+    return;
+
+  // Bounding box of the point set
+  double min[3], max[3];
+  for(int dof=0 ; dof<3 ; ++dof){
+    min[dof] = numeric_limits<double>::max();
+    max[dof] = -numeric_limits<double>::max();
+  }
+  for(int i=0 ; i<numPoints ; ++i){
+    for(int dof=0 ; dof<3 ; ++dof){
+      min[dof] = std::min(min[dof], coordinates[3*i+dof]);
+      max[dof] = std::max(max[dof], coordinates[3*i+dof]);
+    }
+  }
+
+  // Quantize the coordinates onto a uniform grid with 2^bitsPerDimension cells per side;
+  // use a single scale factor so that the curve is not distorted for elongated domains
+  double extent = std::max(max[0] - min[0], std::max(max[1] - min[1], max[2] - min[2]));
+  double maxCell = static_cast<double>((1u << bitsPerDimension) - 1);
+  double scale = extent > 0.0 ? maxCell/extent : 0.0;
+
+  vector< pair<uint64_t, int> > keys(numPoints);
+  uint32_t q[3];
+  for(int i=0 ; i<numPoints ; ++i){
+    for(int dof=0 ; dof<3 ; ++dof)
+      q[dof] = static_cast<uint32_t>((coordinates[3*i+dof] - min[dof])*scale);
+    if(type == MORTON)
+      keys[i].first = mortonKey(q[0], q[1], q[2]);
+    else
+      keys[i].first = hilbertKey(q[0], q[1], q[2]);
+    keys[i].second = i;
+  }
+
+  // Sorting on (key, original index) keeps ties in their original order
+  sort(keys.begin(), keys.end());
+
+  for(int i=0 ; i<numPoints ; ++i)
+    order[i] = keys[i].second;
+}
@@ -0,0 +1,89 @@
+/*! \file Peridigm_SpaceFillingCurve.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_SPACEFILLINGCURVE_HPP
+#define PERIDIGM_SPACEFILLINGCURVE_HPP
+
+#include <vector>
+#include <string>
+#include <stdint.h>
+
+namespace PeridigmNS {
+
+namespace SpaceFillingCurve {
+
+  //! Orderings available for the local points in a block.
+  enum Type {
+    NONE=0,
+    MORTON,
+    HILBERT
+  };
+
+  //! Converts the "Point Ordering" input string ("None", "Morton", or "Hilbert") to a curve type.
+  Type stringToType(const std::string& str);
+
+  //! Number of bits per coordinate direction used when quantizing positions (3*21 bits fit in a 64-bit key).
+  static const int bitsPerDimension = 21;
+
+  //! Morton (Z-order) key for a point with the given quantized coordinates.
+  uint64_t mortonKey(uint32_t x, uint32_t y, uint32_t z);
+
+  //! Hilbert key for a point with the given quantized coordinates.
+  uint64_t hilbertKey(uint32_t x, uint32_t y, uint32_t z);
+
+  /*! \brief Computes the permutation that sorts a set of points along a space-filling curve.
+   *
+   *  The coordinates are interleaved (x0, y0, z0, x1, y1, z1, ...).  On exit, order[i] is the
+   *  index of the point that should be placed in position i.  Points with identical keys retain
+   *  their original relative order.
+   */
+  void computeOrder(Type type, const double* coordinates, int numPoints, std::vector<int>& order);
+}
+
+}
+
+#endif // PERIDIGM_SPACEFILLINGCURVE_HPP
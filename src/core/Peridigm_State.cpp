@@ -47,9 +47,11 @@
 
 #include "Peridigm_State.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_BitPackedBondData.hpp"
 #include <Epetra_Import.h>
 #include <Teuchos_Assert.hpp>
 #include <sstream>
+#include <algorithm>
 #include <EpetraExt_MultiVectorOut.h>
 #include <EpetraExt_MultiVectorIn.h>
 using namespace std;
@@ -79,7 +81,9 @@ void PeridigmNS::State::allocatePointData(PeridigmField::Length length,
 }
 
 void PeridigmNS::State::allocateBondData(vector<int> fieldIds,
-                                         Teuchos::RCP<const Epetra_BlockMap> map)
+                                         Teuchos::RCP<const Epetra_BlockMap> map,
+                                         vector<int> singlePrecisionFieldIdRequests,
+                                         vector<int> bitPackedFieldIdRequests)
 {
   std::sort(fieldIds.begin(), fieldIds.end());
 
@@ -89,13 +93,102 @@ void PeridigmNS::State::allocateBondData(vector<int> fieldIds,
     fieldIdToDataVector.resize(numFieldIds);
   }
 
-  TEUCHOS_TEST_FOR_EXCEPT_MSG(!bondData.is_null(),
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!bondData.is_null() || !compactBondMap.is_null(),
                               "\n**** Error:  PeridigmNS::State::allocateData(), bond data field already allocated!\n");
 
-  bondData = Teuchos::rcp(new Epetra_MultiVector(*map, fieldIds.size()));
+  // Split the field ids into double-precision, single-precision, and bit-packed storage
+  vector<int> doublePrecisionFieldIds;
   for(unsigned int i=0 ; i<fieldIds.size() ; ++i){
-    fieldIdToDataMap[fieldIds[i]] = Teuchos::rcp((*bondData)(i), false);
-    fieldIdToDataVector[fieldIds[i]] = Teuchos::rcp((*bondData)(i), false);
+    if(find(bitPackedFieldIdRequests.begin(), bitPackedFieldIdRequests.end(), fieldIds[i]) != bitPackedFieldIdRequests.end())
+      bitPackedFieldIds.push_back(fieldIds[i]);
+    else if(find(singlePrecisionFieldIdRequests.begin(), singlePrecisionFieldIdRequests.end(), fieldIds[i]) != singlePrecisionFieldIdRequests.end())
+      singlePrecisionFieldIds.push_back(fieldIds[i]);
+    else
+      doublePrecisionFieldIds.push_back(fieldIds[i]);
+  }
+
+  if(doublePrecisionFieldIds.size() > 0){
+    bondData = Teuchos::rcp(new Epetra_MultiVector(*map, doublePrecisionFieldIds.size()));
+    for(unsigned int i=0 ; i<doublePrecisionFieldIds.size() ; ++i){
+      fieldIdToDataMap[doublePrecisionFieldIds[i]] = Teuchos::rcp((*bondData)(i), false);
+      fieldIdToDataVector[doublePrecisionFieldIds[i]] = Teuchos::rcp((*bondData)(i), false);
+    }
+  }
+
+  if(singlePrecisionFieldIds.size() > 0 || bitPackedFieldIds.size() > 0)
+    compactBondMap = map;
+
+  if(singlePrecisionFieldIds.size() > 0){
+    singlePrecisionBondData.assign(singlePrecisionFieldIds.size()*map->NumMyPoints(), 0.0f);
+    for(unsigned int i=0 ; i<singlePrecisionFieldIds.size() ; ++i)
+      singlePrecisionFieldIdToIndex[singlePrecisionFieldIds[i]] = i;
+  }
+
+  if(bitPackedFieldIds.size() > 0){
+    numBitPackedWordsPerField = numBitPackedWords(map->NumMyPoints());
+    bitPackedBondData.assign(bitPackedFieldIds.size()*numBitPackedWordsPerField, 0u);
+    for(unsigned int i=0 ; i<bitPackedFieldIds.size() ; ++i)
+      bitPackedFieldIdToIndex[bitPackedFieldIds[i]] = i;
+  }
+}
+
+float* PeridigmNS::State::getSinglePrecisionData(int fieldId)
+{
+  std::map<int, int>::const_iterator it = singlePrecisionFieldIdToIndex.find(fieldId);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(it == singlePrecisionFieldIdToIndex.end(),
+                              "\n**** Error:  PeridigmNS::State::getSinglePrecisionData(), field is not stored in single precision!\n");
+  return &singlePrecisionBondData[it->second*compactBondMap->NumMyPoints()];
+}
+
+std::uint32_t* PeridigmNS::State::getBitPackedData(int fieldId)
+{
+  std::map<int, int>::const_iterator it = bitPackedFieldIdToIndex.find(fieldId);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(it == bitPackedFieldIdToIndex.end(),
+                              "\n**** Error:  PeridigmNS::State::getBitPackedData(), field is not bit packed!\n");
+  return &bitPackedBondData[it->second*numBitPackedWordsPerField];
+}
+
+Teuchos::RCP<Epetra_MultiVector> PeridigmNS::State::getCompactBondMultiVectorCopy()
+{
+  Teuchos::RCP<Epetra_MultiVector> copy;
+  if(compactBondMap.is_null())
+    return copy;
+  int numPoints = compactBondMap->NumMyPoints();
+  int numSinglePrecisionFields = singlePrecisionFieldIds.size();
+  copy = Teuchos::rcp(new Epetra_MultiVector(*compactBondMap, numSinglePrecisionFields + bitPackedFieldIds.size()));
+  for(int iVec=0 ; iVec<numSinglePrecisionFields ; ++iVec){
+    Epetra_Vector& vec = *(*copy)(iVec);
+    const float* values = &singlePrecisionBondData[iVec*numPoints];
+    for(int i=0 ; i<numPoints ; ++i)
+      vec[i] = values[i];
+  }
+  for(unsigned int iField=0 ; iField<bitPackedFieldIds.size() ; ++iField){
+    Epetra_Vector& vec = *(*copy)(numSinglePrecisionFields + iField);
+    const std::uint32_t* words = &bitPackedBondData[iField*numBitPackedWordsPerField];
+    for(int i=0 ; i<numPoints ; ++i)
+      vec[i] = testBondBit(words, i) ? 1.0 : 0.0;
+  }
+  return copy;
+}
+
+void PeridigmNS::State::setCompactBondData(const Epetra_MultiVector& data)
+{
+  int numSinglePrecisionFields = singlePrecisionFieldIds.size();
+  TEUCHOS_TEST_FOR_EXCEPTION(compactBondMap.is_null() || data.NumVectors() != numSinglePrecisionFields + (int)bitPackedFieldIds.size() ||
+                             data.MyLength() != compactBondMap->NumMyPoints(), std::runtime_error,
+                             "PeridigmNS::State::setCompactBondData() called with incompatible MultiVector.\n");
+  int numPoints = compactBondMap->NumMyPoints();
+  for(int iVec=0 ; iVec<numSinglePrecisionFields ; ++iVec){
+    const Epetra_Vector& vec = *data(iVec);
+    float* values = &singlePrecisionBondData[iVec*numPoints];
+    for(int i=0 ; i<numPoints ; ++i)
+      values[i] = static_cast<float>(vec[i]);
+  }
+  for(unsigned int iField=0 ; iField<bitPackedFieldIds.size() ; ++iField){
+    const Epetra_Vector& vec = *data(numSinglePrecisionFields + iField);
+    std::uint32_t* words = &bitPackedBondData[iField*numBitPackedWordsPerField];
+    for(int i=0 ; i<numPoints ; ++i)
+      setBondBit(words, i, vec[i] != 0.0);
   }
 }
 
@@ -110,6 +203,17 @@ vector<int> PeridigmNS::State::getFieldIds(PeridigmField::Relation relation,
     if(spec.getLength() == length && spec.getRelation() == relation)
       fieldIds.push_back(it->first);
   }
+  for(unsigned int i=0 ; i<singlePrecisionFieldIds.size() ; ++i){
+    PeridigmNS::FieldSpec spec = fieldManager.getFieldSpec(singlePrecisionFieldIds[i]);
+    if(spec.getLength() == length && spec.getRelation() == relation)
+      fieldIds.push_back(singlePrecisionFieldIds[i]);
+  }
+  for(unsigned int i=0 ; i<bitPackedFieldIds.size() ; ++i){
+    PeridigmNS::FieldSpec spec = fieldManager.getFieldSpec(bitPackedFieldIds[i]);
+    if(spec.getLength() == length && spec.getRelation() == relation)
+      fieldIds.push_back(bitPackedFieldIds[i]);
+  }
+  sort(fieldIds.begin(), fieldIds.end());
   return fieldIds;
 }
 
@@ -117,7 +221,7 @@ bool PeridigmNS::State::hasData(int fieldId)
 {
   std::map< int, Teuchos::RCP<Epetra_Vector> >::iterator lb = fieldIdToDataMap.lower_bound(fieldId);
   bool keyExists = ( lb != fieldIdToDataMap.end() && !(fieldIdToDataMap.key_comp()(fieldId, lb->first)) );
-  return keyExists;
+  return keyExists || isSinglePrecision(fieldId) || isBitPacked(fieldId);
 }
 
 Teuchos::RCP<Epetra_Vector> PeridigmNS::State::getData(int fieldId)
@@ -148,6 +252,15 @@ void PeridigmNS::State::copyLocallyOwnedDataFromState(Teuchos::RCP<PeridigmNS::S
                                "PeridigmNS::State::copyLocallyOwnedDataFromState() called with incompatible State.\n");
     copyLocallyOwnedMultiVectorData( *(source->getBondMultiVector()), *bondData );
   }
+
+  if(!compactBondMap.is_null()){
+    Teuchos::RCP<Epetra_MultiVector> sourceData = source->getCompactBondMultiVectorCopy();
+    TEUCHOS_TEST_FOR_EXCEPTION(sourceData.is_null(), Teuchos::NullReferenceError,
+                               "PeridigmNS::State::copyLocallyOwnedDataFromState() called with incompatible State.\n");
+    Teuchos::RCP<Epetra_MultiVector> targetData = getCompactBondMultiVectorCopy();
+    copyLocallyOwnedMultiVectorData( *sourceData, *targetData );
+    setCompactBondData( *targetData );
+  }
 }
 
 void PeridigmNS::State::writeStateData(Teuchos::RCP<PeridigmNS::State> source,  std::string stateName,  std::string blockName,  char const * path)
@@ -166,6 +279,11 @@ void PeridigmNS::State::writeStateData(Teuchos::RCP<PeridigmNS::State> source,
 	  EpetraExt::MultiVectorToMatrixMarketFile 	(restartStateFiles[VectorName].c_str(),
 			                 *(source->getBondMultiVector()),VectorName,"",true);
   }
+  if(!compactBondMap.is_null()){
+	  sprintf(VectorName,"%s%s_Compact",blockName.c_str(),stateName.c_str());
+	  EpetraExt::MultiVectorToMatrixMarketFile 	(restartStateFiles[VectorName].c_str(),
+			                 *(source->getCompactBondMultiVectorCopy()),VectorName,"",true);
+  }
 }
 void PeridigmNS::State::SetRestartFiles( std::string stateName, std::string blockName, char const * path)
 {
@@ -182,6 +300,11 @@ void PeridigmNS::State::SetRestartFiles( std::string stateName, std::string bloc
 		  sprintf(pathname,"%s/BondData_%s.mat",path,VectorName);
 		  restartStateFiles[VectorName] = pathname;
 	  }
+	  if(!compactBondMap.is_null()){
+		  sprintf(VectorName,"%s%s_Compact",blockName.c_str(),stateName.c_str());
+		  sprintf(pathname,"%s/BondData_%s.mat",path,VectorName);
+		  restartStateFiles[VectorName] = pathname;
+	  }
 }
 
 
@@ -203,6 +326,14 @@ void PeridigmNS::State::readStateData(Teuchos::RCP<PeridigmNS::State> source,  s
 	      EpetraExt::MatrixMarketFileToMultiVector(restartStateFiles[VectorName].c_str(),source->getBondMultiVector()->Map(), MultiVectorUpdate);
 	      copyLocallyOwnedMultiVectorData( *MultiVectorUpdate, *bondData );
 	  }
+
+	  if(!compactBondMap.is_null()){
+		  sprintf(VectorName,"%s%s_Compact",blockName.c_str(),stateName.c_str());
+	      EpetraExt::MatrixMarketFileToMultiVector(restartStateFiles[VectorName].c_str(),*compactBondMap, MultiVectorUpdate);
+	      Teuchos::RCP<Epetra_MultiVector> singlePrecisionUpdate = getCompactBondMultiVectorCopy();
+	      copyLocallyOwnedMultiVectorData( *MultiVectorUpdate, *singlePrecisionUpdate );
+	      setCompactBondData( *singlePrecisionUpdate );
+	  }
 }
 
 void PeridigmNS::State::copyLocallyOwnedMultiVectorData(Epetra_MultiVector& source, Epetra_MultiVector& target)
@@ -52,6 +52,8 @@
 #include <Epetra_Vector.h>
 #include "Peridigm_Field.hpp"
 #include <vector>
+#include <cstdint>
+#include <map>
 
 namespace PeridigmNS {
 
@@ -70,7 +72,8 @@ public:
   State() : 
     maxPointDataElementSize(9),
     numFieldIds(0),
-    pointData(std::vector< Teuchos::RCP<Epetra_MultiVector> >(maxPointDataElementSize)) {}
+    pointData(std::vector< Teuchos::RCP<Epetra_MultiVector> >(maxPointDataElementSize)),
+    numBitPackedWordsPerField(0) {}
 
   //! Copy constructor.
   State(const State& state) {}
@@ -88,8 +91,17 @@ public:
   **/
   void allocatePointData(PeridigmField::Length length, std::vector<int> fieldIds, Teuchos::RCP<const Epetra_BlockMap> map);
 
-  //! Allocates underlying Epetra_Multivector for bond data; only scalar bond data is supported.
-  void allocateBondData(std::vector<int> fieldIds, Teuchos::RCP<const Epetra_BlockMap> map);
+  /** \brief Allocates underlying storage for bond data; only scalar bond data is supported.
+  **
+  **  Field ids that also appear in singlePrecisionFieldIds are stored as single-precision (float) arrays
+  **  rather than in the Epetra_MultiVector, and must be accessed through getSinglePrecisionData().  Field ids
+  **  that appear in bitPackedFieldIds are stored as one bit per bond (e.g., binary bond damage) and must be
+  **  accessed through getBitPackedData(); bit packing takes precedence if a field appears in both lists.
+  **/
+  void allocateBondData(std::vector<int> fieldIds,
+                        Teuchos::RCP<const Epetra_BlockMap> map,
+                        std::vector<int> singlePrecisionFieldIds = std::vector<int>(),
+                        std::vector<int> bitPackedFieldIds = std::vector<int>());
 
   //@}
 
@@ -108,6 +120,21 @@ public:
   //! Accessor for underlying bond data Epetra_MultiVectors.
   Teuchos::RCP<Epetra_MultiVector> getBondMultiVector() { return bondData; }
 
+  //! Returns the field ids of bond data stored in single precision.
+  const std::vector<int>& getSinglePrecisionFieldIds() { return singlePrecisionFieldIds; }
+
+  //! Returns the field ids of bond data stored as one bit per bond.
+  const std::vector<int>& getBitPackedFieldIds() { return bitPackedFieldIds; }
+
+  /** \brief Returns a double-precision copy of the compact (single-precision and bit-packed) bond data; null if there is no such data.
+  **
+  **  The copy contains one vector for each single-precision field followed by one vector for each bit-packed field.
+  **/
+  Teuchos::RCP<Epetra_MultiVector> getCompactBondMultiVectorCopy();
+
+  //! Overwrites the compact bond data with values from a multivector laid out as in getCompactBondMultiVectorCopy(); nonzero values set bit-packed bonds.
+  void setCompactBondData(const Epetra_MultiVector& data);
+
   //@}
 
   //! Returns the list of field ids of the given relation and length; if no arguments are given, returns complete list of field ids.
@@ -120,6 +147,18 @@ public:
   //! Provides access to an Epetra_Vector corresponding to the given field id.
   Teuchos::RCP<Epetra_Vector> getData(int fieldId);
 
+  //! Returns true if the given field id is stored in single precision.
+  bool isSinglePrecision(int fieldId) { return singlePrecisionFieldIdToIndex.find(fieldId) != singlePrecisionFieldIdToIndex.end(); }
+
+  //! Provides access to single-precision bond data, indexed in the same way as the corresponding Epetra_Vector would be.
+  float* getSinglePrecisionData(int fieldId);
+
+  //! Returns true if the given field id is stored as one bit per bond.
+  bool isBitPacked(int fieldId) { return bitPackedFieldIdToIndex.find(fieldId) != bitPackedFieldIdToIndex.end(); }
+
+  //! Provides access to bit-packed bond data; the bit for bond i is bit i%32 of word i/32 (see Peridigm_BitPackedBondData.hpp).
+  std::uint32_t* getBitPackedData(int fieldId);
+
   //! Copies data from a different state object based on global IDs; functions only if all the local IDs in the target map exist in and are locally owned in the source map.
   void copyLocallyOwnedDataFromState(Teuchos::RCP<PeridigmNS::State> source);
 
@@ -152,6 +191,30 @@ protected:
   //! Epetra_MultiVector for bond data.
   Teuchos::RCP<Epetra_MultiVector> bondData;
 
+  //! Bond map for compact (single-precision and bit-packed) bond data.
+  Teuchos::RCP<const Epetra_BlockMap> compactBondMap;
+
+  //! Field ids of single-precision bond data, in storage order.
+  std::vector<int> singlePrecisionFieldIds;
+
+  //! Map that associates a single-precision field id with its position in singlePrecisionFieldIds.
+  std::map<int, int> singlePrecisionFieldIdToIndex;
+
+  //! Storage for single-precision bond data; fields are stored one after another, each of length compactBondMap->NumMyPoints().
+  std::vector<float> singlePrecisionBondData;
+
+  //! Field ids of bit-packed bond data, in storage order.
+  std::vector<int> bitPackedFieldIds;
+
+  //! Map that associates a bit-packed field id with its position in bitPackedFieldIds.
+  std::map<int, int> bitPackedFieldIdToIndex;
+
+  //! Number of words used to store each bit-packed field.
+  int numBitPackedWordsPerField;
+
+  //! Storage for bit-packed bond data; fields are stored one after another, each of length numBitPackedWordsPerField.
+  std::vector<std::uint32_t> bitPackedBondData;
+
   //! Map that associates a field id with an individual Epetra_Vector contained within one of the Epetra_MultiVectors.
   std::map< int, Teuchos::RCP<Epetra_Vector> > fieldIdToDataMap;
 
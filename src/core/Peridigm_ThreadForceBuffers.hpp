@@ -0,0 +1,188 @@
+/*! \file Peridigm_ThreadForceBuffers.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_THREADFORCEBUFFERS_HPP
+#define PERIDIGM_THREADFORCEBUFFERS_HPP
+
+#include <vector>
+#include <algorithm>
+#ifdef PERIDIGM_OPENMP
+  #include <omp.h>
+#endif
+
+namespace PeridigmNS {
+
+  /*! \brief Thread-private overlap force buffers for bond kernels that scatter reaction forces onto their neighbors.
+   *
+   *  Bond kernels exploit pair symmetry by adding the force on the owned point and subtracting it from the neighbor,
+   *  so two threads working on different owned points may write to the same neighbor.  This class partitions the owned
+   *  points into one contiguous range per thread, balanced by bond count, and provides each thread a private copy of
+   *  the overlap force vector.  The private copies are summed into the shared force vector once the bond loop is complete.
+   *  Without OpenMP there is a single thread and kernels should write directly to the shared force vector.
+   *
+   *  To opt in, a kernel must be split into a ...Range form that evaluates the owned points FirstPoint(thread) through
+   *  FirstPoint(thread)+NumPoints(thread)-1, with the neighborhood list and bond data advanced by NeighborhoodListOffset(thread)
+   *  and BondOffset(thread), and that writes reaction forces to the buffer passed in; see computeInternalForceLinearElasticRange()
+   *  and computeInternalForceIsotropicElasticPlasticRange().
+   *
+   *  The short-range contact models are not converted: their bond loop throws on an invalid neighbor, which cannot propagate
+   *  out of a parallel region.  There is no gather (symmetry-free) variant to compare against, since evaluating the neighbor's
+   *  half of a state-based bond requires the dilatation and weighted volume of ghosted points, which are not communicated
+   *  between the dilatation and force evaluations.
+   */
+  template<typename ScalarT>
+  class ThreadForceBuffers{
+
+  public:
+
+    //! Standard constructor.
+    ThreadForceBuffers() : numThreads(1), length(0) {}
+
+    //! Partitions the owned points among the available threads and sizes the buffers for an overlap vector of the given length.
+    void Setup(int numOwnedPoints, const int* neighborhoodList, int overlapVectorLength){
+      int maxThreads = 1;
+#ifdef PERIDIGM_OPENMP
+      maxThreads = omp_get_max_threads();
+#endif
+      Setup(numOwnedPoints, neighborhoodList, overlapVectorLength, maxThreads);
+    }
+
+    //! Partitions the owned points among at most maxThreads threads, at most one per owned point, and sizes the buffers.
+    void Setup(int numOwnedPoints, const int* neighborhoodList, int overlapVectorLength, int maxThreads){
+      numThreads = std::max(1, std::min(maxThreads, numOwnedPoints));
+      firstPoint.assign(numThreads+1, numOwnedPoints);
+      neighborhoodListOffset.assign(numThreads+1, 0);
+      bondOffset.assign(numThreads+1, 0);
+      firstPoint[0] = 0;
+      if(numThreads == 1)
+        return;
+
+      // The neighborhood list length is the number of bonds plus one entry per point
+      int neighborhoodListLength = 0;
+      for(int iID=0 ; iID<numOwnedPoints ; ++iID)
+        neighborhoodListLength += neighborhoodList[neighborhoodListLength] + 1;
+
+      // Start a new range each time the running neighborhood list length passes the next equal share
+      int thread = 1;
+      int neighborhoodListIndex = 0;
+      for(int iID=0 ; iID<numOwnedPoints && thread<numThreads ; ++iID){
+        if(neighborhoodListIndex >= (long)thread*neighborhoodListLength/numThreads){
+          firstPoint[thread] = iID;
+          neighborhoodListOffset[thread] = neighborhoodListIndex;
+          bondOffset[thread] = neighborhoodListIndex - iID;
+          thread++;
+        }
+        neighborhoodListIndex += neighborhoodList[neighborhoodListIndex] + 1;
+      }
+      for( ; thread<=numThreads ; ++thread){
+        neighborhoodListOffset[thread] = neighborhoodListLength;
+        bondOffset[thread] = neighborhoodListLength - numOwnedPoints;
+      }
+
+      length = overlapVectorLength;
+      if((int)buffers.size() < numThreads*length)
+        buffers.resize(numThreads*length);
+    }
+
+    //! Returns the number of threads among which the owned points are partitioned.
+    int NumThreads() const { return numThreads; }
+
+    //! Returns the local ID of the first owned point assigned to the given thread.
+    int FirstPoint(int thread) const { return firstPoint[thread]; }
+
+    //! Returns the number of owned points assigned to the given thread.
+    int NumPoints(int thread) const { return firstPoint[thread+1] - firstPoint[thread]; }
+
+    //! Returns the offset into the neighborhood list of the first owned point assigned to the given thread.
+    int NeighborhoodListOffset(int thread) const { return neighborhoodListOffset[thread]; }
+
+    //! Returns the offset into bond data of the first owned point assigned to the given thread.
+    int BondOffset(int thread) const { return bondOffset[thread]; }
+
+    //! Zeros and returns the private buffer of the given thread; call from within the thread so the memory is touched locally.
+    ScalarT* ClearedBuffer(int thread){
+      ScalarT* buffer = &buffers[thread*length];
+      std::fill(buffer, buffer+length, ScalarT(0.0));
+      return buffer;
+    }
+
+    //! Sums the private buffers into the given overlap vector.
+    void ReduceInto(ScalarT* target) const {
+#ifdef PERIDIGM_OPENMP
+      #pragma omp parallel for schedule(static)
+#endif
+      for(int i=0 ; i<length ; ++i){
+        ScalarT sum = buffers[i];
+        for(int thread=1 ; thread<numThreads ; ++thread)
+          sum += buffers[thread*length+i];
+        target[i] += sum;
+      }
+    }
+
+  protected:
+
+    //! Number of threads.
+    int numThreads;
+
+    //! Length of each buffer.
+    int length;
+
+    //! First owned point for each thread, with a trailing entry equal to the number of owned points.
+    std::vector<int> firstPoint;
+
+    //! Neighborhood list offset for each thread.
+    std::vector<int> neighborhoodListOffset;
+
+    //! Bond data offset for each thread.
+    std::vector<int> bondOffset;
+
+    //! Storage for all buffers, one after the other.
+    std::vector<ScalarT> buffers;
+  };
+}
+
+#endif // PERIDIGM_THREADFORCEBUFFERS_HPP
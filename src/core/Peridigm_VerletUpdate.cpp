@@ -0,0 +1,114 @@
+/*! \file Peridigm_VerletUpdate.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_VerletUpdate.hpp"
+#include <cmath>
+
+void PeridigmNS::VerletUpdatePositions(const int length,
+                                       const double dt,
+                                       const double* x,
+                                       const double* v,
+                                       double* u,
+                                       double* y)
+{
+#ifdef PERIDIGM_OPENMP
+  #pragma omp simd
+#endif
+  for(int i=0 ; i<length ; ++i){
+    double uNP1 = u[i] + dt*v[i];
+    u[i] = uNP1;
+    y[i] = x[i] + uNP1;
+  }
+}
+
+bool PeridigmNS::VerletUpdateAccelerationAndVelocity(const int numPoints,
+                                                     const double halfDt,
+                                                     const double* force,
+                                                     const double* externalForce,
+                                                     const double* density,
+                                                     double* a,
+                                                     double* v)
+{
+  int numNonFinite = 0;
+#ifdef PERIDIGM_OPENMP
+  #pragma omp simd reduction(+:numNonFinite)
+#endif
+  for(int i=0 ; i<numPoints ; ++i){
+    double inverseDensity = 1.0/density[i];
+    for(int dof=0 ; dof<3 ; ++dof){
+      double f = force[3*i+dof];
+      double fExt = externalForce[3*i+dof];
+      numNonFinite += (std::isfinite(f) && std::isfinite(fExt)) ? 0 : 1;
+      double acceleration = (f + fExt)*inverseDensity;
+      a[3*i+dof] = acceleration;
+      v[3*i+dof] += halfDt*acceleration;
+    }
+  }
+  return numNonFinite == 0;
+}
+
+bool PeridigmNS::VerletComputeAcceleration(const int numPoints,
+                                           const double* force,
+                                           const double* externalForce,
+                                           const double* density,
+                                           double* a)
+{
+  int numNonFinite = 0;
+#ifdef PERIDIGM_OPENMP
+  #pragma omp simd reduction(+:numNonFinite)
+#endif
+  for(int i=0 ; i<numPoints ; ++i){
+    double inverseDensity = 1.0/density[i];
+    for(int dof=0 ; dof<3 ; ++dof){
+      double f = force[3*i+dof];
+      double fExt = externalForce[3*i+dof];
+      numNonFinite += (std::isfinite(f) && std::isfinite(fExt)) ? 0 : 1;
+      a[3*i+dof] = (f + fExt)*inverseDensity;
+    }
+  }
+  return numNonFinite == 0;
+}
@@ -0,0 +1,90 @@
+/*! \file Peridigm_VerletUpdate.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_VERLETUPDATE_HPP
+#define PERIDIGM_VERLETUPDATE_HPP
+
+namespace PeridigmNS {
+
+/*! \brief Advances the positions and displacements by a full step of the midstep velocity.
+ *
+ *  Computes Y = X + U + dt*V and U = U + dt*V in a single pass over vectors of the given length.
+ */
+void VerletUpdatePositions(const int length,
+                           const double dt,
+                           const double* x,
+                           const double* v,
+                           double* u,
+                           double* y);
+
+/*! \brief Computes the acceleration.
+ *
+ *  Computes A = (F + F_ext)/density in a single pass over numPoints three-dimensional points.
+ *  Returns false if any entry of the force or external force is not finite.
+ */
+bool VerletComputeAcceleration(const int numPoints,
+                               const double* force,
+                               const double* externalForce,
+                               const double* density,
+                               double* a);
+
+/*! \brief Computes the acceleration and advances the velocity by a half step.
+ *
+ *  Computes A = (F + F_ext)/density and V = V + halfDt*A in a single pass over numPoints three-dimensional points.
+ *  Returns false if any entry of the force or external force is not finite.
+ */
+bool VerletUpdateAccelerationAndVelocity(const int numPoints,
+                                         const double halfDt,
+                                         const double* force,
+                                         const double* externalForce,
+                                         const double* density,
+                                         double* a,
+                                         double* v);
+
+}
+
+#endif // PERIDIGM_VERLETUPDATE_HPP
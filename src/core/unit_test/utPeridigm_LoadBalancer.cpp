@@ -0,0 +1,249 @@
+/*! \file utPeridigm_LoadBalancer.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#ifdef HAVE_MPI
+  #include <Epetra_MpiComm.h>
+#else
+  #include <Epetra_SerialComm.h>
+#endif
+#include "Peridigm_LoadBalancer.hpp"
+#include "Peridigm_ElasticMaterial.hpp"
+#include "Peridigm_Field.hpp"
+#include <vector>
+#include <set>
+
+using namespace std;
+using namespace Teuchos;
+using namespace PeridigmNS;
+
+namespace {
+
+  const int numPoints = 8;
+
+  //! Value stored in the bond data for the bond between the given points.
+  double bondValue(int globalId, int neighborGlobalId){
+    return 100.0*globalId + neighborGlobalId;
+  }
+
+  //! Checks the volume and bond data of a block against the values set by setBlockData().
+  bool checkBlockData(Block& block, double volumeScaleFactor){
+    FieldManager& fieldManager = FieldManager::self();
+    int volumeFieldId = fieldManager.getFieldId("Volume");
+    int bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+    RCP<const Epetra_BlockMap> overlapMap = block.getOverlapScalarPointMap();
+    RCP<NeighborhoodData> neighborhoodData = block.getNeighborhoodData();
+    Epetra_Vector& volume = *block.getData(volumeFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& bondDamage = *block.getData(bondDamageFieldId, PeridigmField::STEP_NP1);
+    bool isCorrect = true;
+    int neighborhoodListIndex(0), bondIndex(0);
+    const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+    for(int i=0 ; i<neighborhoodData->NumOwnedPoints() ; ++i){
+      int localId = neighborhoodData->OwnedIDs()[i];
+      int globalId = overlapMap->GID(localId);
+      if(volume[localId] != volumeScaleFactor*(globalId + 1))
+        isCorrect = false;
+      int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+      for(int j=0 ; j<numNeighbors ; ++j){
+        int neighborGlobalId = overlapMap->GID(neighborhoodList[neighborhoodListIndex++]);
+        if(bondDamage[bondIndex++] != bondValue(globalId, neighborGlobalId))
+          isCorrect = false;
+      }
+    }
+    return isCorrect;
+  }
+
+  //! Sets the volume of each owned point to a multiple of its global id, and the bond data to bondValue().
+  void setBlockData(Block& block, double volumeScaleFactor){
+    FieldManager& fieldManager = FieldManager::self();
+    int volumeFieldId = fieldManager.getFieldId("Volume");
+    int bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+    RCP<const Epetra_BlockMap> overlapMap = block.getOverlapScalarPointMap();
+    RCP<NeighborhoodData> neighborhoodData = block.getNeighborhoodData();
+    Epetra_Vector& volume = *block.getData(volumeFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& bondDamage = *block.getData(bondDamageFieldId, PeridigmField::STEP_NP1);
+    int neighborhoodListIndex(0), bondIndex(0);
+    const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+    for(int i=0 ; i<neighborhoodData->NumOwnedPoints() ; ++i){
+      int localId = neighborhoodData->OwnedIDs()[i];
+      int globalId = overlapMap->GID(localId);
+      volume[localId] = volumeScaleFactor*(globalId + 1);
+      int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+      for(int j=0 ; j<numNeighbors ; ++j)
+        bondDamage[bondIndex++] = bondValue(globalId, overlapMap->GID(neighborhoodList[neighborhoodListIndex++]));
+    }
+  }
+}
+
+//! Output in the initial decomposition is written from copies of rebalanced blocks, without migrating the blocks.
+TEUCHOS_UNIT_TEST(LoadBalancer, InitialDecompositionBlocks) {
+
+  RCP<Epetra_Comm> comm;
+  #ifdef HAVE_MPI
+    comm = rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+  #else
+    comm = rcp(new Epetra_SerialComm);
+  #endif
+  int numProcs = comm->NumProc();
+  int myPID = comm->MyPID();
+
+  // A row of points with nearest-neighbor bonds, initially distributed round-robin so that
+  // recursive coordinate bisection will move points when run on more than one processor
+  vector<int> ownedGlobalIds;
+  for(int globalId=myPID ; globalId<numPoints ; globalId+=numProcs)
+    ownedGlobalIds.push_back(globalId);
+  int numOwned = static_cast<int>(ownedGlobalIds.size());
+
+  set<int> ghosts;
+  for(int i=0 ; i<numOwned ; ++i){
+    if(ownedGlobalIds[i] > 0)
+      ghosts.insert(ownedGlobalIds[i] - 1);
+    if(ownedGlobalIds[i] < numPoints - 1)
+      ghosts.insert(ownedGlobalIds[i] + 1);
+  }
+  for(int i=0 ; i<numOwned ; ++i)
+    ghosts.erase(ownedGlobalIds[i]);
+  vector<int> overlapGlobalIds(ownedGlobalIds);
+  overlapGlobalIds.insert(overlapGlobalIds.end(), ghosts.begin(), ghosts.end());
+  int numOverlap = static_cast<int>(overlapGlobalIds.size());
+
+  RCP<Epetra_BlockMap> ownedScalarPointMap = rcp(new Epetra_BlockMap(-1, numOwned, &ownedGlobalIds[0], 1, 0, *comm));
+  RCP<Epetra_BlockMap> ownedVectorPointMap = rcp(new Epetra_BlockMap(-1, numOwned, &ownedGlobalIds[0], 3, 0, *comm));
+  RCP<Epetra_BlockMap> overlapScalarPointMap = rcp(new Epetra_BlockMap(-1, numOverlap, &overlapGlobalIds[0], 1, 0, *comm));
+  RCP<Epetra_BlockMap> overlapVectorPointMap = rcp(new Epetra_BlockMap(-1, numOverlap, &overlapGlobalIds[0], 3, 0, *comm));
+
+  RCP<NeighborhoodData> neighborhoodData = rcp(new NeighborhoodData);
+  neighborhoodData->SetNumOwned(numOwned);
+  vector<int> neighborhoodList;
+  vector<int> numBonds(numOwned);
+  for(int i=0 ; i<numOwned ; ++i){
+    int globalId = ownedGlobalIds[i];
+    neighborhoodData->OwnedIDs()[i] = i;
+    neighborhoodData->NeighborhoodPtr()[i] = static_cast<int>(neighborhoodList.size());
+    vector<int> neighbors;
+    if(globalId > 0)
+      neighbors.push_back(overlapScalarPointMap->LID(globalId - 1));
+    if(globalId < numPoints - 1)
+      neighbors.push_back(overlapScalarPointMap->LID(globalId + 1));
+    numBonds[i] = static_cast<int>(neighbors.size());
+    neighborhoodList.push_back(numBonds[i]);
+    neighborhoodList.insert(neighborhoodList.end(), neighbors.begin(), neighbors.end());
+  }
+  neighborhoodData->SetNeighborhoodListSize(static_cast<int>(neighborhoodList.size()));
+  for(unsigned int i=0 ; i<neighborhoodList.size() ; ++i)
+    neighborhoodData->NeighborhoodList()[i] = neighborhoodList[i];
+
+  RCP<Epetra_BlockMap> ownedScalarBondMap = rcp(new Epetra_BlockMap(-1, numOwned, &ownedGlobalIds[0], &numBonds[0], 0, *comm));
+
+  RCP<Epetra_Vector> blockIds = rcp(new Epetra_Vector(*ownedScalarPointMap));
+  blockIds->PutScalar(1.0);
+  RCP<Epetra_Vector> modelCoordinates = rcp(new Epetra_Vector(*ownedVectorPointMap));
+  for(int i=0 ; i<numOwned ; ++i)
+    (*modelCoordinates)[3*i] = ownedGlobalIds[i];
+
+  // A single block with an elastic material, which stores the volume and the bond damage
+  ParameterList materialParams;
+  materialParams.set("Density", 7800.0);
+  materialParams.set("Bulk Modulus", 130.0e9);
+  materialParams.set("Shear Modulus", 78.0e9);
+  materialParams.set("Horizon", 1.5);
+  ParameterList blockParams;
+  RCP< vector<Block> > blocks = rcp(new vector<Block>);
+  blocks->push_back(Block("block_1", 1, blockParams));
+  Block& block = (*blocks)[0];
+  block.setMaterialModel(rcp(new ElasticMaterial(materialParams)));
+  block.initialize(ownedScalarPointMap, overlapScalarPointMap, ownedVectorPointMap, overlapVectorPointMap,
+                   ownedScalarBondMap, blockIds, neighborhoodData);
+  setBlockData(block, 1.0);
+
+  ParameterList loadBalancingParams;
+  LoadBalancer loadBalancer(loadBalancingParams, ownedScalarPointMap, overlapScalarPointMap, ownedVectorPointMap,
+                            overlapVectorPointMap, ownedScalarBondMap, blockIds, neighborhoodData, modelCoordinates);
+
+  // Prior to a rebalance, output is written directly from the blocks
+  TEST_ASSERT(loadBalancer.initialDecompositionBlocks(blocks).get() == blocks.get());
+
+  loadBalancer.rebalance(blocks);
+  TEST_ASSERT(loadBalancer.isRebalanced());
+  TEST_EQUALITY(block.getDataManager()->getRebalanceCount(), 1);
+  TEST_ASSERT(checkBlockData(block, 1.0));
+  if(numProcs == 2)
+    TEST_ASSERT(!block.getOwnedScalarPointMap()->SameAs(*ownedScalarPointMap));
+
+  // Each output step copies the current data to the initial decomposition, the block is not migrated
+  for(int outputStep=2 ; outputStep<4 ; ++outputStep){
+    setBlockData(block, outputStep);
+    RCP< vector<Block> > outputBlocks = loadBalancer.initialDecompositionBlocks(blocks);
+    TEST_ASSERT(outputBlocks.get() != blocks.get());
+    TEST_EQUALITY(static_cast<int>(outputBlocks->size()), 1);
+    TEST_EQUALITY(block.getDataManager()->getRebalanceCount(), 1);
+    TEST_EQUALITY((*outputBlocks)[0].getDataManager()->getRebalanceCount(), 0);
+    TEST_EQUALITY(loadBalancer.getRebalanceCount(), 1);
+    TEST_ASSERT(loadBalancer.isRebalanced());
+    TEST_ASSERT((*outputBlocks)[0].getOwnedScalarPointMap()->SameAs(*ownedScalarPointMap));
+    TEST_ASSERT(checkBlockData((*outputBlocks)[0], outputStep));
+  }
+
+  // The copies hold the same data as the block returned to the initial decomposition
+  RCP< vector<Block> > outputBlocks = loadBalancer.initialDecompositionBlocks(blocks);
+  loadBalancer.restoreInitialDecomposition(blocks);
+  TEST_EQUALITY(block.getDataManager()->getRebalanceCount(), 2);
+  TEST_ASSERT(block.getOwnedScalarPointMap()->SameAs(*(*outputBlocks)[0].getOwnedScalarPointMap()));
+  TEST_ASSERT(block.getOwnedScalarBondMap()->SameAs(*(*outputBlocks)[0].getOwnedScalarBondMap()));
+  TEST_ASSERT(checkBlockData(block, 3.0));
+}
+
+int main
+(int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
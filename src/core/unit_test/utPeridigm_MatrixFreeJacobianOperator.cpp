@@ -0,0 +1,202 @@
+/*! \file utPeridigm_MatrixFreeJacobianOperator.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#include <Epetra_FECrsMatrix.h>
+#include "Peridigm.hpp"
+#include "Peridigm_MatrixFreeJacobianOperator.hpp"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace Teuchos;
+using namespace PeridigmNS;
+
+//! Creates a quasi-static model on a 3x2x2 grid with the x displacement of three points prescribed.
+Teuchos::RCP<Peridigm> createTwelvePointModel() {
+
+  // set up parameter lists
+  // these data would normally be read from an input xml file
+  Teuchos::RCP<Teuchos::ParameterList> peridigmParams = rcp(new Teuchos::ParameterList());
+
+  // material parameters
+  Teuchos::ParameterList& materialParams = peridigmParams->sublist("Materials");
+  Teuchos::ParameterList& elasticMaterialParams = materialParams.sublist("My Elastic Material");
+  elasticMaterialParams.set("Material Model", "Elastic");
+  elasticMaterialParams.set("Density", 7800.0);
+  elasticMaterialParams.set("Bulk Modulus", 130.0e9);
+  elasticMaterialParams.set("Shear Modulus", 78.0e9);
+
+  // blocks
+  Teuchos::ParameterList& blockParams = peridigmParams->sublist("Blocks");
+  Teuchos::ParameterList& blockOneParams = blockParams.sublist("My Group of Blocks");
+  blockOneParams.set("Block Names", "block_1");
+  blockOneParams.set("Material", "My Elastic Material");
+  blockOneParams.set("Horizon", 1.8);
+
+  // Set up discretization parameterlist
+  Teuchos::ParameterList& discretizationParams = peridigmParams->sublist("Discretization");
+  discretizationParams.set("Type", "PdQuickGrid");
+
+  // pdQuickGrid tensor product mesh generator parameters
+  Teuchos::ParameterList& pdQuickGridParams = discretizationParams.sublist("TensorProduct3DMeshGenerator");
+  pdQuickGridParams.set("Type", "PdQuickGrid");
+  pdQuickGridParams.set("X Origin",  0.0);
+  pdQuickGridParams.set("Y Origin",  0.0);
+  pdQuickGridParams.set("Z Origin",  0.0);
+  pdQuickGridParams.set("X Length",  3.0);
+  pdQuickGridParams.set("Y Length",  2.0);
+  pdQuickGridParams.set("Z Length",  2.0);
+  pdQuickGridParams.set("Number Points X", 3);
+  pdQuickGridParams.set("Number Points Y", 2);
+  pdQuickGridParams.set("Number Points Z", 2);
+
+  // boundary conditions
+  Teuchos::ParameterList& bcParams = peridigmParams->sublist("Boundary Conditions");
+  bcParams.set("Node Set One", "1 2 3");
+  Teuchos::ParameterList& prescribedDisplacementParams = bcParams.sublist("Prescribed Displacement");
+  prescribedDisplacementParams.set("Type", "Prescribed Displacement");
+  prescribedDisplacementParams.set("Node Set", "Node Set One");
+  prescribedDisplacementParams.set("Coordinate", "x");
+  prescribedDisplacementParams.set("Value", "0.0");
+
+  // quasi-static solver, which allocates the tangent
+  Teuchos::ParameterList& solverParams = peridigmParams->sublist("Solver");
+  solverParams.set("Initial Time", 0.0);
+  solverParams.set("Final Time", 1.0);
+  solverParams.sublist("QuasiStatic");
+
+  Teuchos::RCP<Discretization> nullDiscretization;
+  Teuchos::RCP<Peridigm> peridigm = Teuchos::rcp(new Peridigm(MPI_COMM_WORLD, peridigmParams, nullDiscretization));
+
+  return peridigm;
+}
+
+//! Compares the matrix-free tangent to the assembled tangent, including the rows and columns of the kinematic B.C.
+TEUCHOS_UNIT_TEST(MatrixFreeJacobianOperator, ApplyMatchesAssembledTangent) {
+
+  Teuchos::RCP<Peridigm> peridigm = createTwelvePointModel();
+
+  double dt = 1.0;
+  peridigm->setTimeStep(dt);
+
+  // apply a nonuniform displacement increment
+  Epetra_Vector& x = *peridigm->getX();
+  Epetra_Vector& u = *peridigm->getU();
+  Epetra_Vector& y = *peridigm->getY();
+  Epetra_Vector& v = *peridigm->getV();
+  Epetra_Vector& deltaU = *peridigm->getDeltaU();
+  for(int i=0 ; i<x.MyLength()/3 ; ++i){
+    deltaU[3*i]   = 0.002*x[3*i] + 0.001*x[3*i+1];
+    deltaU[3*i+1] = -0.001*x[3*i+1];
+    deltaU[3*i+2] = 0.0005*x[3*i]*x[3*i+2];
+  }
+  for(int i=0 ; i<x.MyLength() ; ++i){
+    y[i] = x[i] + u[i] + deltaU[i];
+    v[i] = deltaU[i]/dt;
+  }
+
+  // assembled tangent, treated as in the quasi-static solver
+  Teuchos::RCP<const Epetra_FECrsMatrix> tangent = peridigm->getTangentStiffnessMatrix();
+  peridigm->evaluateTangentStiffnessMatrix();
+  Teuchos::RCP<Epetra_FECrsMatrix> assembledTangent = Teuchos::rcp(new Epetra_FECrsMatrix(*tangent));
+  peridigm->getBoundaryAndInitialConditionManager()->applyKinematicBC_InsertZerosAndSetDiagonal(assembledTangent);
+  assembledTangent->Scale(-1.0);
+
+  Teuchos::RCP<Epetra_Vector> kinematicBCDiagonal = Teuchos::rcp(new Epetra_Vector(assembledTangent->RowMap()));
+  Teuchos::RCP<Epetra_Vector> nonKinematicBCDiagonal = Teuchos::rcp(new Epetra_Vector(assembledTangent->RowMap()));
+  assembledTangent->ExtractDiagonalCopy(*kinematicBCDiagonal);
+  *nonKinematicBCDiagonal = *kinematicBCDiagonal;
+  peridigm->getBoundaryAndInitialConditionManager()->applyKinematicBC_InsertZeros(nonKinematicBCDiagonal);
+  kinematicBCDiagonal->Update(-1.0, *nonKinematicBCDiagonal, 1.0);
+
+  Teuchos::RCP<Epetra_Vector> residual = Teuchos::rcp(new Epetra_Vector(assembledTangent->RowMap()));
+  peridigm->computeQuasiStaticResidual(residual);
+
+  double deltaUNorm;
+  deltaU.Norm2(&deltaUNorm);
+  MatrixFreeJacobianOperator matrixFreeJacobian(peridigm.get(), Teuchos::rcp(new Epetra_Map(assembledTangent->RowMap())), 1.0e-7);
+  matrixFreeJacobian.setBaseResidual(residual);
+  matrixFreeJacobian.setKinematicBCDiagonal(kinematicBCDiagonal);
+  matrixFreeJacobian.setSolutionNorm(deltaUNorm);
+
+  // the direction has nonzero entries for the prescribed degrees of freedom
+  Epetra_Vector direction(assembledTangent->RowMap());
+  direction.Random();
+  Epetra_Vector matrixFreeProduct(assembledTangent->RowMap());
+  Epetra_Vector assembledProduct(assembledTangent->RowMap());
+  Epetra_Vector deltaUCopy(deltaU);
+  TEST_EQUALITY(matrixFreeJacobian.Apply(direction, matrixFreeProduct), 0);
+  TEST_EQUALITY(assembledTangent->Multiply(false, direction, assembledProduct), 0);
+  TEST_EQUALITY(matrixFreeJacobian.getNumApplications(), 1);
+
+  double assembledProductNorm;
+  assembledProduct.NormInf(&assembledProductNorm);
+  TEST_COMPARE(assembledProductNorm, >, 0.0);
+  double localMaxDifference(0.0), maxDifference(0.0);
+  for(int i=0 ; i<assembledProduct.MyLength() ; ++i)
+    localMaxDifference = std::max(localMaxDifference, std::abs(matrixFreeProduct[i] - assembledProduct[i]));
+  assembledTangent->Comm().MaxAll(&localMaxDifference, &maxDifference, 1);
+  TEST_COMPARE(maxDifference, <=, 1.0e-5*assembledProductNorm);
+
+  // the state is restored exactly
+  for(int i=0 ; i<deltaU.MyLength() ; ++i){
+    TEST_EQUALITY(deltaU[i], deltaUCopy[i]);
+    TEST_EQUALITY(y[i], x[i] + u[i] + deltaU[i]);
+  }
+}
+
+int main
+(int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
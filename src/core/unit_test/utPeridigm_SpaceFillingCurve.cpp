@@ -0,0 +1,124 @@
+/*! \file utPeridigm_SpaceFillingCurve.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_SpaceFillingCurve.hpp"
+#include <vector>
+#include <cstdlib>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+
+using namespace PeridigmNS;
+using namespace std;
+
+//! Points on a regular 4x4x4 lattice, listed in lexicographic order.
+vector<double> createLattice()
+{
+  vector<double> coordinates;
+  for(int i=0 ; i<4 ; ++i){
+    for(int j=0 ; j<4 ; ++j){
+      for(int k=0 ; k<4 ; ++k){
+        coordinates.push_back(i);
+        coordinates.push_back(j);
+        coordinates.push_back(k);
+      }
+    }
+  }
+  return coordinates;
+}
+
+TEUCHOS_UNIT_TEST(SpaceFillingCurve, MortonKey) {
+  TEST_EQUALITY( SpaceFillingCurve::mortonKey(0, 0, 0), (uint64_t)0 );
+  TEST_EQUALITY( SpaceFillingCurve::mortonKey(0, 0, 1), (uint64_t)1 );
+  TEST_EQUALITY( SpaceFillingCurve::mortonKey(0, 1, 0), (uint64_t)2 );
+  TEST_EQUALITY( SpaceFillingCurve::mortonKey(1, 0, 0), (uint64_t)4 );
+  TEST_EQUALITY( SpaceFillingCurve::mortonKey(1, 1, 1), (uint64_t)7 );
+  TEST_EQUALITY( SpaceFillingCurve::mortonKey(2, 0, 0), (uint64_t)32 );
+}
+
+TEUCHOS_UNIT_TEST(SpaceFillingCurve, HilbertOrderIsContinuous) {
+
+  vector<double> coordinates = createLattice();
+  int numPoints = coordinates.size()/3;
+
+  vector<int> order;
+  SpaceFillingCurve::computeOrder(SpaceFillingCurve::HILBERT, &coordinates[0], numPoints, order);
+  TEST_EQUALITY( (int)order.size(), numPoints );
+
+  // Every point must appear exactly once
+  vector<int> count(numPoints, 0);
+  for(int i=0 ; i<numPoints ; ++i)
+    count[order[i]] += 1;
+  for(int i=0 ; i<numPoints ; ++i)
+    TEST_EQUALITY( count[i], 1 );
+
+  // Consecutive points along a Hilbert curve are nearest neighbors on the lattice
+  for(int i=1 ; i<numPoints ; ++i){
+    int a = order[i-1];
+    int b = order[i];
+    double distance = 0.0;
+    for(int dof=0 ; dof<3 ; ++dof)
+      distance += std::abs(coordinates[3*a+dof] - coordinates[3*b+dof]);
+    TEST_FLOATING_EQUALITY( distance, 1.0, 1.0e-14 );
+  }
+}
+
+TEUCHOS_UNIT_TEST(SpaceFillingCurve, NoneIsIdentity) {
+
+  vector<double> coordinates = createLattice();
+  int numPoints = coordinates.size()/3;
+
+  vector<int> order;
+  SpaceFillingCurve::computeOrder(SpaceFillingCurve::NONE, &coordinates[0], numPoints, order);
+  for(int i=0 ; i<numPoints ; ++i)
+    TEST_EQUALITY( order[i], i );
+}
+
+int main( int argc, char* argv[] ) {
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
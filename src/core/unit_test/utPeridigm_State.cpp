@@ -9,6 +9,7 @@
 #include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
 #include <Epetra_SerialComm.h>
 #include "Peridigm_State.hpp"
+#include "Peridigm_BitPackedBondData.hpp"
 #include <vector>
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_UnitTestHarness.hpp>
@@ -545,6 +546,135 @@ TEUCHOS_UNIT_TEST(State, CopyFrom) {
 
 
 
+//! Store one bond field in single precision, check allocation and the double-precision round trip.
+
+TEUCHOS_UNIT_TEST(State, SinglePrecisionBondData) {
+
+  Teuchos::RCP<Epetra_Comm> comm;
+
+  #ifdef HAVE_MPI
+    comm = rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+  #else
+    comm = rcp(new Epetra_SerialComm);
+  #endif
+
+  // two points, each with a single bond
+  int numGlobalElements(2), numMyElements(2), indexBase(0);
+  std::vector<int> myGlobalElements(numMyElements);
+  for(int i=0; i<numMyElements ; ++i)
+    myGlobalElements[i] = i;
+  std::vector<int> bondElementSize(numMyElements, 1);
+  Teuchos::RCP<Epetra_BlockMap> ownedScalarBondMap =
+    Teuchos::rcp(new Epetra_BlockMap(numGlobalElements, numMyElements, &myGlobalElements[0], &bondElementSize[0], indexBase, *comm));
+
+  FieldManager& fm = FieldManager::self();
+  int bondDamageFieldId = fm.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Bond_Damage");
+  int plasticExtensionFieldId = fm.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Deviatoric_Plastic_Extension");
+  vector<int> bondFieldIds;
+  bondFieldIds.push_back(bondDamageFieldId);
+  bondFieldIds.push_back(plasticExtensionFieldId);
+  vector<int> singlePrecisionFieldIds(1, bondDamageFieldId);
+
+  PeridigmNS::State state;
+  state.allocateBondData(bondFieldIds, ownedScalarBondMap, singlePrecisionFieldIds);
+
+  // only the double-precision field is stored in the multivector
+  TEST_EQUALITY( state.getBondMultiVector()->NumVectors(), 1 );
+  TEST_ASSERT( state.hasData(bondDamageFieldId) );
+  TEST_ASSERT( state.hasData(plasticExtensionFieldId) );
+  TEST_ASSERT( state.isSinglePrecision(bondDamageFieldId) );
+  TEST_ASSERT( !state.isSinglePrecision(plasticExtensionFieldId) );
+  TEST_EQUALITY( (int)state.getFieldIds(PeridigmField::BOND, PeridigmField::SCALAR).size(), 2 );
+
+  // data is initialized to zero
+  float* bondDamage = state.getSinglePrecisionData(bondDamageFieldId);
+  for(int i=0 ; i<ownedScalarBondMap->NumMyPoints() ; ++i)
+    TEST_EQUALITY_CONST( bondDamage[i], 0.0f );
+
+  // round trip through the double-precision copy
+  bondDamage[0] = 1.0f;
+  bondDamage[1] = 0.25f;
+  Teuchos::RCP<Epetra_MultiVector> copy = state.getCompactBondMultiVectorCopy();
+  TEST_EQUALITY( copy->NumVectors(), 1 );
+  TEST_FLOATING_EQUALITY( (*copy)[0][0], 1.0, 1.0e-15 );
+  TEST_FLOATING_EQUALITY( (*copy)[0][1], 0.25, 1.0e-15 );
+  (*copy)[0][1] = 0.5;
+  state.setCompactBondData(*copy);
+  TEST_EQUALITY_CONST( state.getSinglePrecisionData(bondDamageFieldId)[1], 0.5f );
+}
+
+//! Store one bond field as one bit per bond alongside a single-precision field, check the layout of the compact data copy.
+
+TEUCHOS_UNIT_TEST(State, BitPackedBondData) {
+
+  Teuchos::RCP<Epetra_Comm> comm;
+
+  #ifdef HAVE_MPI
+    comm = rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+  #else
+    comm = rcp(new Epetra_SerialComm);
+  #endif
+
+  // two points with 40 and 3 bonds, so the bit-packed data spans two words
+  int numGlobalElements(2), numMyElements(2), indexBase(0);
+  std::vector<int> myGlobalElements(numMyElements);
+  for(int i=0; i<numMyElements ; ++i)
+    myGlobalElements[i] = i;
+  std::vector<int> bondElementSize(numMyElements);
+  bondElementSize[0] = 40;
+  bondElementSize[1] = 3;
+  Teuchos::RCP<Epetra_BlockMap> ownedScalarBondMap =
+    Teuchos::rcp(new Epetra_BlockMap(numGlobalElements, numMyElements, &myGlobalElements[0], &bondElementSize[0], indexBase, *comm));
+
+  FieldManager& fm = FieldManager::self();
+  int bondDamageFieldId = fm.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Bond_Damage");
+  int plasticExtensionFieldId = fm.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Deviatoric_Plastic_Extension");
+  vector<int> bondFieldIds;
+  bondFieldIds.push_back(bondDamageFieldId);
+  bondFieldIds.push_back(plasticExtensionFieldId);
+
+  // bit packing takes precedence when a field is requested in both formats
+  vector<int> singlePrecisionFieldIds(bondFieldIds);
+  vector<int> bitPackedFieldIds(1, bondDamageFieldId);
+
+  PeridigmNS::State state;
+  state.allocateBondData(bondFieldIds, ownedScalarBondMap, singlePrecisionFieldIds, bitPackedFieldIds);
+
+  TEST_ASSERT( state.getBondMultiVector().is_null() );
+  TEST_ASSERT( state.isBitPacked(bondDamageFieldId) );
+  TEST_ASSERT( !state.isSinglePrecision(bondDamageFieldId) );
+  TEST_ASSERT( state.isSinglePrecision(plasticExtensionFieldId) );
+  TEST_ASSERT( state.hasData(bondDamageFieldId) );
+
+  // set a few bonds, including bonds in the second word
+  std::uint32_t* bondDamage = state.getBitPackedData(bondDamageFieldId);
+  setBondBit(bondDamage, 0, true);
+  setBondBit(bondDamage, 31, true);
+  setBondBit(bondDamage, 32, true);
+  setBondBit(bondDamage, 42, true);
+  setBondBit(bondDamage, 32, false);
+  TEST_ASSERT( testBondBit(bondDamage, 0) );
+  TEST_ASSERT( !testBondBit(bondDamage, 1) );
+  TEST_ASSERT( !testBondBit(bondDamage, 32) );
+  TEST_EQUALITY_CONST( BitPackedBondView(bondDamage)[42], 1.0 );
+
+  // the copy holds the single-precision fields followed by the bit-packed fields
+  Teuchos::RCP<Epetra_MultiVector> copy = state.getCompactBondMultiVectorCopy();
+  TEST_EQUALITY( copy->NumVectors(), 2 );
+  for(int i=0 ; i<ownedScalarBondMap->NumMyPoints() ; ++i){
+    double expected = (i == 0 || i == 31 || i == 42) ? 1.0 : 0.0;
+    TEST_EQUALITY( (*copy)[1][i], expected );
+  }
+
+  // nonzero values set bits on the way back
+  (*copy)[1][0] = 0.0;
+  (*copy)[1][5] = 1.0;
+  state.setCompactBondData(*copy);
+  TEST_ASSERT( !testBondBit(bondDamage, 0) );
+  TEST_ASSERT( testBondBit(bondDamage, 5) );
+  TEST_ASSERT( testBondBit(bondDamage, 42) );
+}
+
 int main( int argc, char* argv[] ) {
 
     int numProcs = 1;
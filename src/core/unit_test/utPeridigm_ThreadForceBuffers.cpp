@@ -0,0 +1,168 @@
+/*! \file utPeridigm_ThreadForceBuffers.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+
+#include "Peridigm_ThreadForceBuffers.hpp"
+#include <vector>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+
+using namespace PeridigmNS;
+using namespace std;
+
+//! Neighborhood list for ten owned points, two of which hold nearly all of the bonds and several of which have none.
+vector<int> createIrregularNeighborhoodList(vector<int>& numNeighbors)
+{
+  int counts[10] = {0, 0, 40, 0, 1, 0, 0, 35, 0, 2};
+  numNeighbors.assign(counts, counts+10);
+  vector<int> neighborhoodList;
+  for(unsigned int iID=0 ; iID<numNeighbors.size() ; ++iID){
+    neighborhoodList.push_back(numNeighbors[iID]);
+    for(int iNID=0 ; iNID<numNeighbors[iID] ; ++iNID)
+      neighborhoodList.push_back((iID + iNID + 1) % 12);
+  }
+  return neighborhoodList;
+}
+
+//! Requires the ranges to cover the owned points in order and the offsets to match a serial walk of the neighborhood list.
+void checkPartition(const ThreadForceBuffers<double>& buffers,
+                    const vector<int>& numNeighbors,
+                    Teuchos::FancyOStream& out,
+                    bool& success)
+{
+  int numOwnedPoints = numNeighbors.size();
+
+  // neighborhood list and bond offsets of each owned point, with a trailing entry for the end of the list
+  vector<int> neighborhoodListOffset(numOwnedPoints+1, 0), bondOffset(numOwnedPoints+1, 0);
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+    neighborhoodListOffset[iID+1] = neighborhoodListOffset[iID] + numNeighbors[iID] + 1;
+    bondOffset[iID+1] = bondOffset[iID] + numNeighbors[iID];
+  }
+
+  TEST_EQUALITY(buffers.FirstPoint(0), 0);
+  int numPoints = 0;
+  for(int thread=0 ; thread<buffers.NumThreads() ; ++thread){
+    int firstPoint = buffers.FirstPoint(thread);
+    TEST_COMPARE(buffers.NumPoints(thread), >=, 0);
+    TEST_EQUALITY(firstPoint, numPoints);
+    TEST_EQUALITY(buffers.NeighborhoodListOffset(thread), neighborhoodListOffset[firstPoint]);
+    TEST_EQUALITY(buffers.BondOffset(thread), bondOffset[firstPoint]);
+    numPoints += buffers.NumPoints(thread);
+  }
+  TEST_EQUALITY(numPoints, numOwnedPoints);
+}
+
+TEUCHOS_UNIT_TEST(ThreadForceBuffers, SingleThread) {
+  vector<int> numNeighbors;
+  vector<int> neighborhoodList = createIrregularNeighborhoodList(numNeighbors);
+  ThreadForceBuffers<double> buffers;
+  buffers.Setup(numNeighbors.size(), &neighborhoodList[0], 36, 1);
+  TEST_EQUALITY(buffers.NumThreads(), 1);
+  TEST_EQUALITY(buffers.NumPoints(0), 10);
+  checkPartition(buffers, numNeighbors, out, success);
+}
+
+//! Tests a partition with more threads than points that carry bonds.
+TEUCHOS_UNIT_TEST(ThreadForceBuffers, MoreThreadsThanHeavyPoints) {
+  vector<int> numNeighbors;
+  vector<int> neighborhoodList = createIrregularNeighborhoodList(numNeighbors);
+  ThreadForceBuffers<double> buffers;
+  buffers.Setup(numNeighbors.size(), &neighborhoodList[0], 36, 6);
+  TEST_EQUALITY(buffers.NumThreads(), 6);
+  checkPartition(buffers, numNeighbors, out, success);
+  // the two heavy points fall in different ranges
+  int heavyPointThread[2] = {-1, -1};
+  for(int thread=0 ; thread<buffers.NumThreads() ; ++thread){
+    if(buffers.FirstPoint(thread) <= 2 && 2 < buffers.FirstPoint(thread) + buffers.NumPoints(thread))
+      heavyPointThread[0] = thread;
+    if(buffers.FirstPoint(thread) <= 7 && 7 < buffers.FirstPoint(thread) + buffers.NumPoints(thread))
+      heavyPointThread[1] = thread;
+  }
+  TEST_COMPARE(heavyPointThread[0], >=, 0);
+  TEST_COMPARE(heavyPointThread[1], >, heavyPointThread[0]);
+}
+
+//! Tests a partition in which the trailing ranges are empty; the thread count is capped at one per owned point.
+TEUCHOS_UNIT_TEST(ThreadForceBuffers, EmptyRanges) {
+  vector<int> numNeighbors;
+  vector<int> neighborhoodList = createIrregularNeighborhoodList(numNeighbors);
+  ThreadForceBuffers<double> buffers;
+  buffers.Setup(numNeighbors.size(), &neighborhoodList[0], 36, 16);
+  TEST_EQUALITY(buffers.NumThreads(), 10);
+  checkPartition(buffers, numNeighbors, out, success);
+  int numEmptyRanges = 0;
+  for(int thread=0 ; thread<buffers.NumThreads() ; ++thread){
+    if(buffers.NumPoints(thread) == 0){
+      numEmptyRanges += 1;
+      TEST_EQUALITY(buffers.FirstPoint(thread), 10);
+    }
+  }
+  TEST_COMPARE(numEmptyRanges, >, 0);
+}
+
+TEUCHOS_UNIT_TEST(ThreadForceBuffers, ReduceInto) {
+  vector<int> numNeighbors;
+  vector<int> neighborhoodList = createIrregularNeighborhoodList(numNeighbors);
+  ThreadForceBuffers<double> buffers;
+  int length = 36;
+  buffers.Setup(numNeighbors.size(), &neighborhoodList[0], length, 4);
+  for(int thread=0 ; thread<buffers.NumThreads() ; ++thread){
+    double* buffer = buffers.ClearedBuffer(thread);
+    for(int i=0 ; i<length ; ++i)
+      buffer[i] = (thread+1)*i;
+  }
+  vector<double> target(length, 1.0);
+  buffers.ReduceInto(&target[0]);
+  for(int i=0 ; i<length ; ++i)
+    TEST_EQUALITY(target[i], 1.0 + 10.0*i);
+}
+
+int main( int argc, char* argv[] ) {
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,170 @@
+/*! \file utPeridigm_VerletUpdate.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_VerletUpdate.hpp"
+#include <vector>
+#include <limits>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+
+using namespace PeridigmNS;
+using namespace std;
+
+// An odd number of points, so that the loops do not divide evenly into vector lanes
+const int numPoints = 37;
+
+//! Fills the force, external force, density, and velocity vectors with distinct, nonzero values.
+void createPointData(vector<double>& force,
+                     vector<double>& externalForce,
+                     vector<double>& density,
+                     vector<double>& v)
+{
+  force.resize(3*numPoints);
+  externalForce.resize(3*numPoints);
+  density.resize(numPoints);
+  v.resize(3*numPoints);
+  for(int i=0 ; i<numPoints ; ++i){
+    density[i] = 7800.0 + 10.0*(i%7);
+    for(int dof=0 ; dof<3 ; ++dof){
+      force[3*i+dof] = 1.0e9*(1.0 + 0.1*((5*i+dof)%11));
+      externalForce[3*i+dof] = -2.0e8*(1.0 + 0.3*((3*i+dof)%4));
+      v[3*i+dof] = 1.0 + 0.01*(3*i+dof);
+    }
+  }
+}
+
+TEUCHOS_UNIT_TEST(VerletUpdate, Positions) {
+
+  int length = 3*numPoints;
+  double dt = 1.0e-3;
+  vector<double> x(length), v(length), u(length), y(length);
+  for(int i=0 ; i<length ; ++i){
+    x[i] = 0.5*i;
+    v[i] = 10.0 - 0.25*i;
+    u[i] = 1.0e-3*(i%5);
+  }
+
+  // unfused sequence: U = U + dt*V, then Y = X + U
+  vector<double> uExpected(u), yExpected(x);
+  for(int i=0 ; i<length ; ++i)
+    uExpected[i] += dt*v[i];
+  for(int i=0 ; i<length ; ++i)
+    yExpected[i] += uExpected[i];
+
+  VerletUpdatePositions(length, dt, &x[0], &v[0], &u[0], &y[0]);
+
+  for(int i=0 ; i<length ; ++i){
+    TEST_EQUALITY(u[i], uExpected[i]);
+    TEST_EQUALITY(y[i], yExpected[i]);
+  }
+}
+
+TEUCHOS_UNIT_TEST(VerletUpdate, AccelerationAndVelocity) {
+
+  double halfDt = 0.5e-3;
+  vector<double> force, externalForce, density, v;
+  createPointData(force, externalForce, density, v);
+
+  // unfused sequence: A = F, A = A + F_ext, A = A/density, then V = V + (dt/2)*A
+  vector<double> aExpected(force), vExpected(v);
+  for(int i=0 ; i<3*numPoints ; ++i)
+    aExpected[i] += externalForce[i];
+  for(int i=0 ; i<3*numPoints ; ++i)
+    aExpected[i] /= density[i/3];
+  for(int i=0 ; i<3*numPoints ; ++i)
+    vExpected[i] += halfDt*aExpected[i];
+
+  // the fused kernel multiplies by the inverse density, so the results agree to round-off
+  vector<double> a(3*numPoints);
+  bool forcesAreFinite = VerletUpdateAccelerationAndVelocity(numPoints, halfDt, &force[0], &externalForce[0], &density[0], &a[0], &v[0]);
+  TEST_EQUALITY_CONST(forcesAreFinite, true);
+  for(int i=0 ; i<3*numPoints ; ++i){
+    TEST_FLOATING_EQUALITY(a[i], aExpected[i], 1.0e-14);
+    TEST_FLOATING_EQUALITY(v[i], vExpected[i], 1.0e-14);
+  }
+}
+
+TEUCHOS_UNIT_TEST(VerletUpdate, Acceleration) {
+
+  vector<double> force, externalForce, density, v;
+  createPointData(force, externalForce, density, v);
+
+  vector<double> aExpected(force);
+  for(int i=0 ; i<3*numPoints ; ++i)
+    aExpected[i] += externalForce[i];
+  for(int i=0 ; i<3*numPoints ; ++i)
+    aExpected[i] /= density[i/3];
+
+  vector<double> a(3*numPoints);
+  bool forcesAreFinite = VerletComputeAcceleration(numPoints, &force[0], &externalForce[0], &density[0], &a[0]);
+  TEST_EQUALITY_CONST(forcesAreFinite, true);
+  for(int i=0 ; i<3*numPoints ; ++i)
+    TEST_FLOATING_EQUALITY(a[i], aExpected[i], 1.0e-14);
+}
+
+TEUCHOS_UNIT_TEST(VerletUpdate, NonFiniteForces) {
+
+  vector<double> force, externalForce, density, v;
+  vector<double> a(3*numPoints);
+  createPointData(force, externalForce, density, v);
+
+  // a single non-finite entry in the last point, which falls in the remainder of any vectorized loop, must be reported
+  force[3*numPoints-1] = numeric_limits<double>::quiet_NaN();
+  TEST_EQUALITY_CONST(VerletComputeAcceleration(numPoints, &force[0], &externalForce[0], &density[0], &a[0]), false);
+  TEST_EQUALITY_CONST(VerletUpdateAccelerationAndVelocity(numPoints, 0.5e-3, &force[0], &externalForce[0], &density[0], &a[0], &v[0]), false);
+
+  createPointData(force, externalForce, density, v);
+  externalForce[4] = numeric_limits<double>::infinity();
+  TEST_EQUALITY_CONST(VerletComputeAcceleration(numPoints, &force[0], &externalForce[0], &density[0], &a[0]), false);
+  TEST_EQUALITY_CONST(VerletUpdateAccelerationAndVelocity(numPoints, 0.5e-3, &force[0], &externalForce[0], &density[0], &a[0], &v[0]), false);
+}
+
+int main( int argc, char* argv[] ) {
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -47,6 +47,8 @@
 
 #include "Peridigm_CriticalStretchDamageModel.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_BitPackedBondData.hpp"
+#include <algorithm>
 
 using namespace std;
 
@@ -87,21 +89,31 @@ PeridigmNS::CriticalStretchDamageModel::initialize(const double dt,
                                                    const int* neighborhoodList,
                                                    PeridigmNS::DataManager& dataManager) const
 {
-  double *damage, *bondDamage;
+  double *damage;
   dataManager.getData(m_damageFieldId, PeridigmField::STEP_NP1)->ExtractView(&damage);
-  dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
 
   // Initialize damage to zero
   int neighborhoodListIndex = 0;
-  int bondIndex = 0;
+  int numBonds = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
 	int nodeID = ownedIDs[iID];
     damage[nodeID] = 0.0;
 	int numNeighbors = neighborhoodList[neighborhoodListIndex++];
     neighborhoodListIndex += numNeighbors;
-	for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
-      bondDamage[bondIndex++] = 0.0;
-	}
+    numBonds += numNeighbors;
+  }
+  if(dataManager.isBitPacked(m_bondDamageFieldId)){
+    std::uint32_t* bondDamage = dataManager.getBitPackedData(m_bondDamageFieldId, PeridigmField::STEP_NP1);
+    std::fill(bondDamage, bondDamage + numBitPackedWords(numBonds), 0u);
+  }
+  else if(dataManager.isSinglePrecision(m_bondDamageFieldId)){
+    float* bondDamage = dataManager.getSinglePrecisionData(m_bondDamageFieldId, PeridigmField::STEP_NP1);
+    std::fill(bondDamage, bondDamage + numBonds, 0.0f);
+  }
+  else{
+    double* bondDamage;
+    dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+    std::fill(bondDamage, bondDamage + numBonds, 0.0);
   }
 }
 
@@ -112,28 +124,75 @@ PeridigmNS::CriticalStretchDamageModel::computeDamage(const double dt,
                                                       const int* neighborhoodList,
                                                       PeridigmNS::DataManager& dataManager) const
 {
-  double *x, *y, *damage, *bondDamageN, *bondDamageNP1, *deltaTemperature;
+  computeDamageOnPoints(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager, 0, numOwnedPoints);
+}
+
+void
+PeridigmNS::CriticalStretchDamageModel::computeDamageOnPoints(const double dt,
+                                                              const int numOwnedPoints,
+                                                              const int* ownedIDs,
+                                                              const int* neighborhoodList,
+                                                              PeridigmNS::DataManager& dataManager,
+                                                              const int firstPoint,
+                                                              const int lastPoint) const
+{
+  double *x, *y, *damage, *deltaTemperature;
   dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
   dataManager.getData(m_coordinatesFieldId, PeridigmField::STEP_NP1)->ExtractView(&y);
   dataManager.getData(m_damageFieldId, PeridigmField::STEP_NP1)->ExtractView(&damage);
-  dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_N)->ExtractView(&bondDamageN);
-  dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamageNP1);
   deltaTemperature = NULL;
   if(m_applyThermalStrains)
     dataManager.getData(m_deltaTemperatureFieldId, PeridigmField::STEP_NP1)->ExtractView(&deltaTemperature);
 
+  if(dataManager.isBitPacked(m_bondDamageFieldId)){
+    std::uint32_t* bondDamageN = dataManager.getBitPackedData(m_bondDamageFieldId, PeridigmField::STEP_N);
+    std::uint32_t* bondDamageNP1 = dataManager.getBitPackedData(m_bondDamageFieldId, PeridigmField::STEP_NP1);
+    updateDamage(ownedIDs, neighborhoodList, x, y, deltaTemperature, damage, bondDamageN, bondDamageNP1, firstPoint, lastPoint);
+  }
+  else if(dataManager.isSinglePrecision(m_bondDamageFieldId)){
+    float* bondDamageN = dataManager.getSinglePrecisionData(m_bondDamageFieldId, PeridigmField::STEP_N);
+    float* bondDamageNP1 = dataManager.getSinglePrecisionData(m_bondDamageFieldId, PeridigmField::STEP_NP1);
+    updateDamage(ownedIDs, neighborhoodList, x, y, deltaTemperature, damage, bondDamageN, bondDamageNP1, firstPoint, lastPoint);
+  }
+  else{
+    double *bondDamageN, *bondDamageNP1;
+    dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_N)->ExtractView(&bondDamageN);
+    dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamageNP1);
+    updateDamage(ownedIDs, neighborhoodList, x, y, deltaTemperature, damage, bondDamageN, bondDamageNP1, firstPoint, lastPoint);
+  }
+}
+
+template<typename DamageT>
+void
+PeridigmNS::CriticalStretchDamageModel::updateDamage(const int* ownedIDs,
+                                                     const int* neighborhoodList,
+                                                     const double* x,
+                                                     const double* y,
+                                                     const double* deltaTemperature,
+                                                     double* damage,
+                                                     const DamageT* bondDamageN,
+                                                     DamageT* bondDamageNP1,
+                                                     const int firstPoint,
+                                                     const int lastPoint) const
+{
   double trialDamage(0.0);
   int neighborhoodListIndex(0), bondIndex(0);
   int nodeId, numNeighbors, neighborID, iID, iNID;
   double nodeInitialX[3], nodeCurrentX[3], initialDistance, currentDistance, relativeExtension, totalDamage;
 
-  // Set the bond damage to the previous value
-  *(dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)) = *(dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_N));
+  // Advance to the neighborhood list and bond data of the first point in the range
+  for(iID=0 ; iID<firstPoint ; ++iID){
+    numNeighbors = neighborhoodList[neighborhoodListIndex];
+    neighborhoodListIndex += 1 + numNeighbors;
+    bondIndex += numNeighbors;
+  }
+  const int firstNeighborhoodListIndex = neighborhoodListIndex;
+  const int firstBondIndex = bondIndex;
 
   // Update the bond damage
   // Break bonds if the extension is greater than the critical extension
 
-  for(iID=0 ; iID<numOwnedPoints ; ++iID){
+  for(iID=firstPoint ; iID<lastPoint ; ++iID){
 	nodeId = ownedIDs[iID];
 	nodeInitialX[0] = x[nodeId*3];
 	nodeInitialX[1] = x[nodeId*3+1];
@@ -156,24 +215,23 @@ PeridigmNS::CriticalStretchDamageModel::computeDamage(const double dt,
       trialDamage = 0.0;
       if(relativeExtension > m_criticalStretch)
         trialDamage = 1.0;
-      if(trialDamage > bondDamageNP1[bondIndex]){
-        bondDamageNP1[bondIndex] = trialDamage;
-      }
+      // Bond damage never decreases from its previous value
+      setBondValue(bondDamageNP1, bondIndex, std::max(trialDamage, getBondValue(bondDamageN, bondIndex)));
       bondIndex += 1;
     }
   }
 
   //  Update the element damage (percent of bonds broken)
 
-  neighborhoodListIndex = 0;
-  bondIndex = 0;
-  for(iID=0 ; iID<numOwnedPoints ; ++iID){
+  neighborhoodListIndex = firstNeighborhoodListIndex;
+  bondIndex = firstBondIndex;
+  for(iID=firstPoint ; iID<lastPoint ; ++iID){
 	nodeId = ownedIDs[iID];
 	numNeighbors = neighborhoodList[neighborhoodListIndex++];
     neighborhoodListIndex += numNeighbors;
 	totalDamage = 0.0;
 	for(iNID=0 ; iNID<numNeighbors ; ++iNID){
-	  totalDamage += bondDamageNP1[bondIndex++];
+	  totalDamage += getBondValue(bondDamageNP1, bondIndex++);
 	}
 	if(numNeighbors > 0)
 	  totalDamage /= numNeighbors;
@@ -73,6 +73,12 @@ namespace PeridigmNS {
     //! Returns a vector of field IDs corresponding to the variables associated with the model.
     virtual std::vector<int> FieldIds() const { return m_fieldIds; }
 
+    //! Bond damage is either zero or one, so it may be stored in single precision without loss.
+    virtual std::vector<int> SinglePrecisionBondFieldIds() const { return std::vector<int>(1, m_bondDamageFieldId); }
+
+    //! Bond damage is binary and may be stored as one bit per bond.
+    virtual std::vector<int> BitPackedBondFieldIds() const { return std::vector<int>(1, m_bondDamageFieldId); }
+
     //! Initialize the damage model.
     virtual void
     initialize(const double dt,
@@ -89,8 +95,34 @@ namespace PeridigmNS {
                   const int* neighborhoodList,
                   PeridigmNS::DataManager& dataManager) const ;
 
+    //! Critical stretch damage is evaluated bond by bond and can be split over ranges of owned points.
+    virtual bool supportsPartialDamageEvaluation() const { return true; }
+
+    //! Evaluate the damage for owned points firstPoint through lastPoint-1
+    virtual void
+    computeDamageOnPoints(const double dt,
+                          const int numOwnedPoints,
+                          const int* ownedIDs,
+                          const int* neighborhoodList,
+                          PeridigmNS::DataManager& dataManager,
+                          const int firstPoint,
+                          const int lastPoint) const ;
+
   protected:
 
+    //! Updates bond damage and element damage for owned points firstPoint through lastPoint-1; DamageT is the storage type of the bond damage.
+    template<typename DamageT>
+    void updateDamage(const int* ownedIDs,
+                      const int* neighborhoodList,
+                      const double* x,
+                      const double* y,
+                      const double* deltaTemperature,
+                      double* damage,
+                      const DamageT* bondDamageN,
+                      DamageT* bondDamageNP1,
+                      const int firstPoint,
+                      const int lastPoint) const ;
+
 	//! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
 	inline double distance(double a1, double a2, double a3,
 						   double b1, double b2, double b3) const
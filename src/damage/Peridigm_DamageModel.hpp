@@ -50,6 +50,7 @@
 
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_ParameterList.hpp>
+#include <Teuchos_Assert.hpp>
 #include <Epetra_Vector.h>
 #include <Epetra_Map.h>
 #include "Peridigm_DataManager.hpp"
@@ -73,6 +74,18 @@ namespace PeridigmNS {
     //! Returns a vector of field IDs corresponding to the variables associated with the model.
     virtual std::vector<int> FieldIds() const = 0;
 
+    //! Returns the bond field IDs that the model can read and write in single precision (see DataManager::getSinglePrecisionData()).
+    virtual std::vector<int> SinglePrecisionBondFieldIds() const {
+      std::vector<int> empty;
+      return empty;
+    }
+
+    //! Returns the bond field IDs that the model can read and write as one bit per bond (see DataManager::getBitPackedData()).
+    virtual std::vector<int> BitPackedBondFieldIds() const {
+      std::vector<int> empty;
+      return empty;
+    }
+
 	//! Initialize the damage model.
 	virtual void
 	initialize(const double dt,
@@ -89,6 +102,21 @@ namespace PeridigmNS {
                   const int* neighborhoodList,
                   PeridigmNS::DataManager& dataManager) const = 0;
 
+    //! Returns true if the damage model implements computeDamageOnPoints().
+    virtual bool supportsPartialDamageEvaluation() const { return false; }
+
+	//! Evaluate the damage for owned points firstPoint through lastPoint-1
+	virtual void
+	computeDamageOnPoints(const double dt,
+                          const int numOwnedPoints,
+                          const int* ownedIDs,
+                          const int* neighborhoodList,
+                          PeridigmNS::DataManager& dataManager,
+                          const int firstPoint,
+                          const int lastPoint) const {
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error:  DamageModel::computeDamageOnPoints() is not implemented for " + Name() + ".\n");
+    }
+
   private:
 	
 	//! Default constructor with no arguments, private to prevent use.
@@ -48,7 +48,75 @@
 #include "Peridigm_InitialDamageModel.hpp"
 #include "Peridigm_Field.hpp"
 #include "Peridigm_GenesisToTriangles.hpp"
+#include "Peridigm_BitPackedBondData.hpp"
 #include "BondFilter.h"
+#include <algorithm>
+#include <memory>
+
+namespace {
+
+//! Applies the bond filters and sets bond damage and element damage at steps N and NP1; DamageT is the storage type of the bond damage.
+template<typename DamageT>
+void applyBondFilters(const PdBondFilter::BondFilterSet& filterSet,
+                      const int numOwnedPoints,
+                      const int* ownedIDs,
+                      const int* neighborhoodList,
+                      const double* x,
+                      double* damageN,
+                      double* damageNP1,
+                      DamageT* bondDamageN,
+                      DamageT* bondDamageNP1)
+{
+  PdBondFilter::BondFilterSet::Workspace filterWorkspace;
+  int neighborhoodListIndex = 0;
+  int bondIndex = 0;
+  std::vector<int> treeList;
+  std::vector<int>::size_type bondFlagsCapacity = 0;
+  std::unique_ptr<bool[]> bondFlags;
+  // The neighbor lists do not contain the point itself, so no bond is treated as a self bond
+  const std::size_t ptLocalID = static_cast<std::size_t>(-1);
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+    int nodeID = ownedIDs[iID];
+    const double* pt = &x[3*nodeID];
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    treeList.assign(neighborhoodList + neighborhoodListIndex, neighborhoodList + neighborhoodListIndex + numNeighbors);
+    neighborhoodListIndex += numNeighbors;
+    if(bondFlagsCapacity < treeList.size()){
+      bondFlagsCapacity = treeList.size();
+      bondFlags.reset(new bool[bondFlagsCapacity]);
+    }
+    std::fill(bondFlags.get(), bondFlags.get() + numNeighbors, false);
+    filterSet.filterBonds(treeList, pt, ptLocalID, x, bondFlags.get(), filterWorkspace);
+    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+      PeridigmNS::setBondValue(bondDamageNP1, bondIndex, bondFlags[iNID] ? 1.0 : 0.0);
+      bondIndex += 1;
+    }
+  }
+
+  //  Update the element damage (percent of bonds broken)
+  neighborhoodListIndex = 0;
+  bondIndex = 0;
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+    int nodeID = ownedIDs[iID];
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    neighborhoodListIndex += numNeighbors;
+    double totalDamage = 0.0;
+    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+      double bondDamage = PeridigmNS::getBondValue(bondDamageNP1, bondIndex);
+      PeridigmNS::setBondValue(bondDamageN, bondIndex, bondDamage); // set bond damage for both step N and NP1
+      totalDamage += bondDamage;
+      bondIndex += 1;
+    }
+    if(numNeighbors > 0)
+      totalDamage /= numNeighbors;
+    else
+      totalDamage = 0.0;
+    damageN[nodeID] = totalDamage;
+    damageNP1[nodeID] = totalDamage;
+  }
+}
+
+}
 
 PeridigmNS::InitialDamageModel::InitialDamageModel(const Teuchos::ParameterList& params)
   : DamageModel(params),  m_modelCoordinatesFieldId(-1), m_damageFieldId(-1), m_bondDamageFieldId(-1)
@@ -115,58 +183,28 @@ PeridigmNS::InitialDamageModel::initialize(const double dt,
     }
   }
 
-  double *x, *damageN, *damageNP1, *bondDamageN, *bondDamageNP1;
+  double *x, *damageN, *damageNP1;
   dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
   dataManager.getData(m_damageFieldId, PeridigmField::STEP_N)->ExtractView(&damageN);
   dataManager.getData(m_damageFieldId, PeridigmField::STEP_NP1)->ExtractView(&damageNP1);
-  dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_N)->ExtractView(&bondDamageN);
-  dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamageNP1);
 
-  // Apply the bond filters
-  int neighborhoodListIndex = 0;
-  int bondIndex = 0;
-  std::vector<int> treeList(1,0);
-  std::vector<double> xOverlap(3);
-  int ptLocalID = -1;
-  bool bondFlag;
-  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
-    int nodeID = ownedIDs[iID];
-    double* pt = &x[3*nodeID];
-    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
-    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
-      int neighborID = neighborhoodList[neighborhoodListIndex++];
-      xOverlap[0] = x[3*neighborID];
-      xOverlap[1] = x[3*neighborID+1];
-      xOverlap[2] = x[3*neighborID+2];
-      bondDamageNP1[bondIndex] = 0.0;
-      for (std::vector< std::shared_ptr<PdBondFilter::BondFilter> >::iterator it = bondFilters.begin(); it != bondFilters.end() ; it++) {
-        bondFlag = false;
-        (*it)->filterBonds(treeList, pt, ptLocalID, xOverlap.data(), &bondFlag);
-        if (bondFlag)
-          bondDamageNP1[bondIndex] = 1.0;
-      }
-      bondIndex += 1;
-    }
+  // Apply the bond filters, all filters in a single pass over the bonds of each point
+  const PdBondFilter::BondFilterSet filterSet(bondFilters);
+  if(dataManager.isBitPacked(m_bondDamageFieldId)){
+    std::uint32_t* bondDamageN = dataManager.getBitPackedData(m_bondDamageFieldId, PeridigmField::STEP_N);
+    std::uint32_t* bondDamageNP1 = dataManager.getBitPackedData(m_bondDamageFieldId, PeridigmField::STEP_NP1);
+    applyBondFilters(filterSet, numOwnedPoints, ownedIDs, neighborhoodList, x, damageN, damageNP1, bondDamageN, bondDamageNP1);
   }
-
-  //  Update the element damage (percent of bonds broken)
-  neighborhoodListIndex = 0;
-  bondIndex = 0;
-  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
-    int nodeID = ownedIDs[iID];
-    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
-    neighborhoodListIndex += numNeighbors;
-    double totalDamage = 0.0;
-    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
-      bondDamageN[bondIndex] = bondDamageNP1[bondIndex]; // set bond damage for both step N and NP1
-      totalDamage += bondDamageNP1[bondIndex++];
-    }
-    if(numNeighbors > 0)
-      totalDamage /= numNeighbors;
-    else
-      totalDamage = 0.0;
-    damageN[nodeID] = totalDamage;
-    damageNP1[nodeID] = totalDamage;
+  else if(dataManager.isSinglePrecision(m_bondDamageFieldId)){
+    float* bondDamageN = dataManager.getSinglePrecisionData(m_bondDamageFieldId, PeridigmField::STEP_N);
+    float* bondDamageNP1 = dataManager.getSinglePrecisionData(m_bondDamageFieldId, PeridigmField::STEP_NP1);
+    applyBondFilters(filterSet, numOwnedPoints, ownedIDs, neighborhoodList, x, damageN, damageNP1, bondDamageN, bondDamageNP1);
+  }
+  else{
+    double *bondDamageN, *bondDamageNP1;
+    dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_N)->ExtractView(&bondDamageN);
+    dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamageNP1);
+    applyBondFilters(filterSet, numOwnedPoints, ownedIDs, neighborhoodList, x, damageN, damageNP1, bondDamageN, bondDamageNP1);
   }
 }
 
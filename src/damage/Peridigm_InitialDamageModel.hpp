@@ -73,6 +73,12 @@ namespace PeridigmNS {
     //! Returns a vector of field IDs corresponding to the variables associated with the model.
     virtual std::vector<int> FieldIds() const { return m_fieldIds; }
 
+    //! Bond damage is binary and may be stored in single precision or as one bit per bond.
+    virtual std::vector<int> SinglePrecisionBondFieldIds() const { return std::vector<int>(1, m_bondDamageFieldId); }
+
+    //! Bond damage is binary and may be stored in single precision or as one bit per bond.
+    virtual std::vector<int> BitPackedBondFieldIds() const { return std::vector<int>(1, m_bondDamageFieldId); }
+
     //! Initialize the damage model.
     virtual void
     initialize(const double dt,
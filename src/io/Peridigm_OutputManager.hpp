@@ -75,6 +75,9 @@ namespace PeridigmNS {
     //! Write data to disk
     virtual void write(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double) = 0;
 
+    //! Returns true if the next call to write() will write data to disk
+    virtual bool writesNextCall() const { return true; }
+
     //! Multiply output frequency (for the sake of Adaptive time-stepping)
     virtual void multiplyOutputFrequency(double) = 0;
 
@@ -78,6 +78,15 @@ namespace PeridigmNS {
         (*it)->write(blocks, current_time);
     }
 
+    //! Returns true if any output manager in container will write data on the next call to write()
+    bool writesNextCall() const {
+      std::vector< Teuchos::RCP< PeridigmNS::OutputManager > >::const_iterator it;
+      for ( it=outputManagers.begin() ; it < outputManagers.end(); it++ )
+        if ((*it)->writesNextCall())
+          return true;
+      return false;
+    }
+
     //! Multiply output frequency of all output managers in container
     //  for the sake of reducing load step size in Adaptive Quasi-static
     void multiplyOutputFrequency(double multiplier){
@@ -207,6 +207,17 @@ Teuchos::ParameterList PeridigmNS::OutputManager_ExodusII::getValidParameterList
 PeridigmNS::OutputManager_ExodusII::~OutputManager_ExodusII() {
 }
 
+bool PeridigmNS::OutputManager_ExodusII::writesNextCall() const {
+
+  if (!iWrite) return false;
+
+  // Mirrors the logic in write(), which increments count prior to the check
+  int nextCount = count + 1;
+  if ((nextCount<(firstOutputStep) || nextCount>(lastOutputStep+1)) || (frequency<=0 || (nextCount-1)%frequency!=0)) return false;
+
+  return true;
+}
+
 void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double current_time) {
 
   if (!iWrite) return;
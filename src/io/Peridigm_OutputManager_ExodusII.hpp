@@ -74,6 +74,9 @@ namespace PeridigmNS {
     //! Write data to disk
     virtual void write(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double);
 
+    //! Returns true if the next call to write() will write data to disk
+    virtual bool writesNextCall() const;
+
     //! Multiply output frequency, for the sake of reducing load-step size in Adaptive Quasi-static
     virtual void multiplyOutputFrequency(double);
 
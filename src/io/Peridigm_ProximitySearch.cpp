@@ -49,6 +49,7 @@
 #include "QuickGrid.h"
 #include "PdZoltan.h"
 #include "NeighborhoodList.h"
+#include <iostream>
 
 using namespace std;
 
@@ -207,7 +208,8 @@ void PeridigmNS::ProximitySearch::GlobalProximitySearch(Teuchos::RCP<Epetra_Vect
                                                         int& neighborListSize,                                                      /* output */
                                                         int*& neighborList,                                                         /* output (allocated within function) */
                                                         std::vector< std::shared_ptr<PdBondFilter::BondFilter> > bondFilters,       /* optional input */
-                                                        double radiusAddition)                                                      /* optional input */
+                                                        double radiusAddition,                                                      /* optional input */
+                                                        bool verbose)                                                               /* optional input */
 
 {
   // The proximity search does not appear to function properly if any of the search radii are set to zero
@@ -270,6 +272,19 @@ void PeridigmNS::ProximitySearch::GlobalProximitySearch(Teuchos::RCP<Epetra_Vect
                                  rebalancedSearchRadii,
                                  bondFilters);
 
+  if(verbose){
+    double localStats[2], globalStats[2], maxStats[2];
+    localStats[0] = static_cast<double>(list.get_num_received_points());
+    localStats[1] = list.get_num_bytes_sent();
+    originalMap.Comm().SumAll(localStats, globalStats, 2);
+    originalMap.Comm().MaxAll(localStats, maxStats, 2);
+    if(originalMap.Comm().MyPID() == 0){
+      cout << "\nNeighbor search halo exchange" << endl;
+      cout << "  ghost points received (total, max per processor) " << globalStats[0] << ", " << maxStats[0] << endl;
+      cout << "  megabytes exchanged (total, max per processor) " << globalStats[1]/1048576.0 << ", " << maxStats[1]/1048576.0 << "\n" << endl;
+    }
+  }
+
   // The neighbor search is complete, but needs to be brought back into the initial decomposition
 
   int listNumOwned = list.get_num_owned_points();
@@ -88,6 +88,7 @@ namespace ProximitySearch {
      *  \param neighborList      [output]          Pointer to the neighbor list containing the number of neighbors for each point and the list of neighbors for each point (indexes into x).
      *  \param bondFilters       [optional input]  Set of bond filters to employ during the proximity search.
      *  \param radiusAddition    [optional input]  An additional length added to each radius defining the search sphere for each point.
+     *  \param verbose           [optional input]  If true, the number of ghosts and the volume of data exchanged during the search are reported.
      *
      *  The global proximity search finds, for each point in x, all the points that are within the specified search radius.  The search radius is defined separately for
      *  each point.  The neighborList is allocated within this function and becomes the responsibility of the calling routine (i.e., the calling routine is responsible for deallocation).
@@ -102,7 +103,8 @@ namespace ProximitySearch {
                              int& neighborListSize,
                              int*& neighborList,
                              std::vector< std::shared_ptr<PdBondFilter::BondFilter> > bondFilters = std::vector< std::shared_ptr<PdBondFilter::BondFilter> >(),
-                             double radiusAddition = 0.0);
+                             double radiusAddition = 0.0,
+                             bool verbose = false);
 
 }
 }
@@ -61,6 +61,7 @@
 #include <Teuchos_RCP.hpp>
 #include <Ionit_Initializer.h>
 #include <sstream>
+#include <fstream>
 #include <set>
 #include <math.h>
 #include <exodusII.h>
@@ -95,6 +96,9 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
   if(params->isParameter("Verbose"))
     verbose = params->get<bool>("Verbose");
 
+  if(params->isParameter("Neighborhood Cache Directory"))
+    neighborhoodCacheDirectory = params->get<string>("Neighborhood Cache Directory");
+
   // Store exodus mesh for intersection calculations, or if it was specifically requested (e.g., unit tests)
   if(params->isParameter("Store Exodus Mesh")){
     storeExodusMesh = params->get<bool>("Store Exodus Mesh");
@@ -152,12 +156,44 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
   int neighborListSize;
   int* neighborList;
 
+  // Reuse the neighbor list from a previous run if the cache holds one computed from identical inputs
+  // The cache is used only if every processor finds a matching file
+  bool useNeighborhoodCache = !neighborhoodCacheDirectory.empty();
+  bool neighborhoodFromCache = false;
+  string cacheFileName;
+  unsigned long long cacheKey(0);
+  if(useNeighborhoodCache){
+    cacheKey = neighborhoodCacheKey(params);
+    cacheFileName = neighborhoodCacheFileName(cacheKey);
+    vector<int> overlapGlobalIds, cachedNeighborList;
+    int localHit = readNeighborhoodCache(cacheFileName, cacheKey, overlapGlobalIds, cachedNeighborList) ? 1 : 0;
+    int globalHit(0);
+    epetra_comm->MinAll(&localHit, &globalHit, 1);
+    if(globalHit == 1){
+      oneDimensionalOverlapMap = Teuchos::rcp(new Epetra_BlockMap(-1,
+                                                                  static_cast<int>( overlapGlobalIds.size() ),
+                                                                  overlapGlobalIds.data(),
+                                                                  1,
+                                                                  0,
+                                                                  *comm));
+      neighborListSize = static_cast<int>(cachedNeighborList.size());
+      neighborList = new int[neighborListSize];
+      if(neighborListSize > 0)
+        memcpy(neighborList, &cachedNeighborList[0], neighborListSize*sizeof(int));
+      neighborhoodFromCache = true;
+    }
+    if(verbose && myPID == 0)
+      cout << "\n--Neighborhood cache " << (neighborhoodFromCache ? "hit" : "miss") << " in " << neighborhoodCacheDirectory << "\n" << endl;
+  }
+
   // Execute the neighbor search
   // When computing element-horizon intersections, the search is expanded by the maximum element dimension
-  if(computeIntersections)
-    ProximitySearch::GlobalProximitySearch(initialX, horizonForEachPoint, oneDimensionalOverlapMap, neighborListSize, neighborList, bondFilters, maxElementDimension);
-  else
-    ProximitySearch::GlobalProximitySearch(initialX, horizonForEachPoint, oneDimensionalOverlapMap, neighborListSize, neighborList, bondFilters);
+  if(!neighborhoodFromCache){
+    if(computeIntersections)
+      ProximitySearch::GlobalProximitySearch(initialX, horizonForEachPoint, oneDimensionalOverlapMap, neighborListSize, neighborList, bondFilters, maxElementDimension, verbose);
+    else
+      ProximitySearch::GlobalProximitySearch(initialX, horizonForEachPoint, oneDimensionalOverlapMap, neighborListSize, neighborList, bondFilters, 0.0, verbose);
+  }
 
   // Ghost exodus data so that element-horizon intersections can be calculated for ghosted neighbors
   if(storeExodusMesh)
@@ -165,9 +201,13 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
 
   // Remove elements from neighbor lists that are outside the horizon
   // Some will have been picked up in the initial neighbor search when computing element-horizon intersections
-  if(computeIntersections)
+  if(computeIntersections && !neighborhoodFromCache)
     removeNonintersectingNeighborsFromNeighborList(initialX, horizonForEachPoint, oneDimensionalMap, oneDimensionalOverlapMap, neighborListSize, neighborList);
 
+  // Store the neighbor list prior to block filtering, so that changes to "Omit Bonds Between Blocks" do not invalidate the cache
+  if(useNeighborhoodCache && !neighborhoodFromCache)
+    writeNeighborhoodCache(cacheFileName, cacheKey, neighborListSize, neighborList);
+
   createNeighborhoodData(neighborListSize, neighborList);
 
   // if interfaces are requested construct the interfaces after the neighborhood data is known:
@@ -1081,6 +1121,177 @@ void PeridigmNS::ExodusDiscretization::removeNonintersectingNeighborsFromNeighbo
   }
 }
 
+namespace {
+
+  //! Header written at the start of each neighborhood cache file.
+  struct NeighborhoodCacheHeader {
+    char magic[8];
+    int version;
+    int numProcs;
+    int rank;
+    int numOwned;
+    int numOverlap;
+    int neighborListSize;
+    unsigned long long key;
+  };
+
+  const char neighborhoodCacheMagic[8] = {'P', 'D', 'N', 'C', 'A', 'C', 'H', 'E'};
+  const int neighborhoodCacheVersion = 2;
+
+  //! 64-bit FNV-1a hash, accumulated over successive calls.
+  void hashBytes(unsigned long long& hash, const void* data, size_t numBytes){
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for(size_t i=0 ; i<numBytes ; ++i){
+      hash ^= static_cast<unsigned long long>(bytes[i]);
+      hash *= 1099511628211ULL;
+    }
+  }
+
+  void hashString(unsigned long long& hash, const string& str){
+    hashBytes(hash, str.data(), str.size());
+  }
+}
+
+unsigned long long PeridigmNS::ExodusDiscretization::neighborhoodCacheKey(const Teuchos::RCP<Teuchos::ParameterList>& params) const
+{
+  unsigned long long key = 14695981039346656037ULL;
+
+  hashBytes(key, &neighborhoodCacheVersion, sizeof(int));
+  hashBytes(key, &numPID, sizeof(numPID));
+  hashBytes(key, &myPID, sizeof(myPID));
+
+  // Owned points, their positions, and their horizons
+  int numOwned = oneDimensionalMap->NumMyElements();
+  hashBytes(key, &numOwned, sizeof(int));
+  if(numOwned > 0){
+    hashBytes(key, oneDimensionalMap->MyGlobalElements(), numOwned*sizeof(int));
+    hashBytes(key, initialX->Values(), 3*numOwned*sizeof(double));
+    hashBytes(key, horizonForEachPoint->Values(), numOwned*sizeof(double));
+  }
+
+  // Element-horizon intersections depend on the original hex/tet mesh
+  int intersectionFlag = computeIntersections ? 1 : 0;
+  hashBytes(key, &intersectionFlag, sizeof(int));
+  if(computeIntersections){
+    hashBytes(key, &maxElementDimension, sizeof(double));
+    hashBytes(key, exodusMeshNodePositions->Values(), exodusMeshNodePositions->MyLength()*sizeof(double));
+  }
+
+  // Connectivity of the original mesh for each owned element (node count followed by global node ids)
+  int connectivityFlag = exodusMeshElementConnectivity.is_null() ? 0 : 1;
+  hashBytes(key, &connectivityFlag, sizeof(int));
+  if(connectivityFlag == 1){
+    const Epetra_BlockMap& connectivityMap = exodusMeshElementConnectivity->Map();
+    int* ownedGlobalIds = oneDimensionalMap->MyGlobalElements();
+    for(int i=0 ; i<numOwned ; ++i){
+      int localId = connectivityMap.LID(ownedGlobalIds[i]);
+      int numNodes = connectivityMap.ElementSize(localId);
+      int firstIndex = connectivityMap.FirstPointInElement(localId);
+      hashBytes(key, &numNodes, sizeof(int));
+      hashBytes(key, exodusMeshElementConnectivity->Values() + firstIndex, numNodes*sizeof(double));
+    }
+  }
+
+  // Bond filters, including the contents of any Exodus mesh used to define them
+  if(params->isSublist("Bond Filters")){
+    Teuchos::RCP<Teuchos::ParameterList> bondFilterParameters = sublist(params, "Bond Filters");
+    stringstream ss;
+    bondFilterParameters->print(ss, 0, true, false);
+    hashString(key, ss.str());
+    for(Teuchos::ParameterList::ConstIterator it = bondFilterParameters->begin(); it != bondFilterParameters->end(); ++it){
+      const Teuchos::ParameterList& filterParams = bondFilterParameters->sublist(it->first);
+      if(filterParams.isParameter("File Name")){
+        ifstream filterFile(filterParams.get<string>("File Name").c_str(), ios::binary);
+        stringstream contents;
+        contents << filterFile.rdbuf();
+        hashString(key, contents.str());
+      }
+    }
+  }
+
+  return key;
+}
+
+string PeridigmNS::ExodusDiscretization::neighborhoodCacheFileName(unsigned long long key) const
+{
+  stringstream ss;
+  ss << neighborhoodCacheDirectory << "/neighborhood." << hex << key << dec << "." << numPID << "." << myPID << ".bin";
+  return ss.str();
+}
+
+bool PeridigmNS::ExodusDiscretization::readNeighborhoodCache(const string& fileName,
+                                                              unsigned long long key,
+                                                              vector<int>& overlapGlobalIds,
+                                                              vector<int>& cachedNeighborList) const
+{
+  ifstream inFile(fileName.c_str(), ios::binary);
+  if(!inFile.is_open())
+    return false;
+
+  NeighborhoodCacheHeader header;
+  inFile.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if(!inFile ||
+     memcmp(header.magic, neighborhoodCacheMagic, sizeof(header.magic)) != 0 ||
+     header.version != neighborhoodCacheVersion ||
+     header.key != key ||
+     header.numProcs != static_cast<int>(numPID) ||
+     header.rank != static_cast<int>(myPID) ||
+     header.numOwned != oneDimensionalMap->NumMyElements() ||
+     header.numOverlap < header.numOwned ||
+     header.neighborListSize < header.numOwned)
+    return false;
+
+  overlapGlobalIds.resize(header.numOverlap);
+  cachedNeighborList.resize(header.neighborListSize);
+  if(header.numOverlap > 0)
+    inFile.read(reinterpret_cast<char*>(&overlapGlobalIds[0]), header.numOverlap*sizeof(int));
+  if(header.neighborListSize > 0)
+    inFile.read(reinterpret_cast<char*>(&cachedNeighborList[0]), header.neighborListSize*sizeof(int));
+  if(!inFile)
+    return false;
+
+  // The non-ghost portion of the overlap map must match the owned map
+  int* ownedGlobalIds = oneDimensionalMap->MyGlobalElements();
+  for(int i=0 ; i<header.numOwned ; ++i){
+    if(overlapGlobalIds[i] != ownedGlobalIds[i])
+      return false;
+  }
+
+  return true;
+}
+
+void PeridigmNS::ExodusDiscretization::writeNeighborhoodCache(const string& fileName,
+                                                               unsigned long long key,
+                                                               int neighborListSize,
+                                                               const int* neighborList) const
+{
+  NeighborhoodCacheHeader header;
+  memcpy(header.magic, neighborhoodCacheMagic, sizeof(header.magic));
+  header.version = neighborhoodCacheVersion;
+  header.numProcs = static_cast<int>(numPID);
+  header.rank = static_cast<int>(myPID);
+  header.numOwned = oneDimensionalMap->NumMyElements();
+  header.numOverlap = oneDimensionalOverlapMap->NumMyElements();
+  header.neighborListSize = neighborListSize;
+  header.key = key;
+
+  // Write to a temporary file and rename, so that an interrupted run never leaves a truncated cache entry
+  string tempFileName = fileName + ".tmp";
+  ofstream outFile(tempFileName.c_str(), ios::binary | ios::trunc);
+  if(outFile.is_open()){
+    outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if(header.numOverlap > 0)
+      outFile.write(reinterpret_cast<const char*>(oneDimensionalOverlapMap->MyGlobalElements()), header.numOverlap*sizeof(int));
+    if(neighborListSize > 0)
+      outFile.write(reinterpret_cast<const char*>(neighborList), neighborListSize*sizeof(int));
+    outFile.close();
+  }
+  if(!outFile || rename(tempFileName.c_str(), fileName.c_str()) != 0){
+    remove(tempFileName.c_str());
+    cout << "**** Warning on processor " << myPID << ": unable to write neighborhood cache file " << fileName << endl;
+  }
+}
+
 void PeridigmNS::ExodusDiscretization::ghostExodusMeshData()
 {
   int numGlobalElements = -1;
@@ -162,6 +162,24 @@ namespace PeridigmNS {
                                                         int& neighborListSize,
                                                         int*& neighborList);
 
+    //! Hash of the inputs that determine this processor's neighbor list (points, horizons, mesh connectivity, bond filters, intersection settings).
+    unsigned long long neighborhoodCacheKey(const Teuchos::RCP<Teuchos::ParameterList>& params) const;
+
+    //! Name of this processor's neighborhood cache file for the given key.
+    std::string neighborhoodCacheFileName(unsigned long long key) const;
+
+    //! Read the overlap global ids and neighbor list from a cache file; returns false if the file is missing or does not match the key.
+    bool readNeighborhoodCache(const std::string& fileName,
+                               unsigned long long key,
+                               std::vector<int>& overlapGlobalIds,
+                               std::vector<int>& cachedNeighborList) const;
+
+    //! Write the overlap global ids and neighbor list (local ids into the overlap map) to a cache file.
+    void writeNeighborhoodCache(const std::string& fileName,
+                                unsigned long long key,
+                                int neighborListSize,
+                                const int* neighborList) const;
+
     //! Perform parallel communication to make exodus mesh data available for ghosted (overlap) element.
     void ghostExodusMeshData();
 
@@ -235,6 +253,9 @@ namespace PeridigmNS {
     //! Discretization parameter controling the formation of bonds
     std::string bondFilterCommand;
 
+    //! Directory for cached neighbor lists, empty if caching is disabled
+    std::string neighborhoodCacheDirectory;
+
     //! Epetra communicator
     Teuchos::RCP<const Epetra_Comm> comm;
   };
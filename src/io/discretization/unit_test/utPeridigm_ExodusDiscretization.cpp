@@ -603,6 +603,76 @@ TEUCHOS_UNIT_TEST(ExodusDiscretization, Exodus2x2x2Test) {
   TEST_FLOATING_EQUALITY(exodusNodePositions[23], 0.5, 1.0e-16);    
 }
 
+//! Exposes the neighborhood cache key and the stored mesh data so that the key can be tested against modified inputs.
+class ExodusDiscretizationCacheKeyAccess : public ExodusDiscretization {
+public:
+  ExodusDiscretizationCacheKeyAccess(const Teuchos::RCP<const Epetra_Comm>& epetraComm,
+                                     const Teuchos::RCP<Teuchos::ParameterList>& params)
+    : ExodusDiscretization(epetraComm, params) {}
+  unsigned long long key(const Teuchos::RCP<Teuchos::ParameterList>& params) const { return neighborhoodCacheKey(params); }
+  Teuchos::RCP<Epetra_Vector> connectivity() { return exodusMeshElementConnectivity; }
+};
+
+TEUCHOS_UNIT_TEST(ExodusDiscretization, NeighborhoodCacheKeyTest) {
+
+  Teuchos::RCP<const Epetra_Comm> comm;
+  #ifdef HAVE_MPI
+    comm = rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+  #else
+    comm = rcp(new Epetra_SerialComm);
+  #endif
+  RCP<ParameterList> discParams = rcp(new ParameterList);
+  discParams->set("Type", "Exodus");
+  discParams->set("Input Mesh File", "utPeridigm_ExodusDiscretization_2x2x2.g");
+  discParams->set("Store Exodus Mesh", true);
+
+  ParameterList blockParameterList;
+  ParameterList& blockParams = blockParameterList.sublist("My Block");
+  blockParams.set("Block Names", "block_1");
+  blockParams.set("Horizon", 0.501);
+  PeridigmNS::HorizonManager::self().loadHorizonInformationFromBlockParameters(blockParameterList);
+
+  ExodusDiscretizationCacheKeyAccess discretization(comm, discParams);
+  const unsigned long long key = discretization.key(discParams);
+
+  // the key is a pure function of the inputs
+  TEST_ASSERT(discretization.key(discParams) == key);
+
+  // permuting the nodes of an element changes the key, even though the points themselves are unchanged
+  Teuchos::RCP<Epetra_Vector> connectivity = discretization.connectivity();
+  TEST_ASSERT(!connectivity.is_null());
+  const Epetra_BlockMap& connectivityMap = connectivity->Map();
+  int firstIndex = connectivityMap.FirstPointInElement(0);
+  double node0 = (*connectivity)[firstIndex];
+  double node1 = (*connectivity)[firstIndex + 1];
+  (*connectivity)[firstIndex] = node1;
+  (*connectivity)[firstIndex + 1] = node0;
+  TEST_ASSERT(discretization.key(discParams) != key);
+  (*connectivity)[firstIndex] = node0;
+  (*connectivity)[firstIndex + 1] = node1;
+  TEST_ASSERT(discretization.key(discParams) == key);
+
+  // moving a point changes the key
+  Teuchos::RCP<Epetra_Vector> initialX = discretization.getInitialX();
+  double x0 = (*initialX)[0];
+  (*initialX)[0] = x0 + 1.0e-12;
+  TEST_ASSERT(discretization.key(discParams) != key);
+  (*initialX)[0] = x0;
+
+  // changing a horizon changes the key
+  Teuchos::RCP<Epetra_Vector> horizon = discretization.getHorizon();
+  double h0 = (*horizon)[0];
+  (*horizon)[0] = 0.6;
+  TEST_ASSERT(discretization.key(discParams) != key);
+  (*horizon)[0] = h0;
+
+  // adding a bond filter changes the key
+  ParameterList& bondFilterParams = discParams->sublist("Bond Filters").sublist("My Plane");
+  bondFilterParams.set("Type", "Rectangular_Plane");
+  bondFilterParams.set("Normal_X", 1.0);
+  TEST_ASSERT(discretization.key(discParams) != key);
+}
+
 int main
 (int argc, char* argv[])
 {
@@ -46,6 +46,7 @@
 #include "BondFilter.h"
 #include <cmath>
 #include <float.h>
+#include <algorithm>
 
 #include <iostream>
 
@@ -174,6 +175,24 @@ void DiskFilter::filterBonds(std::vector<int>& treeList, const double *pt, const
   }
 }
 
+bool FinitePlaneFilter::addToSet(BondFilterSet& filterSet) const {
+  double normal[3], r0[3], ub[3], ua[3];
+  for (int i=0 ; i<3 ; i++) {
+    normal[i] = plane.n[i];
+    r0[i] = plane.r0[i];
+    ub[i] = plane.ub[i];
+    ua[i] = plane.ua[i];
+  }
+  // Parallel tolerance is the one hard-wired in FinitePlane::bondIntersectInfinitePlane(..)
+  filterSet.addFinitePlane(normal, r0, ub, ua, plane.b, plane.a, 1.0e-14, tolerance);
+  return true;
+}
+
+bool DiskFilter::addToSet(BondFilterSet& filterSet) const {
+  filterSet.addDisk(center, normal, radius, tolerance);
+  return true;
+}
+
 bool DiskFilter::bondIntersectsDisk(const double* p0, const double* p1) const {
 
   double numerator   = (center[0] - p0[0]) * normal[0] + (center[1] - p0[1]) * normal[1] + (center[2] - p0[2]) * normal[2];
@@ -235,6 +254,11 @@ void TriangleFilter::filterBonds(std::vector<int>& treeList, const double *pt, c
   }
 }
 
+bool TriangleFilter::addToSet(BondFilterSet& filterSet) const {
+  filterSet.addTriangle(v1_, v2_, v3_, normal_, tolerance_);
+  return true;
+}
+
 bool TriangleFilter::bondIntersectsTriangle(const double* p0, const double* p1) const {
 
   double numerator   = (v1_[0] - p0[0]) * normal_[0] + (v1_[1] - p0[1]) * normal_[1] + (v1_[2] - p0[2]) * normal_[2];
@@ -287,4 +311,370 @@ bool TriangleFilter::pointInTriangle(const double* x) const {
   return in_triangle;
 }
 
+namespace {
+
+/*
+ * If at most this many filters are in reach of a point, each is tested against the whole
+ * candidate list; beyond that each bond queries the hierarchy on its own
+ */
+const std::size_t maxBatchedFilters = 32;
+
+/*
+ * Number of filters in a leaf of the bounding volume hierarchy
+ */
+const int maxFiltersPerLeaf = 4;
+
+/*
+ * Relative enlargement of bounding boxes; covers the intersection tolerances and round-off
+ */
+const double boxSlack = 1.0e-8;
+
+inline bool boxesOverlap(const double* lo, const double* hi, const double* otherLo, const double* otherHi) {
+  return lo[0] <= otherHi[0] && otherLo[0] <= hi[0] &&
+         lo[1] <= otherHi[1] && otherLo[1] <= hi[1] &&
+         lo[2] <= otherHi[2] && otherLo[2] <= hi[2];
+}
+
+}
+
+BondFilterSet::BondFilterSet(const std::vector< std::shared_ptr<BondFilter> >& filters) : excludeSelf(false) {
+  for(unsigned int i=0 ; i<filters.size() ; i++){
+    if(!filters[i]->includesSelf())
+      excludeSelf = true;
+    if(!filters[i]->addToSet(*this))
+      scalarFilters.push_back(filters[i]);
+  }
+  if(!bvhFilters.empty())
+    buildBVH(0, static_cast<int>(bvhFilters.size()));
+}
+
+void BondFilterSet::addBoundingBox(Kind k, std::size_t i, const double lo[3], const double hi[3], bool bounded) {
+  double diagonal = std::sqrt((hi[0]-lo[0])*(hi[0]-lo[0]) + (hi[1]-lo[1])*(hi[1]-lo[1]) + (hi[2]-lo[2])*(hi[2]-lo[2]));
+  double scale = 0.0;
+  for (int j=0 ; j<3 ; j++)
+    scale = std::max(scale, std::max(std::abs(lo[j]), std::abs(hi[j])));
+  double slack = boxSlack*(diagonal + scale);
+  for (int j=0 ; j<3 ; j++)
+    boxes.push_back(lo[j] - slack);
+  for (int j=0 ; j<3 ; j++)
+    boxes.push_back(hi[j] + slack);
+  kind.push_back(k);
+  index.push_back(i);
+  if(bounded)
+    bvhFilters.push_back(kind.size()-1);
+  else
+    unboundedFilters.push_back(kind.size()-1);
+}
+
+void BondFilterSet::addFinitePlane(const double normal[3], const double lowerLeftCorner[3], const double ub[3], const double ua[3], double lengthBottom, double lengthA, double parallelTolerance, double tolerance) {
+  PlaneData plane;
+  double lo[3], hi[3];
+  for (int i=0 ; i<3 ; i++) {
+    plane.n[i] = normal[i];
+    plane.r0[i] = lowerLeftCorner[i];
+    plane.ub[i] = ub[i];
+    plane.ua[i] = ua[i];
+    // corners of the rectangle
+    double corners[4] = { lowerLeftCorner[i],
+                          lowerLeftCorner[i] + lengthBottom*ub[i],
+                          lowerLeftCorner[i] + lengthA*ua[i],
+                          lowerLeftCorner[i] + lengthBottom*ub[i] + lengthA*ua[i] };
+    lo[i] = *std::min_element(corners, corners+4);
+    hi[i] = *std::max_element(corners, corners+4);
+  }
+  plane.a = lengthA;
+  plane.b = lengthBottom;
+  plane.parallelTolerance = parallelTolerance;
+  plane.tolerance = tolerance;
+  planes.push_back(plane);
+  /*
+   * The rectangle spans lengthA x lengthBottom only if the normal and bottom edge are
+   * orthonormal; otherwise the plane is tested against every bond
+   */
+  double nn = normal[0]*normal[0] + normal[1]*normal[1] + normal[2]*normal[2];
+  double bb = ub[0]*ub[0] + ub[1]*ub[1] + ub[2]*ub[2];
+  double nb = normal[0]*ub[0] + normal[1]*ub[1] + normal[2]*ub[2];
+  bool bounded = std::abs(nn - 1.0) < 1.0e-8 && std::abs(bb - 1.0) < 1.0e-8 && std::abs(nb) < 1.0e-8;
+  addBoundingBox(PLANE, planes.size()-1, lo, hi, bounded);
+}
+
+void BondFilterSet::addDisk(const double center[3], const double normal[3], double radius, double tolerance) {
+  DiskData disk;
+  double lo[3], hi[3];
+  for (int i=0 ; i<3 ; i++) {
+    disk.center[i] = center[i];
+    disk.normal[i] = normal[i];
+    lo[i] = center[i] - radius;
+    hi[i] = center[i] + radius;
+  }
+  disk.radius = radius;
+  disk.tolerance = tolerance;
+  disks.push_back(disk);
+  addBoundingBox(DISK, disks.size()-1, lo, hi, true);
+}
+
+void BondFilterSet::addTriangle(const double v1[3], const double v2[3], const double v3[3], const double normal[3], double tolerance) {
+  TriangleData triangle;
+  double lo[3], hi[3];
+  for (int i=0 ; i<3 ; i++) {
+    triangle.v1[i] = v1[i];
+    triangle.normal[i] = normal[i];
+    triangle.e31[i] = v3[i] - v1[i];
+    triangle.e21[i] = v2[i] - v1[i];
+    lo[i] = std::min(v1[i], std::min(v2[i], v3[i]));
+    hi[i] = std::max(v1[i], std::max(v2[i], v3[i]));
+  }
+  const double* a = triangle.e31;
+  const double* b = triangle.e21;
+  triangle.dot00 = a[0]*a[0] + a[1]*a[1] + a[2]*a[2];
+  triangle.dot01 = a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+  triangle.dot11 = b[0]*b[0] + b[1]*b[1] + b[2]*b[2];
+  triangle.denominator = triangle.dot00 * triangle.dot11 - triangle.dot01 * triangle.dot01;
+  triangle.tolerance = tolerance;
+  triangles.push_back(triangle);
+  addBoundingBox(TRIANGLE, triangles.size()-1, lo, hi, true);
+}
+
+int BondFilterSet::buildBVH(int first, int count) {
+  int nodeIndex = static_cast<int>(bvh.size());
+  bvh.push_back(BVHNode());
+  double lo[3] = {DBL_MAX, DBL_MAX, DBL_MAX}, hi[3] = {-DBL_MAX, -DBL_MAX, -DBL_MAX};
+  double centerLo[3] = {DBL_MAX, DBL_MAX, DBL_MAX}, centerHi[3] = {-DBL_MAX, -DBL_MAX, -DBL_MAX};
+  for(int i=first ; i<first+count ; i++){
+    const double* box = &boxes[6*bvhFilters[i]];
+    for (int j=0 ; j<3 ; j++) {
+      lo[j] = std::min(lo[j], box[j]);
+      hi[j] = std::max(hi[j], box[3+j]);
+      double center = 0.5*(box[j] + box[3+j]);
+      centerLo[j] = std::min(centerLo[j], center);
+      centerHi[j] = std::max(centerHi[j], center);
+    }
+  }
+  for (int j=0 ; j<3 ; j++) {
+    bvh[nodeIndex].lo[j] = lo[j];
+    bvh[nodeIndex].hi[j] = hi[j];
+  }
+  bvh[nodeIndex].first = first;
+  bvh[nodeIndex].count = count;
+  bvh[nodeIndex].right = -1;
+  if(count <= maxFiltersPerLeaf)
+    return nodeIndex;
+
+  // Split at the median box center along the axis of largest spread
+  int axis = 0;
+  for (int j=1 ; j<3 ; j++) {
+    if(centerHi[j] - centerLo[j] > centerHi[axis] - centerLo[axis])
+      axis = j;
+  }
+  const std::vector<double>& filterBoxes = boxes;
+  int half = count/2;
+  std::nth_element(bvhFilters.begin()+first, bvhFilters.begin()+first+half, bvhFilters.begin()+first+count,
+                   [&filterBoxes, axis](std::size_t lhs, std::size_t rhs) {
+                     return filterBoxes[6*lhs+axis] + filterBoxes[6*lhs+3+axis] < filterBoxes[6*rhs+axis] + filterBoxes[6*rhs+3+axis];
+                   });
+  buildBVH(first, half);
+  int right = buildBVH(first+half, count-half);
+  bvh[nodeIndex].count = 0;
+  bvh[nodeIndex].right = right;
+  return nodeIndex;
+}
+
+void BondFilterSet::findFilters(const double lo[3], const double hi[3], std::vector<std::size_t>& found, std::vector<int>& stack) const {
+  if(bvh.empty())
+    return;
+  stack.clear();
+  stack.push_back(0);
+  while(!stack.empty()){
+    const BVHNode& node = bvh[stack.back()];
+    int nodeIndex = stack.back();
+    stack.pop_back();
+    if(!boxesOverlap(node.lo, node.hi, lo, hi))
+      continue;
+    if(node.count > 0){
+      for(int i=node.first ; i<node.first+node.count ; i++){
+        const double* box = &boxes[6*bvhFilters[i]];
+        if(boxesOverlap(box, box+3, lo, hi))
+          found.push_back(bvhFilters[i]);
+      }
+    }
+    else{
+      stack.push_back(node.right);
+      stack.push_back(nodeIndex+1);
+    }
+  }
+}
+
+/*
+ * The intersection tests below repeat the arithmetic of the scalar filters exactly, but are
+ * free of branches so that loops over the candidate list vectorize
+ */
+inline bool BondFilterSet::planeHit(const PlaneData& plane, const double *p0, double numerator, double dx, double dy, double dz) {
+  const double *n = plane.n, *r0 = plane.r0, *ua = plane.ua, *ub = plane.ub;
+  const double zero = plane.tolerance, one = 1.0 + plane.tolerance;
+  double denominator = dx * n[0] + dy * n[1] + dz * n[2];
+  bool crosses = std::abs(denominator) >= plane.parallelTolerance;
+  double t = numerator/(crosses ? denominator : 1.0);
+  crosses = crosses & (t >= 0.0) & (t <= 1.0);
+  double rx = p0[0] + t * dx - r0[0];
+  double ry = p0[1] + t * dy - r0[1];
+  double rz = p0[2] + t * dz - r0[2];
+  double aa = rx*ua[0] + ry*ua[1] + rz*ua[2];
+  double bb = rx*ub[0] + ry*ub[1] + rz*ub[2];
+  return crosses & (-zero < aa) & (aa/plane.a < one) & (-zero < bb) & (bb/plane.b < one);
+}
+
+inline bool BondFilterSet::diskHit(const DiskData& disk, const double *p0, double numerator, double dx, double dy, double dz) {
+  const double *n = disk.normal, *c = disk.center;
+  double denominator = dx * n[0] + dy * n[1] + dz * n[2];
+  bool crosses = std::abs(denominator) >= disk.tolerance;
+  double t = numerator/(crosses ? denominator : 1.0);
+  crosses = crosses & (t >= 0.0) & (t <= 1.0);
+  double rx = p0[0] + t * dx - c[0];
+  double ry = p0[1] + t * dy - c[1];
+  double rz = p0[2] + t * dz - c[2];
+  return crosses & (rx*rx + ry*ry + rz*rz < disk.radius*disk.radius);
+}
+
+inline bool BondFilterSet::triangleHit(const TriangleData& triangle, const double *p0, double numerator, double dx, double dy, double dz) {
+  const double *n = triangle.normal, *v1 = triangle.v1, *a = triangle.e31, *b = triangle.e21;
+  const double tolerance = triangle.tolerance;
+  double denominator = dx * n[0] + dy * n[1] + dz * n[2];
+  bool crosses = std::abs(denominator) >= tolerance;
+  double t = numerator/(crosses ? denominator : 1.0);
+  crosses = crosses & (t >= 0.0) & (t <= 1.0);
+  // barycentric coordinates of the intersection point
+  double cx = p0[0] + t * dx - v1[0];
+  double cy = p0[1] + t * dy - v1[1];
+  double cz = p0[2] + t * dz - v1[2];
+  double dot02 = a[0]*cx + a[1]*cy + a[2]*cz;
+  double dot12 = b[0]*cx + b[1]*cy + b[2]*cz;
+  double alpha = (triangle.dot11 * dot02 - triangle.dot01 * dot12) / triangle.denominator;
+  double beta  = (triangle.dot00 * dot12 - triangle.dot01 * dot02) / triangle.denominator;
+  return crosses & (alpha > -tolerance) & (beta > -tolerance) & (alpha + beta < 1.0 + 2*tolerance);
+}
+
+double BondFilterSet::numerator(std::size_t f, const double *p0) const {
+  const double *n, *r;
+  switch(kind[f]){
+  case PLANE:
+    n = planes[index[f]].n; r = planes[index[f]].r0;
+    break;
+  case DISK:
+    n = disks[index[f]].normal; r = disks[index[f]].center;
+    break;
+  default:
+    n = triangles[index[f]].normal; r = triangles[index[f]].v1;
+    break;
+  }
+  return (r[0] - p0[0]) * n[0] + (r[1] - p0[1]) * n[1] + (r[2] - p0[2]) * n[2];
+}
+
+bool BondFilterSet::bondHit(std::size_t f, const double *p0, double dx, double dy, double dz) const {
+  switch(kind[f]){
+  case PLANE:
+    return planeHit(planes[index[f]], p0, numerator(f, p0), dx, dy, dz);
+  case DISK:
+    return diskHit(disks[index[f]], p0, numerator(f, p0), dx, dy, dz);
+  default:
+    return triangleHit(triangles[index[f]], p0, numerator(f, p0), dx, dy, dz);
+  }
+}
+
+void BondFilterSet::filterBonds(std::vector<int>& treeList, const double *pt, const size_t ptLocalId, const double *xOverlap, bool *bondFlags, Workspace& workspace) const {
+
+  const size_t numCandidates = treeList.size();
+  if(workspace.hit.size() < numCandidates){
+    workspace.dx.resize(numCandidates);
+    workspace.dy.resize(numCandidates);
+    workspace.dz.resize(numCandidates);
+    workspace.hit.resize(numCandidates);
+  }
+  double* const dx = workspace.dx.data();
+  double* const dy = workspace.dy.data();
+  double* const dz = workspace.dz.data();
+  unsigned char* const hit = workspace.hit.data();
+
+  /*
+   * Gather the bonds p1-p0 once; every filter tests this list
+   */
+  const double *p0 = pt;
+  double maxLengthSquared = 0.0;
+  for(size_t p=0;p<numCandidates;p++){
+    const double *p1 = xOverlap+(3*treeList[p]);
+    dx[p] = p1[0] - p0[0];
+    dy[p] = p1[1] - p0[1];
+    dz[p] = p1[2] - p0[2];
+    hit[p] = 0;
+    maxLengthSquared = std::max(maxLengthSquared, dx[p]*dx[p] + dy[p]*dy[p] + dz[p]*dz[p]);
+  }
+
+  /*
+   * Every bond lies within 'maxLength' of p0, so only filters whose box comes that close can be hit
+   */
+  const double maxLength = std::sqrt(maxLengthSquared)*(1.0 + boxSlack);
+  double reachLo[3], reachHi[3];
+  for (int j=0 ; j<3 ; j++) {
+    reachLo[j] = p0[j] - maxLength;
+    reachHi[j] = p0[j] + maxLength;
+  }
+  std::vector<size_t>& active = workspace.activeFilters;
+  active.clear();
+  findFilters(reachLo, reachHi, active, workspace.stack);
+
+  /*
+   * Many filters in reach:  test each bond only against the filters its segment box overlaps
+   */
+  bool bondwise = active.size() > maxBatchedFilters;
+  if(bondwise){
+    for(size_t p=0;p<numCandidates;p++){
+      double segmentLo[3], segmentHi[3];
+      segmentLo[0] = std::min(p0[0], p0[0] + dx[p]); segmentHi[0] = std::max(p0[0], p0[0] + dx[p]);
+      segmentLo[1] = std::min(p0[1], p0[1] + dy[p]); segmentHi[1] = std::max(p0[1], p0[1] + dy[p]);
+      segmentLo[2] = std::min(p0[2], p0[2] + dz[p]); segmentHi[2] = std::max(p0[2], p0[2] + dz[p]);
+      active.clear();
+      findFilters(segmentLo, segmentHi, active, workspace.stack);
+      for(size_t iActive=0;iActive<active.size() && !hit[p];iActive++)
+        hit[p] = bondHit(active[iActive], p0, dx[p], dy[p], dz[p]);
+    }
+    active.clear();
+  }
+  active.insert(active.end(), unboundedFilters.begin(), unboundedFilters.end());
+
+  for(size_t iActive=0;iActive<active.size();iActive++){
+    const size_t f = active[iActive];
+    const double num = numerator(f, p0);
+    switch(kind[f]){
+    case PLANE:
+      {
+        const PlaneData& plane = planes[index[f]];
+        for(size_t p=0;p<numCandidates;p++)
+          hit[p] |= planeHit(plane, p0, num, dx[p], dy[p], dz[p]);
+      }
+      break;
+    case DISK:
+      {
+        const DiskData& disk = disks[index[f]];
+        for(size_t p=0;p<numCandidates;p++)
+          hit[p] |= diskHit(disk, p0, num, dx[p], dy[p], dz[p]);
+      }
+      break;
+    case TRIANGLE:
+      {
+        const TriangleData& triangle = triangles[index[f]];
+        for(size_t p=0;p<numCandidates;p++)
+          hit[p] |= triangleHit(triangle, p0, num, dx[p], dy[p], dz[p]);
+      }
+      break;
+    }
+  }
+
+  for(size_t p=0;p<numCandidates;p++){
+    if(hit[p] || (excludeSelf && ptLocalId == static_cast<size_t>(treeList[p])))
+      bondFlags[p]=1;
+  }
+
+  for(unsigned int iFilter=0 ; iFilter<scalarFilters.size() ; iFilter++)
+    scalarFilters[iFilter]->filterBonds(treeList, pt, ptLocalId, xOverlap, bondFlags);
+}
+
 } // namespace PdBondFilter
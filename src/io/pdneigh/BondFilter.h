@@ -56,6 +56,8 @@
 
 namespace PdBondFilter {
 
+class BondFilterSet;
+
 class FinitePlane {
 public:
 	/**
@@ -88,6 +90,7 @@ public:
 	 */
 	bool bondIntersect(double x[3], double tolerance=1.0e-15);
 private:
+	friend class FinitePlaneFilter;
 	UTILITIES::Vector3D n, r0, ub, ua;
 	double a, b;
 };
@@ -102,6 +105,13 @@ public:
 	 * bonds are included by default, ie flag=0; if a point is excluded then flag =1 is set
 	 */
 	virtual void filterBonds(std::vector<int>& treeList, const double *pt, const std::size_t ptLocalId, const double *xOverlap, bool* bondFlags) = 0;
+	/*
+	 * Adds the geometry of this filter to 'filterSet' for batched evaluation;
+	 * returns false if the filter has no batched form, in which case the set
+	 * falls back on filterBonds(..)
+	 */
+	virtual bool addToSet(BondFilterSet& filterSet) const { return false; }
+	bool includesSelf() const { return includeSelf; }
 protected:
 	bool includeSelf;
 };
@@ -111,6 +121,7 @@ public:
 	BondFilterDefault(bool withSelf=false) : BondFilter(withSelf) {}
 	virtual ~BondFilterDefault() {}
 	virtual void filterBonds(std::vector<int>& treeList, const double *pt, const std::size_t ptLocalId, const double *xOverlap, bool* markForExclusion);
+	virtual bool addToSet(BondFilterSet& filterSet) const { return true; }
 };
 
 /**
@@ -123,6 +134,7 @@ public:
 	FinitePlaneFilter(const FinitePlane& plane, bool withSelf) : BondFilter(withSelf), tolerance(1.0e-15),   plane(plane) {}
 	virtual ~FinitePlaneFilter() {}
 	virtual void filterBonds(std::vector<int>& treeList, const double *pt, const std::size_t ptLocalId, const double *xOverlap, bool* markForExclusion);
+	virtual bool addToSet(BondFilterSet& filterSet) const;
 private:
   double tolerance;
 	FinitePlane plane;
@@ -140,6 +152,7 @@ public:
   }
 	virtual ~DiskFilter() {}
 	virtual void filterBonds(std::vector<int>& treeList, const double *pt, const std::size_t ptLocalId, const double *xOverlap, bool* markForExclusion);
+	virtual bool addToSet(BondFilterSet& filterSet) const;
 private:
   bool bondIntersectsDisk(const double* p0, const double* p1) const;
   double tolerance;
@@ -173,6 +186,7 @@ public:
   }
 	virtual ~TriangleFilter() {}
 	virtual void filterBonds(std::vector<int>& treeList, const double *pt, const std::size_t ptLocalId, const double *xOverlap, bool* markForExclusion);
+	virtual bool addToSet(BondFilterSet& filterSet) const;
 private:
   bool bondIntersectsTriangle(const double* p0, const double* p1) const;
   bool pointInTriangle(const double* x) const;
@@ -183,6 +197,77 @@ private:
   double tolerance_;
 };
 
+/**
+ * Evaluates a collection of bond filters in a single pass over the candidate list of a point.
+ * Candidate bonds are gathered once into structure-of-arrays form and each filter runs a
+ * branch-free intersection test over all candidates.  Filters are held in a bounding volume
+ * hierarchy of axis-aligned boxes: only filters whose box lies within reach of the point's
+ * bonds are tested, and when many filters are in reach (e.g., a finely meshed crack surface
+ * from GenesisToTriangles) each bond segment is instead tested only against filters whose
+ * boxes it overlaps.  Results are identical to calling filterBonds(..) on each filter in turn.
+ */
+class BondFilterSet {
+public:
+	/*
+	 * Scratch space for filterBonds(..); use one per thread
+	 */
+	struct Workspace {
+		std::vector<double> dx, dy, dz;
+		std::vector<unsigned char> hit;
+		std::vector<std::size_t> activeFilters;
+		std::vector<int> stack;
+	};
+
+	explicit BondFilterSet(const std::vector< std::shared_ptr<BondFilter> >& filters);
+	/*
+	 * Same contract as BondFilter::filterBonds(..), applied for every filter in the set
+	 */
+	void filterBonds(std::vector<int>& treeList, const double *pt, const std::size_t ptLocalId, const double *xOverlap, bool* bondFlags, Workspace& workspace) const;
+	std::size_t size() const { return kind.size() + scalarFilters.size(); }
+
+	/*
+	 * Called from BondFilter::addToSet(..) while the set is being constructed
+	 */
+	void addFinitePlane(const double normal[3], const double lowerLeftCorner[3], const double ub[3], const double ua[3], double lengthBottom, double lengthA, double parallelTolerance, double tolerance);
+	void addDisk(const double center[3], const double normal[3], double radius, double tolerance);
+	void addTriangle(const double v1[3], const double v2[3], const double v3[3], const double normal[3], double tolerance);
+
+private:
+	enum Kind { PLANE, DISK, TRIANGLE };
+	struct PlaneData { double r0[3], n[3], ub[3], ua[3], a, b, parallelTolerance, tolerance; };
+	struct DiskData { double center[3], normal[3], radius, tolerance; };
+	struct TriangleData { double v1[3], normal[3], e31[3], e21[3], dot00, dot01, dot11, denominator, tolerance; };
+	/*
+	 * Node of the bounding volume hierarchy; the left child immediately follows its parent,
+	 * leaves hold 'count' entries of 'bvhFilters' starting at 'first'
+	 */
+	struct BVHNode { double lo[3], hi[3]; int first, count, right; };
+
+	static bool planeHit(const PlaneData& plane, const double *p0, double numerator, double dx, double dy, double dz);
+	static bool diskHit(const DiskData& disk, const double *p0, double numerator, double dx, double dy, double dz);
+	static bool triangleHit(const TriangleData& triangle, const double *p0, double numerator, double dx, double dy, double dz);
+	double numerator(std::size_t filter, const double *p0) const;
+	bool bondHit(std::size_t filter, const double *p0, double dx, double dy, double dz) const;
+	void addBoundingBox(Kind k, std::size_t index, const double lo[3], const double hi[3], bool bounded);
+	int buildBVH(int first, int count);
+	void findFilters(const double lo[3], const double hi[3], std::vector<std::size_t>& found, std::vector<int>& stack) const;
+
+	std::vector<PlaneData> planes;
+	std::vector<DiskData> disks;
+	std::vector<TriangleData> triangles;
+	/*
+	 * Kind of each batched filter, its location in the lists above, and its bounding box (lo, hi)
+	 */
+	std::vector<Kind> kind;
+	std::vector<std::size_t> index;
+	std::vector<double> boxes;
+	std::vector<BVHNode> bvh;
+	std::vector<std::size_t> bvhFilters;
+	std::vector<std::size_t> unboundedFilters;
+	std::vector< std::shared_ptr<BondFilter> > scalarFilters;
+	bool excludeSelf;
+};
+
 }
 
 #endif /* BONDFILTER_H_ */
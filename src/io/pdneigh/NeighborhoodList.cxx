@@ -58,6 +58,9 @@
 #include "Peridigm_Memstat.hpp"
 
 #include <stdexcept>
+#include <limits>
+#include <sstream>
+#include <algorithm>
 
 namespace PDNEIGH {
 
@@ -84,6 +87,14 @@ double NeighborhoodList::get_frameset_buffer_size() const {
 	return frameset_buffer_size;
 }
 
+size_t NeighborhoodList::get_num_received_points() const {
+	return num_received_points;
+}
+
+double NeighborhoodList::get_num_bytes_sent() const {
+	return num_bytes_sent;
+}
+
 size_t NeighborhoodList::get_num_owned_points() const {
 	return num_owned_points;
 }
@@ -150,6 +161,8 @@ NeighborhoodList::NeighborhoodList
 		num_owned_points(numOwnedPoints),
 		size_neighborhood_list(1),
 		frameset_buffer_size(0.0),
+		num_received_points(0),
+		num_bytes_sent(0.0),
                 horizons(horizonList),
 		owned_gids(ownedGIDs),
 		owned_x(owned_coordinates),
@@ -212,6 +225,8 @@ NeighborhoodList::NeighborhoodList
 		num_owned_points(numOwnedPoints),
 		size_neighborhood_list(1),
 		frameset_buffer_size(0.0),
+		num_received_points(0),
+		num_bytes_sent(0.0),
 		owned_gids(ownedGIDs),
 		owned_x(owned_coordinates),
 		neighborhood(),
@@ -374,117 +389,141 @@ shared_ptr<Epetra_BlockMap> getOverlap(int ndf, int numShared, const int* shared
 	return shared_ptr<Epetra_BlockMap>(new Epetra_BlockMap(-1,numPoints, ids.get(),ndf, 0,comm));
 }
 
-void NeighborhoodList::createAndAddNeighborhood(){
+/*
+ * Bounding boxes are stored as (xMin, yMin, zMin, xMax, yMax, zMax);
+ * an empty box has min > max and does not contain or intersect anything
+ */
+namespace {
 
-	enum {COMM_CREATE=9,COMM_DO=10};
+const int numHaloSubBoxes = 8;
+const int haloBoxesPerProc = numHaloSubBoxes + 1;
+
+void initializeEmptyBox(double *box){
+	for(int d=0;d<3;d++){
+		box[d]   =  std::numeric_limits<double>::max();
+		box[d+3] = -std::numeric_limits<double>::max();
+	}
+}
+
+void expandBox(double *box, const double *x, double radius){
+	for(int d=0;d<3;d++){
+		if(x[d]-radius < box[d])   box[d]   = x[d]-radius;
+		if(x[d]+radius > box[d+3]) box[d+3] = x[d]+radius;
+	}
+}
+
+bool boxContainsPoint(const double *box, const double *x){
+	for(int d=0;d<3;d++)
+		if(x[d] < box[d] || x[d] > box[d+3]) return false;
+	return true;
+}
 
-    // Find the maximum horizon and use this to create the frame set
-    double maxHorizon = 0.0;
-    for(int i=0 ; i<horizons->MyLength() ; ++i){
-      if((*horizons)[i] > maxHorizon)
-        maxHorizon = (*horizons)[i];
-    }
+bool boxesIntersect(const double *a, const double *b){
+	for(int d=0;d<3;d++)
+		if(a[d+3] < b[d] || b[d+3] < a[d]) return false;
+	return true;
+}
+
+}
 
-//	shared_ptr< std::set<int> > frameSet = constructParallelDecompositionFrameSet();
-	shared_ptr< std::set<int> > frameSet = UTILITIES::constructFrameSet(num_owned_points,owned_x,maxHorizon);
+void NeighborhoodList::createAndAddNeighborhood(){
 
+	enum {COMM_CREATE=9,COMM_DO=10};
 
-//	std::cout << "createAndAddNeighborhood:A" << std::endl;
 	int rank, numProcs;
 	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 	MPI_Comm_size(MPI_COMM_WORLD, &numProcs);
-//	std::cout << "createAndAddNeighborhood:Aa" << std::endl;
-	/*
-	 * This is the maximum possible length of communication -- every frame point goes to every processor
-	 */
-	Array<int> procsArrayPoint(numProcs);
-	Array<int> sendProcsArray(numProcs*frameSet->size());
-	Array<int> pointLocalIdsArray(numProcs*frameSet->size());
-
 
 	/*
 	 * dimension for each point must be '3'
 	 */
 	int dimension = 3;
 
-	/*
-	 * Communication plan
-	 */
-	struct Zoltan_Comm_Obj *plan;
+	double *x = owned_x.get();
+	double *horizon;
+	horizons->ExtractView(&horizon);
 
 	/*
-	 * Total number of points to be sent and received
+	 * Hierarchical halo description:  each processor describes the region in which it
+	 * needs ghosts with one box enclosing all of its owned points, each expanded by its
+	 * own horizon, and a second level of sub-boxes, one per octant of the owned points.
+	 * A point on another processor is needed only if it lies within one of these boxes;
+	 * using per-point horizons (rather than the maximum horizon) keeps the halo tight
+	 * for models with variable horizons.
 	 */
-	int nSend(0), nReceive(0);
-	int error;
-
-//	std::cout << "rank, nSend, numProcs*frameSet->size() = " << rank << ": " << nSend << ", " << numProcs*frameSet->size() << std::endl;
+	Array<double> myHaloBoxes(6*haloBoxesPerProc);
+	double ownedBox[6];
 	{
-		int* sendProcsPtr = sendProcsArray.get();
-		int* procsPointPtr = procsArrayPoint.get();
-		int* localIdsPtr = pointLocalIdsArray.get();
-
-
-		int numProcsPoint;
-		std::set<int>::iterator myPointsIter = frameSet->begin();
-		double *x = owned_x.get();
-        double *horizon;
-        horizons->ExtractView(&horizon);
-
-		for(;myPointsIter!=frameSet->end();myPointsIter++){
+		double *boxes = myHaloBoxes.get();
+		for(int b=0;b<haloBoxesPerProc;b++)
+			initializeEmptyBox(boxes+6*b);
+		initializeEmptyBox(ownedBox);
+		for(size_t p=0;p<num_owned_points;p++)
+			expandBox(ownedBox, x+dimension*p, 0.0);
+
+		double center[3];
+		for(int d=0;d<3;d++)
+			center[d] = 0.5*(ownedBox[d] + ownedBox[d+3]);
+
+		for(size_t p=0;p<num_owned_points;p++){
+			const double *xP = x+dimension*p;
+			int octant = (xP[0] > center[0] ? 1 : 0) + (xP[1] > center[1] ? 2 : 0) + (xP[2] > center[2] ? 4 : 0);
+			expandBox(boxes, xP, horizon[p]);
+			expandBox(boxes+6*(1+octant), xP, horizon[p]);
+		}
+	}
 
-			/*
-			 * This is a local id
-			 */
-			int id = *myPointsIter;
-			const double *xP = x+dimension*id;
-            const double *horizonP = horizon+id;
-			PointCenteredBoundingBox bb(xP,*horizonP);
-//			if(1==rank){
-//				std::cout << "localId, x,y,z = " << id << ", " << *xP << ", " << *(xP+1) << ", " << *(xP+2) << std::endl;
-//				std::cout << "xMin, xMax " << bb.get_xMin() << ", " << bb.get_xMax() << std::endl;
-//				std::cout << "yMin, yMax " << bb.get_yMin() << ", " << bb.get_yMax() << std::endl;
-//				std::cout << "zMin, zMax " << bb.get_zMin() << ", " << bb.get_zMax() << std::endl;
-//			}
-
-
-			Zoltan_LB_Box_Assign(zoltan,bb.get_xMin(),bb.get_yMin(),bb.get_zMin(),bb.get_xMax(),bb.get_yMax(),bb.get_zMax(),procsPointPtr,&numProcsPoint);
-			/*
-			 * Get local id and copy it nSend times into idsPtr
-			 */
-			int *ptrToSendProcs = sendProcsPtr+nSend;
-			int *i = localIdsPtr+nSend;
-//			cout << "Zoltan_LB_Box_Assign -- numProcsPoint = " << numProcsPoint << endl;
-			for(int j=0;j<numProcsPoint;j++){
-				/*
-				 * Skip this point and processor if myRank = proc
-				 * We do not send points to ourself
-				 */
-				if(rank==procsPointPtr[j]) continue;
-				*i = id;
-				/*
-				 * Increment pointers
-				 */
-				*ptrToSendProcs = procsPointPtr[j];
-				ptrToSendProcs++; i++;
+	Array<double> allHaloBoxes(6*haloBoxesPerProc*numProcs);
+	MPI_Allgather(myHaloBoxes.get(), 6*haloBoxesPerProc, MPI_DOUBLE, allHaloBoxes.get(), 6*haloBoxesPerProc, MPI_DOUBLE, MPI_COMM_WORLD);
 
-				/*
-				 * Increment total number of points to be sent
-				 */
-				nSend++;
+	/*
+	 * First level:  only processors whose halo intersects the box around this processor's points can need any of them
+	 */
+	std::vector<int> candidateProcs;
+	for(int proc=0;proc<numProcs;proc++){
+		if(proc==rank) continue;
+		if(boxesIntersect(allHaloBoxes.get()+6*haloBoxesPerProc*proc, ownedBox))
+			candidateProcs.push_back(proc);
+	}
 
+	/*
+	 * Second level:  test each owned point against the sub-boxes of the candidate processors
+	 */
+	std::vector<int> sendProcs;
+	std::vector<int> pointLocalIds;
+	for(size_t p=0;p<num_owned_points;p++){
+		const double *xP = x+dimension*p;
+		for(unsigned int c=0;c<candidateProcs.size();c++){
+			const double *procBoxes = allHaloBoxes.get()+6*haloBoxesPerProc*candidateProcs[c];
+			if(!boxContainsPoint(procBoxes, xP)) continue;
+			for(int b=1;b<haloBoxesPerProc;b++){
+				if(boxContainsPoint(procBoxes+6*b, xP)){
+					sendProcs.push_back(candidateProcs[c]);
+					pointLocalIds.push_back(p);
+					break;
+				}
 			}
 		}
+	}
 
+	/*
+	 * Communication plan
+	 */
+	struct Zoltan_Comm_Obj *plan;
 
-		/*
-		 * Create "communication" plan
-		 */
-		error = Zoltan_Comm_Create(&plan,nSend,sendProcsPtr,MPI_COMM_WORLD,COMM_CREATE,&nReceive);
-        if(error)
-          throw std::runtime_error("****Error in NeighborhoodList::createAndAddNeighborhood(), Zoltan_Comm_Create() returned a nonzero error code.");
-	}
+	/*
+	 * Total number of points to be sent and received
+	 */
+	int nSend = sendProcs.size();
+	int nReceive(0);
+	int error;
 
+	/*
+	 * Create "communication" plan
+	 */
+	error = Zoltan_Comm_Create(&plan,nSend,nSend > 0 ? &sendProcs[0] : NULL,MPI_COMM_WORLD,COMM_CREATE,&nReceive);
+	if(error)
+		throw std::runtime_error("****Error in NeighborhoodList::createAndAddNeighborhood(), Zoltan_Comm_Create() returned a nonzero error code.");
 
 	/*
 	 * Calculate size of each point sent
@@ -499,6 +538,12 @@ void NeighborhoodList::createAndAddNeighborhood(){
 	 */
 	nBytes += dimension * sizeof(double);
 
+	/*
+	 * Record communication statistics
+	 */
+	num_received_points = nReceive;
+	num_bytes_sent = static_cast<double>(nSend)*nBytes;
+
 	/*
 	 * Buffer of data to be sent and received
 	 */
@@ -510,18 +555,16 @@ void NeighborhoodList::createAndAddNeighborhood(){
 		 * Pack send buffer
 		 */
 		char *b = sendBuffPtr.get();
-		int* idsPtr = pointLocalIdsArray.get();
 		double *X = owned_x.get();
 		int* myGIds = owned_gids.get();
 
-		for(int i=0;i<nSend;i++,b+=nBytes,idsPtr++){
+		for(int i=0;i<nSend;i++,b+=nBytes){
 
 			char *tmp = b;
 			/*
 			 * Copy global id
-			 * NOTE: idsPtr is a "localId"
 			 */
-			int localId = *idsPtr;
+			int localId = pointLocalIds[i];
 
 			std::size_t numBytes = sizeof(int);
 			void* gIdPtr = (void*)(myGIds+localId);
@@ -625,35 +668,57 @@ void NeighborhoodList::buildNeighborhoodList
 )
 {
 	/*
-	 * Create KdTree
-     * There are two implemenations available:  JAM and Zoltan
+	 * this is used by bond filters
+	 */
+	const double* xOverlap = xOverlapPtr.get();
+
+	/*
+	 * Neighbors of each owned point, gathered in a single search pass
+	 * and compacted into the neighborhood list afterwards
 	 */
-    //PeridigmNS::SearchTree* searchTree = new PeridigmNS::JAMSearchTree(numOverlapPoints, xOverlapPtr.get());
-    PeridigmNS::SearchTree* searchTree = new PeridigmNS::ZoltanSearchTree(numOverlapPoints, xOverlapPtr.get());
+	std::vector< std::vector<int> > pointNeighbors(num_owned_points);
+	std::string errorMessage;
+
+	double *h;
+	horizons->ExtractView(&h);
 
 	/*
-	 * this is used by bond filters
+	 * All filters are applied in a single batched pass over each candidate list
 	 */
-	const double* xOverlap = xOverlapPtr.get();
+	const PdBondFilter::BondFilterSet filterSet(filter_ptrs);
 
-	size_t sizeList = 0;
-	size_t max=0;
+#ifdef PERIDIGM_OPENMP
+	#pragma omp parallel
+#endif
 	{
 		/*
-		 * Loop over owned points and determine number of points in horizon
+		 * Create KdTree
+		 * There are two implemenations available:  JAM and Zoltan
+		 * The search trees keep internal scratch space, so each thread searches its own tree;
+		 * the JAM tree is used for threaded searches because the Zoltan tree is not thread safe
 		 */
-		double *x = owned_x.get();
-        double *h;
-        horizons->ExtractView(&h);
-		const double *x_end = x+3*num_owned_points;
-		size_t localId=0;
-		for(;x!=x_end;x+=3, h+=1, localId++){
-
-            std::vector<int> treeList;
+#ifdef PERIDIGM_OPENMP
+		PeridigmNS::SearchTree* searchTree = new PeridigmNS::JAMSearchTree(numOverlapPoints, xOverlapPtr.get());
+#else
+		PeridigmNS::SearchTree* searchTree = new PeridigmNS::ZoltanSearchTree(numOverlapPoints, xOverlapPtr.get());
+#endif
+
+		std::vector<int> treeList;
+		Array<bool> markForExclusion;
+		PdBondFilter::BondFilterSet::Workspace filterWorkspace;
+
+#ifdef PERIDIGM_OPENMP
+		#pragma omp for schedule(dynamic, 256)
+#endif
+		for(int p=0;p<static_cast<int>(num_owned_points);p++){
+
+			const double *x = owned_x.get()+3*p;
+			treeList.clear();
+
 			/*
-			 * Note that list returned includes this point *
+			 * Note that list returned includes this point
 			 */
-			searchTree->FindPointsWithinRadius(x, *h, treeList);
+			searchTree->FindPointsWithinRadius(x, h[p], treeList);
 
 			if(0==treeList.size()){
 				/*
@@ -662,106 +727,80 @@ void NeighborhoodList::buildNeighborhoodList
 				std::stringstream sstr;
 				sstr << "\nERROR-->NeighborhoodList::buildNeighborhoodList(..)\n";
 				sstr << "\tKdTree search failed to find any points in its neighborhood including itself!\n\tThis is probably a problem.\n";
-				sstr << "\tLocal point id = " << localId << "\n"
-					 << "\tSearch horizon = " << *h << "\n"
+				sstr << "\tLocal point id = " << p << "\n"
+					 << "\tSearch horizon = " << h[p] << "\n"
 					 << "\tx,y,z = " << *(x) << ", " << *(x+1) << ", " << *(x+2) << std::endl;
-				std::string message=sstr.str();
-				throw std::runtime_error(message);
+#ifdef PERIDIGM_OPENMP
+				#pragma omp critical
+#endif
+				errorMessage = sstr.str();
+				continue;
+			}
+
+			sort(treeList.begin(), treeList.end());
+
+			if(markForExclusion.get_size() < treeList.size())
+				markForExclusion = Array<bool>(treeList.size());
+			bool *bondFlags = markForExclusion.get();
+
+			// Set all flags to "unbroken"
+			for(unsigned int iBondFlag=0 ; iBondFlag<treeList.size(); ++iBondFlag){
+			  bondFlags[iBondFlag] = 0;
 			}
 
-			size_t ptListSize = treeList.size()+1;
-			sizeList += ptListSize;
+			filterSet.filterBonds(treeList, x, p, xOverlap, bondFlags, filterWorkspace);
 
 			/*
-			 * Determine maximum possible number of neighbors over all points
+			 * Loop over flags and save neighbors as appropriate
 			 */
-			{
-                size_t numIds = treeList.size();
-				if(numIds>max) max=numIds;
+			std::vector<int>& neighbors = pointNeighbors[p];
+			for(unsigned int n=0;n<treeList.size();n++){
+				if(1==bondFlags[n]) continue;
+				neighbors.push_back(treeList[n]);
 			}
 		}
+
+		delete searchTree;
 	}
+
+	if(!errorMessage.empty())
+		throw std::runtime_error(errorMessage);
+
 	/*
-	 * Second pass to populate neighborhood list
+	 * Compact the per-point lists into the neighborhood list
 	 */
+	size_t sizeList = 0;
+	for(size_t p=0;p<num_owned_points;p++)
+		sizeList += pointNeighbors[p].size()+1;
+
 	neighborhood_ptr = Array<int>(num_owned_points);
 	neighborhood     = Array<int>(sizeList);
-	Array<bool> markForExclusion(max);
 
 	{
-		/*
-		 * Loop over owned points and determine number of points in horizon
-		 */
 		int *ptr = neighborhood_ptr.get();
 		int neighPtr = 0;
 		int *list = neighborhood.get();
-		double *x = owned_x.get();
-        double *h;
-        horizons->ExtractView(&h);
-		for(size_t p=0;p<num_owned_points;p++,x+=3,h+=1,ptr++){
+		for(size_t p=0;p<num_owned_points;p++,ptr++){
 			*ptr = neighPtr;
-            std::vector<int> treeList;
+			std::vector<int>& neighbors = pointNeighbors[p];
+			size_t numNeigh = neighbors.size();
 			/*
-			 * Note that list returned includes this point * but at start of list
-			 */
-			searchTree->FindPointsWithinRadius(x, *h, treeList);
-
-			sort(treeList.begin(), treeList.end());
-
-			bool *bondFlags = markForExclusion.get();
-
-			// Set all flags to "unbroken"
-			for(unsigned int iBondFlag=0 ; iBondFlag<treeList.size(); ++iBondFlag){
-			  bondFlags[iBondFlag] = 0;
-			}
-
-			for(unsigned int iFilter = 0 ; iFilter<filter_ptrs.size() ; iFilter++){
-			  filter_ptrs[iFilter]->filterBonds(treeList, x, p, xOverlap, bondFlags);
-			}
-
-			/*
-			 * Determine number of neighbors from flags
-			 * Save start of list so that number of neighbors can be assigned after it
-			 * has been calculated; Then increment pointer to first neighbor
-			 */
-
-			/*
-			 * Save address for number of neighbors; will assign later
-			 */
-			int *numNeighPtr = list; list++;
-			/*
-			 * Loop over flags and save neighbors as appropriate; also accumulate number of neighbors
-			 */
-			size_t numNeigh=0;
-			for(unsigned int n=0;n<treeList.size();n++,bondFlags++){
-				if(1==*bondFlags) continue;
-				int uid = treeList[n];
-				*list = uid;
-				list++;
-				numNeigh++;
-			}
-
-			/*
-			 * Now save number of neighbors
-			 */
-			*numNeighPtr = numNeigh;
-			/*
-			 * increment neighborhood pointer
+			 * Number of neighbors followed by the neighbors
 			 */
+			*list = numNeigh; list++;
+			for(size_t n=0;n<numNeigh;n++,list++)
+				*list = neighbors[n];
 			neighPtr += (numNeigh+1);
 			/*
-			 * Delete list
+			 * Release the per-point list
 			 */
+			std::vector<int>().swap(neighbors);
 		}
 	}
 
 	// output some memory statistics from here:
   PeridigmNS::Memstat * memstat = PeridigmNS::Memstat::Instance();
   memstat->addStat("Zoltan Search Tree");
-
-
-
-	delete searchTree;
 }
 
 }
@@ -142,6 +142,14 @@ public:
 			std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters = std::vector< shared_ptr<PdBondFilter::BondFilter> >()
 			);
 	double get_frameset_buffer_size() const;
+	/*
+	 * Number of ghost points received by this processor during the parallel search
+	 */
+	size_t get_num_received_points() const;
+	/*
+	 * Number of bytes sent by this processor during the parallel search
+	 */
+	double get_num_bytes_sent() const;
 	size_t get_num_owned_points() const;
 	size_t get_num_shared_points() const;
 	int get_num_neigh (int localId) const;
@@ -173,6 +181,8 @@ private:
 	std::map<Epetra_MapTag, shared_ptr<Epetra_BlockMap>, MapComparator > epetra_block_maps;
 	size_t num_owned_points, size_neighborhood_list;
 	double frameset_buffer_size;
+	size_t num_received_points;
+	double num_bytes_sent;
     Teuchos::RCP<Epetra_Vector> horizons;
 	shared_ptr<int> owned_gids;
 	shared_ptr<double> owned_x;
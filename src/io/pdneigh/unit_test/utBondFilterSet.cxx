@@ -0,0 +1,153 @@
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "../BondFilter.h"
+#include <vector>
+#include <memory>
+#include <cmath>
+
+using namespace PdBondFilter;
+using std::shared_ptr;
+
+/*
+ * Regular 6x6x6 lattice of points on [0,1]^3
+ */
+std::vector<double> getPoints() {
+	const int n = 6;
+	std::vector<double> x;
+	for(int k=0;k<n;k++)
+		for(int j=0;j<n;j++)
+			for(int i=0;i<n;i++){
+				x.push_back(i/(n-1.0));
+				x.push_back(j/(n-1.0));
+				x.push_back(k/(n-1.0));
+			}
+	return x;
+}
+
+std::vector< shared_ptr<BondFilter> > getFilters() {
+	std::vector< shared_ptr<BondFilter> > filters;
+	double sqrt2=sqrt(2.0);
+	double n[3]; n[0]=-1.0/sqrt2;n[1]=1.0/sqrt2;n[2]=0.0;
+	double r0[3]; r0[0]=0.1; r0[1]=0.1; r0[2]=0.0;
+	double ub[3]; ub[0]=1.0/sqrt2; ub[1]=1.0/sqrt2;ub[2]=0.0;
+	filters.push_back(shared_ptr<BondFilter>(new FinitePlaneFilter(FinitePlane(n,r0,ub,0.8,0.5))));
+	double center[3]; center[0]=0.5; center[1]=0.5; center[2]=0.55;
+	double normal[3]; normal[0]=0.0; normal[1]=0.0; normal[2]=1.0;
+	filters.push_back(shared_ptr<BondFilter>(new DiskFilter(center,normal,0.3)));
+	double v1[3]; v1[0]=0.45; v1[1]=0.0; v1[2]=0.0;
+	double v2[3]; v2[0]=0.45; v2[1]=1.0; v2[2]=0.0;
+	double v3[3]; v3[0]=0.45; v3[1]=0.0; v3[2]=1.0;
+	filters.push_back(shared_ptr<BondFilter>(new TriangleFilter(v1,v2,v3)));
+	/*
+	 * Far away from every point; never reached by a bond
+	 */
+	v1[0]=5.0; v2[0]=5.0; v3[0]=5.0;
+	filters.push_back(shared_ptr<BondFilter>(new TriangleFilter(v1,v2,v3)));
+	/*
+	 * Finely triangulated surface y=0.62, enough triangles in reach of a point
+	 * that each bond is tested against the bounding volume hierarchy on its own
+	 */
+	const int m = 10;
+	const double h = 1.0/m;
+	for(int i=0;i<m;i++)
+		for(int k=0;k<m;k++){
+			double a[3]; a[0]=i*h;     a[1]=0.62; a[2]=k*h;
+			double b[3]; b[0]=(i+1)*h; b[1]=0.62; b[2]=k*h;
+			double c[3]; c[0]=i*h;     c[1]=0.62; c[2]=(k+1)*h;
+			double d[3]; d[0]=(i+1)*h; d[1]=0.62; d[2]=(k+1)*h;
+			filters.push_back(shared_ptr<BondFilter>(new TriangleFilter(a,b,c)));
+			filters.push_back(shared_ptr<BondFilter>(new TriangleFilter(b,d,c)));
+		}
+	return filters;
+}
+
+TEUCHOS_UNIT_TEST(BondFilterSet, MatchesSequentialFilters) {
+
+	std::vector<double> x = getPoints();
+	int numPoints = x.size()/3;
+	std::vector< shared_ptr<BondFilter> > filters = getFilters();
+	BondFilterSet filterSet(filters);
+	BondFilterSet::Workspace workspace;
+	TEST_ASSERT(filters.size()==filterSet.size());
+
+	double horizon = 0.45;
+	int numExcluded = 0;
+	for(int p=0;p<numPoints;p++){
+		const double *pt = &x[3*p];
+		std::vector<int> treeList;
+		for(int q=0;q<numPoints;q++){
+			double dx=x[3*q]-pt[0], dy=x[3*q+1]-pt[1], dz=x[3*q+2]-pt[2];
+			if(dx*dx+dy*dy+dz*dz < horizon*horizon)
+				treeList.push_back(q);
+		}
+		std::unique_ptr<bool[]> expected(new bool[treeList.size()]);
+		std::unique_ptr<bool[]> flags(new bool[treeList.size()]);
+		for(unsigned int n=0;n<treeList.size();n++){
+			expected[n] = 0;
+			flags[n] = 0;
+		}
+		for(unsigned int iFilter=0;iFilter<filters.size();iFilter++)
+			filters[iFilter]->filterBonds(treeList, pt, p, x.data(), expected.get());
+		filterSet.filterBonds(treeList, pt, p, x.data(), flags.get(), workspace);
+		for(unsigned int n=0;n<treeList.size();n++){
+			TEST_EQUALITY(flags[n], expected[n]);
+			if(treeList[n] == p)
+				TEST_ASSERT(flags[n]);
+			if(flags[n]) numExcluded++;
+		}
+	}
+	/*
+	 * Beyond the self bonds, the filters must have removed something
+	 */
+	TEST_ASSERT(numExcluded > numPoints);
+}
+
+int main( int argc, char* argv[] ) {
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
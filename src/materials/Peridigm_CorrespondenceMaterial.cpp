@@ -50,12 +50,15 @@
 #include "elastic.h"
 #include "correspondence.h"
 #include <Teuchos_Assert.hpp>
+#include <Epetra_SerialComm.h>
+#include <Sacado.hpp>
+#include <cmath>
 
 using namespace std;
 
 PeridigmNS::CorrespondenceMaterial::CorrespondenceMaterial(const Teuchos::ParameterList& params)
   : Material(params),
-    m_density(0.0), m_hourglassCoefficient(0.0),
+    m_density(0.0), m_hourglassCoefficient(0.0), m_applyAutomaticDifferentiationJacobian(false),
     m_OMEGA(PeridigmNS::InfluenceFunction::self().getInfluenceFunction()),
     m_horizonFieldId(-1), m_volumeFieldId(-1),
     m_modelCoordinatesFieldId(-1), m_coordinatesFieldId(-1), m_velocitiesFieldId(-1), 
@@ -75,7 +78,8 @@ PeridigmNS::CorrespondenceMaterial::CorrespondenceMaterial(const Teuchos::Parame
   m_density = params.get<double>("Density");
   m_hourglassCoefficient = params.get<double>("Hourglass Coefficient");
 
-  TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Apply Automatic Differentiation Jacobian"), "**** Error:  Automatic Differentiation is not supported for correspondence material models.\n");
+  if(params.isParameter("Apply Automatic Differentiation Jacobian"))
+    m_applyAutomaticDifferentiationJacobian = params.get<bool>("Apply Automatic Differentiation Jacobian");
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Apply Shear Correction Factor"), "**** Error:  Shear Correction Factor is not supported for the correspondence material models.\n");
 
   PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
@@ -191,9 +195,10 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
                                                  const int* neighborhoodList,
                                                  PeridigmNS::DataManager& dataManager) const
 {
-  // Zero out the forces and partial stress
+  // Zero out the forces, partial stress, and hourglass forces
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
   dataManager.getData(m_partialStressFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
+  dataManager.getData(m_hourglassForceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
 
   double *horizon, *volume, *modelCoordinates, *coordinates, *velocities, *shapeTensorInverse, *deformationGradient;
   dataManager.getData(m_horizonFieldId, PeridigmField::STEP_NONE)->ExtractView(&horizon);
@@ -203,25 +208,6 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
   dataManager.getData(m_velocitiesFieldId, PeridigmField::STEP_NP1)->ExtractView(&velocities);
   dataManager.getData(m_shapeTensorInverseFieldId, PeridigmField::STEP_NONE)->ExtractView(&shapeTensorInverse);
   dataManager.getData(m_deformationGradientFieldId, PeridigmField::STEP_NONE)->ExtractView(&deformationGradient);
-  
-  // Compute the inverse of the shape tensor and the approximate deformation gradient
-  // The approximate deformation gradient will be used by the derived class (specific correspondence material model)
-  // to compute the Cauchy stress.
-  // The inverse of the shape tensor is stored for later use after the Cauchy stress calculation
-  int shapeTensorReturnCode = 
-    CORRESPONDENCE::computeShapeTensorInverseAndApproximateDeformationGradient(volume,
-                                                                               horizon,
-                                                                               modelCoordinates,
-                                                                               coordinates,
-                                                                               shapeTensorInverse,
-                                                                               deformationGradient,
-                                                                               neighborhoodList,
-                                                                               numOwnedPoints);
-  string shapeTensorErrorMessage =
-    "**** Error:  CorrespondenceMaterial::computeForce() failed to compute shape tensor.\n";
-  shapeTensorErrorMessage +=
-    "****         Note that all nodes must have a minimum of three neighbors.  Is the horizon too small?\n";
-  TEUCHOS_TEST_FOR_EXCEPT_MSG(shapeTensorReturnCode != 0, shapeTensorErrorMessage);
 
   double *leftStretchTensorN, *leftStretchTensorNP1, *rotationTensorN, *rotationTensorNP1, *unrotatedRateOfDeformation;
   dataManager.getData(m_leftStretchTensorFieldId, PeridigmField::STEP_N)->ExtractView(&leftStretchTensorN);
@@ -230,27 +216,32 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
   dataManager.getData(m_rotationTensorFieldId, PeridigmField::STEP_NP1)->ExtractView(&rotationTensorNP1);
   dataManager.getData(m_unrotatedRateOfDeformationFieldId, PeridigmField::STEP_NONE)->ExtractView(&unrotatedRateOfDeformation);
 
-  // Compute left stretch tensor, rotation tensor, and unrotated rate-of-deformation.
-  // Performs a polar decomposition via Flanagan & Taylor (1987) algorithm.
-  int rotationTensorReturnCode = CORRESPONDENCE::computeUnrotatedRateOfDeformationAndRotationTensor(volume,
-                                                                                                    horizon,
-                                                                                                    modelCoordinates, 
-                                                                                                    velocities, 
-                                                                                                    deformationGradient,
-                                                                                                    shapeTensorInverse,
-                                                                                                    leftStretchTensorN,
-                                                                                                    rotationTensorN,
-                                                                                                    leftStretchTensorNP1,
-                                                                                                    rotationTensorNP1,
-                                                                                                    unrotatedRateOfDeformation,
-                                                                                                    neighborhoodList, 
-                                                                                                    numOwnedPoints, 
-                                                                                                    dt);
-  string rotationTensorErrorMessage =
-    "**** Error:  CorrespondenceMaterial::computeForce() failed to compute rotation tensor.\n";
-  rotationTensorErrorMessage +=
+  // Compute the inverse of the shape tensor, the approximate deformation gradient, the left stretch
+  // tensor, the rotation tensor, and the unrotated rate-of-deformation in a single sweep over the
+  // neighborhood list.  The polar decomposition follows the Flanagan & Taylor (1987) algorithm.
+  // The inverse of the shape tensor and the deformation gradient are stored for later use after
+  // the Cauchy stress calculation.
+  int kinematicsReturnCode =
+    CORRESPONDENCE::computeShapeTensorInverseDeformationGradientAndUnrotatedRateOfDeformation(volume,
+                                                                                              horizon,
+                                                                                              modelCoordinates,
+                                                                                              coordinates,
+                                                                                              velocities,
+                                                                                              shapeTensorInverse,
+                                                                                              deformationGradient,
+                                                                                              leftStretchTensorN,
+                                                                                              rotationTensorN,
+                                                                                              leftStretchTensorNP1,
+                                                                                              rotationTensorNP1,
+                                                                                              unrotatedRateOfDeformation,
+                                                                                              neighborhoodList,
+                                                                                              numOwnedPoints,
+                                                                                              dt);
+  string kinematicsErrorMessage =
+    "**** Error:  CorrespondenceMaterial::computeForce() failed to compute shape tensor or rotation tensor.\n";
+  kinematicsErrorMessage +=
     "****         Note that all nodes must have a minimum of three neighbors.  Is the horizon too small?\n";
-  TEUCHOS_TEST_FOR_EXCEPT_MSG(rotationTensorReturnCode != 0, rotationTensorErrorMessage);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(kinematicsReturnCode != 0, kinematicsErrorMessage);
 
   // Evaluate the Cauchy stress using the routine implemented in the derived class (specific correspondence material model)
   // The general idea is to compute the stress based on:
@@ -278,120 +269,254 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
   // Cauchy stress is now updated and in the rotated state.  Proceed with
   // conversion to Piola-Kirchoff and force-vector states.
 
-  double *forceDensity;
+  double *forceDensity, *partialStress, *hourglassForceDensity;
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&forceDensity);
-
-  double *partialStress;
   dataManager.getData(m_partialStressFieldId, PeridigmField::STEP_NP1)->ExtractView(&partialStress);
+  dataManager.getData(m_hourglassForceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&hourglassForceDensity);
 
-  double *delta = horizon;
-  double* stress = cauchyStressNP1;
-  double* shapeTensorInv = shapeTensorInverse;
-  double* defGrad = deformationGradient;
-
-  double *modelCoordinatesPtr, *neighborModelCoordinatesPtr, *forceDensityPtr, *neighborForceDensityPtr, *partialStressPtr;
-  double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
-  double TX, TY, TZ, omega, vol, neighborVol, jacobianDeterminant;
-  int numNeighbors, neighborIndex;
+  // \todo HOURGLASS FORCES ARE NOT OUTPUT TO EXODUS CORRECTLY BECAUSE THEY ARE NOT ASSEMBLED ACROSS PROCESSORS.
+  //       They are summed into the force vector, and the force vector is assembled across processors,
+  //       so the calculation runs correctly, but the hourglass output is off.
 
+  // Convert the Cauchy stress into pairwise peridynamic force densities and add the hourglass
+  // forces for stabilization of low-energy and/or zero-energy modes, in a single sweep
+  int forceReturnCode =
+    CORRESPONDENCE::computeForceDensityAndHourglassForceDensity(volume,
+                                                                horizon,
+                                                                modelCoordinates,
+                                                                coordinates,
+                                                                deformationGradient,
+                                                                shapeTensorInverse,
+                                                                cauchyStressNP1,
+                                                                forceDensity,
+                                                                hourglassForceDensity,
+                                                                partialStress,
+                                                                neighborhoodList,
+                                                                numOwnedPoints,
+                                                                m_bulkModulus,
+                                                                m_hourglassCoefficient,
+                                                                m_OMEGA);
   string matrixInversionErrorMessage =
     "**** Error:  CorrespondenceMaterial::computeForce() failed to invert deformation gradient.\n";
   matrixInversionErrorMessage +=
     "****         Note that all nodes must have a minimum of three neighbors.  Is the horizon too small?\n";
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(forceReturnCode != 0, matrixInversionErrorMessage);
+}
 
-  vector<double> defGradInvVector(9), piolaStressVector(9), tempVector(9);
-  double* defGradInv = &defGradInvVector[0];
-  double* piolaStress = &piolaStressVector[0];
-  double* temp = &tempVector[0];
-
-  // Loop over the material points and convert the Cauchy stress into pairwise peridynamic force densities
-  const int *neighborListPtr = neighborhoodList;
-  for(int iID=0 ; iID<numOwnedPoints ; ++iID, 
-          ++delta, defGrad+=9, stress+=9, shapeTensorInv+=9){
-
-    // first Piola-Kirchhoff stress = J * cauchyStress * defGrad^-T
-
-    // Invert the deformation gradient and store the determinant
-    int matrixInversionReturnCode =
-      CORRESPONDENCE::Invert3by3Matrix(defGrad, jacobianDeterminant, defGradInv);
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(matrixInversionReturnCode != 0, matrixInversionErrorMessage);
-    
-    //P = J * \sigma * F^(-T)
-    CORRESPONDENCE::MatrixMultiply(false, true, jacobianDeterminant, stress, defGradInv, piolaStress);
-
-    // Inner product of Piola stress and the inverse of the shape tensor
-    CORRESPONDENCE::MatrixMultiply(false, false, 1.0, piolaStress, shapeTensorInv, temp);
-
-    // Loop over the neighbors and compute contribution to force densities
-    modelCoordinatesPtr = modelCoordinates + 3*iID;
-    numNeighbors = *neighborListPtr; neighborListPtr++;
-
-    for(int n=0; n<numNeighbors; n++, neighborListPtr++){
-
-      neighborIndex = *neighborListPtr;
-      neighborModelCoordinatesPtr = modelCoordinates + 3*neighborIndex;
-
-      undeformedBondX = *(neighborModelCoordinatesPtr)   - *(modelCoordinatesPtr);
-      undeformedBondY = *(neighborModelCoordinatesPtr+1) - *(modelCoordinatesPtr+1);
-      undeformedBondZ = *(neighborModelCoordinatesPtr+2) - *(modelCoordinatesPtr+2);
-      undeformedBondLength = sqrt(undeformedBondX*undeformedBondX +
-                                  undeformedBondY*undeformedBondY +
-                                  undeformedBondZ*undeformedBondZ);
-
-      omega = m_OMEGA(undeformedBondLength, *delta);
-      TX = omega * ( *(temp)   * undeformedBondX + *(temp+1) * undeformedBondY + *(temp+2) * undeformedBondZ );
-      TY = omega * ( *(temp+3) * undeformedBondX + *(temp+4) * undeformedBondY + *(temp+5) * undeformedBondZ );
-      TZ = omega * ( *(temp+6) * undeformedBondX + *(temp+7) * undeformedBondY + *(temp+8) * undeformedBondZ );
-
-      vol = volume[iID];
-      neighborVol = volume[neighborIndex];
-
-      forceDensityPtr = forceDensity + 3*iID;
-      neighborForceDensityPtr = forceDensity + 3*neighborIndex;
-
-      *(forceDensityPtr)   += TX * neighborVol;
-      *(forceDensityPtr+1) += TY * neighborVol;
-      *(forceDensityPtr+2) += TZ * neighborVol;
-      *(neighborForceDensityPtr)   -= TX * vol;
-      *(neighborForceDensityPtr+1) -= TY * vol;
-      *(neighborForceDensityPtr+2) -= TZ * vol;
-
-      partialStressPtr = partialStress + 9*iID;
-      *(partialStressPtr)   += TX*undeformedBondX*neighborVol;
-      *(partialStressPtr+1) += TX*undeformedBondY*neighborVol;
-      *(partialStressPtr+2) += TX*undeformedBondZ*neighborVol;
-      *(partialStressPtr+3) += TY*undeformedBondX*neighborVol;
-      *(partialStressPtr+4) += TY*undeformedBondY*neighborVol;
-      *(partialStressPtr+5) += TY*undeformedBondZ*neighborVol;
-      *(partialStressPtr+6) += TZ*undeformedBondX*neighborVol;
-      *(partialStressPtr+7) += TZ*undeformedBondY*neighborVol;
-      *(partialStressPtr+8) += TZ*undeformedBondZ*neighborVol;
-    }
+void
+PeridigmNS::CorrespondenceMaterial::computeJacobian(const double dt,
+                                                    const int numOwnedPoints,
+                                                    const int* ownedIDs,
+                                                    const int* neighborhoodList,
+                                                    PeridigmNS::DataManager& dataManager,
+                                                    PeridigmNS::SerialMatrix& jacobian,
+                                                    PeridigmNS::Material::JacobianType jacobianType) const
+{
+  if(m_applyAutomaticDifferentiationJacobian){
+    // Compute the Jacobian via automatic differentiation
+    computeAutomaticDifferentiationJacobian(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager, jacobian, jacobianType);
+  }
+  else{
+    // Call the base class function, which computes the Jacobian by finite difference
+    PeridigmNS::Material::computeJacobian(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager, jacobian, jacobianType);
   }
+}
 
-  // Compute hourglass forces for stabilization of low-energy and/or zero-energy modes
-  dataManager.getData(m_hourglassForceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
+void
+PeridigmNS::CorrespondenceMaterial::computeAutomaticDifferentiationCauchyStress(const double dt,
+                                                                                const int numOwnedPoints,
+                                                                                const Sacado::Fad::DFad<double>* unrotatedRateOfDeformation,
+                                                                                Sacado::Fad::DFad<double>* unrotatedCauchyStressNP1,
+                                                                                PeridigmNS::DataManager& dataManager) const
+{
+  string errorMessage =
+    "**** Error:  The automatic differentiation Jacobian is not supported by the " + Name() + " material model.\n";
+  errorMessage +=
+    "****         Remove the \"Apply Automatic Differentiation Jacobian\" parameter to use the finite-difference Jacobian.\n";
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(true, errorMessage);
+}
 
-  double *hourglassForceDensity;
-  dataManager.getData(m_hourglassForceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&hourglassForceDensity);
+void
+PeridigmNS::CorrespondenceMaterial::computeAutomaticDifferentiationJacobian(const double dt,
+                                                                            const int numOwnedPoints,
+                                                                            const int* ownedIDs,
+                                                                            const int* neighborhoodList,
+                                                                            PeridigmNS::DataManager& dataManager,
+                                                                            PeridigmNS::SerialMatrix& jacobian,
+                                                                            PeridigmNS::Material::JacobianType jacobianType) const
+{
+  // Compute contributions to the tangent matrix on an element-by-element basis.
+  //
+  // The correspondence force evaluation is repeated with AD types for the current coordinates
+  // and velocities of a single point and its neighbors.  The velocities carry a derivative of
+  // 1/dt with respect to the coordinates, which is consistent with the perturbation applied by
+  // the finite-difference Jacobian.  State data at step N enter as constants.
 
-  // \todo HOURGLASS FORCES ARE NOT OUTPUT TO EXODUS CORRECTLY BECAUSE THEY ARE NOT ASSEMBLED ACROSS PROCESSORS.
-  //       They are summed into the force vector below, and the force vector is assembled across processors,
-  //       so the calculation runs correctly, but the hourglass output is off.
+  typedef Sacado::Fad::DFad<double> Fad;
+
+  // To reduce memory re-allocation, use static variables to store Fad types for
+  // current coordinates and velocities (independent variables).
+  static vector<Fad> y_AD;
+  static vector<Fad> v_AD;
+
+  string kinematicsErrorMessage =
+    "**** Error:  CorrespondenceMaterial::computeAutomaticDifferentiationJacobian() failed to compute shape tensor or rotation tensor.\n";
+  kinematicsErrorMessage +=
+    "****         Note that all nodes must have a minimum of three neighbors.  Is the horizon too small?\n";
+  string matrixInversionErrorMessage =
+    "**** Error:  CorrespondenceMaterial::computeAutomaticDifferentiationJacobian() failed to invert deformation gradient.\n";
+  matrixInversionErrorMessage +=
+    "****         Note that all nodes must have a minimum of three neighbors.  Is the horizon too small?\n";
+
+  vector<Fad> shapeTensorInv(9), defGrad(9);
+  vector<Fad> leftStretchN(9), rotTensorN(9), leftStretchNP1(9), rotTensorNP1(9);
+  vector<Fad> unrotRateOfDef(9), unrotStressNP1(9), stressNP1(9);
+
+  // Loop over all points.
+  int neighborhoodListIndex = 0;
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+
+    // Create a temporary neighborhood consisting of a single point and its neighbors.
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    int numEntries = numNeighbors+1;
+    int numDof = 3*numEntries;
+    vector<int> tempMyGlobalIDs(numEntries);
+    // Put the node at the center of the neighborhood at the beginning of the list.
+    tempMyGlobalIDs[0] = dataManager.getOwnedScalarPointMap()->GID(iID);
+    vector<int> tempNeighborhoodList(numEntries);
+    tempNeighborhoodList[0] = numNeighbors;
+    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+      int neighborID = neighborhoodList[neighborhoodListIndex++];
+      tempMyGlobalIDs[iNID+1] = dataManager.getOverlapScalarPointMap()->GID(neighborID);
+      tempNeighborhoodList[iNID+1] = iNID+1;
+    }
 
-  CORRESPONDENCE::computeHourglassForce(volume,
-                                        horizon,
-                                        modelCoordinates,
-                                        coordinates,
-                                        deformationGradient,
-                                        hourglassForceDensity,
-                                        neighborhoodList,
-                                        numOwnedPoints,
-                                        m_bulkModulus,
-                                        m_hourglassCoefficient);
-
-  // Sum the hourglass force densities into the force densities
-  Teuchos::RCP<Epetra_Vector> forceDensityVector = dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1);
-  Teuchos::RCP<Epetra_Vector> hourglassForceDensityVector = dataManager.getData(m_hourglassForceDensityFieldId, PeridigmField::STEP_NP1);
-  forceDensityVector->Update(1.0, *hourglassForceDensityVector, 1.0);
+    Epetra_SerialComm serialComm;
+    Teuchos::RCP<Epetra_BlockMap> tempOneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numEntries, numEntries, &tempMyGlobalIDs[0], 1, 0, serialComm));
+    Teuchos::RCP<Epetra_BlockMap> tempThreeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numEntries, numEntries, &tempMyGlobalIDs[0], 3, 0, serialComm));
+    Teuchos::RCP<Epetra_BlockMap> tempBondMap = Teuchos::rcp(new Epetra_BlockMap(1, 1, &tempMyGlobalIDs[0], numNeighbors, 0, serialComm));
+
+    // Create a temporary DataManager containing data for this point and its neighborhood.
+    PeridigmNS::DataManager tempDataManager;
+    tempDataManager.setMaps(Teuchos::RCP<const Epetra_BlockMap>(),
+                            tempOneDimensionalMap,
+                            Teuchos::RCP<const Epetra_BlockMap>(),
+                            tempThreeDimensionalMap,
+                            tempBondMap);
+
+    // The temporary data manager will have the same field specs, bond storage formats, and data as the real data manager.
+    vector<int> fieldIds = dataManager.getFieldIds();
+    tempDataManager.setStorageFormats(dataManager);
+    tempDataManager.allocateData(fieldIds);
+    tempDataManager.copyLocallyOwnedDataFromDataManager(dataManager);
+
+    // There is only one owned ID, and it has local ID zero in the tempDataManager.
+    int tempNumOwnedPoints = 1;
+
+    // Use the scratchMatrix as sub-matrix for storing tangent values prior to loading them into the global tangent matrix.
+    // Resize scratchMatrix if necessary
+    if(scratchMatrix.Dimension() < numDof)
+      scratchMatrix.Resize(numDof);
+
+    // Create a list of global indices for the rows/columns in the scratch matrix.
+    vector<int> globalIndices(numDof);
+    for(int i=0 ; i<numEntries ; ++i){
+      int globalID = tempOneDimensionalMap->GID(i);
+      for(int j=0 ; j<3 ; ++j)
+        globalIndices[3*i+j] = 3*globalID+j;
+    }
+
+    // Extract pointers to the underlying data.
+    double *horizon, *volume, *modelCoordinates, *y, *v, *leftStretchTensorN, *rotationTensorN;
+    tempDataManager.getData(m_horizonFieldId, PeridigmField::STEP_NONE)->ExtractView(&horizon);
+    tempDataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&volume);
+    tempDataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&modelCoordinates);
+    tempDataManager.getData(m_coordinatesFieldId, PeridigmField::STEP_NP1)->ExtractView(&y);
+    tempDataManager.getData(m_velocitiesFieldId, PeridigmField::STEP_NP1)->ExtractView(&v);
+    tempDataManager.getData(m_leftStretchTensorFieldId, PeridigmField::STEP_N)->ExtractView(&leftStretchTensorN);
+    tempDataManager.getData(m_rotationTensorFieldId, PeridigmField::STEP_N)->ExtractView(&rotationTensorN);
+
+    // Modify the existing vectors of Fad objects for the current coordinates and velocities
+    if((int)y_AD.size() < numDof){
+      y_AD.resize(numDof);
+      v_AD.resize(numDof);
+    }
+    for(int i=0 ; i<numDof ; ++i){
+      y_AD[i].diff(i, numDof);
+      y_AD[i].val() = y[i];
+      v_AD[i].diff(i, numDof);
+      v_AD[i].val() = v[i];
+      v_AD[i].fastAccessDx(i) = 1.0/dt;
+    }
+    for(int i=0 ; i<9 ; ++i){
+      leftStretchN[i] = leftStretchTensorN[i];
+      rotTensorN[i] = rotationTensorN[i];
+    }
+
+    // Create a vector of empty AD types for the dependent variables
+    vector<Fad> force_AD(numDof);
+    vector<Fad> hourglassForce_AD(numDof);
+
+    // Evaluate the correspondence force using the AD types
+    int kinematicsReturnCode =
+      CORRESPONDENCE::computeShapeTensorInverseDeformationGradientAndUnrotatedRateOfDeformation(volume,
+                                                                                                horizon,
+                                                                                                modelCoordinates,
+                                                                                                &y_AD[0],
+                                                                                                &v_AD[0],
+                                                                                                &shapeTensorInv[0],
+                                                                                                &defGrad[0],
+                                                                                                &leftStretchN[0],
+                                                                                                &rotTensorN[0],
+                                                                                                &leftStretchNP1[0],
+                                                                                                &rotTensorNP1[0],
+                                                                                                &unrotRateOfDef[0],
+                                                                                                &tempNeighborhoodList[0],
+                                                                                                tempNumOwnedPoints,
+                                                                                                dt);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(kinematicsReturnCode != 0, kinematicsErrorMessage);
+
+    computeAutomaticDifferentiationCauchyStress(dt, tempNumOwnedPoints, &unrotRateOfDef[0], &unrotStressNP1[0], tempDataManager);
+
+    CORRESPONDENCE::rotateCauchyStress(&rotTensorNP1[0], &unrotStressNP1[0], &stressNP1[0], tempNumOwnedPoints);
+
+    // Pairwise force densities and hourglass forces; the partial stress is not needed here
+    int forceReturnCode =
+      CORRESPONDENCE::computeForceDensityAndHourglassForceDensity(volume,
+                                                                  horizon,
+                                                                  modelCoordinates,
+                                                                  &y_AD[0],
+                                                                  &defGrad[0],
+                                                                  &shapeTensorInv[0],
+                                                                  &stressNP1[0],
+                                                                  &force_AD[0],
+                                                                  &hourglassForce_AD[0],
+                                                                  (Fad*)NULL,
+                                                                  &tempNeighborhoodList[0],
+                                                                  tempNumOwnedPoints,
+                                                                  m_bulkModulus,
+                                                                  m_hourglassCoefficient,
+                                                                  m_OMEGA);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(forceReturnCode != 0, matrixInversionErrorMessage);
+
+    // Load derivative values into scratch matrix
+    // Multiply by volume along the way to convert force density to force
+    double value;
+    for(int row=0 ; row<numDof ; ++row){
+      for(int col=0 ; col<numDof ; ++col){
+        value = force_AD[row].dx(col) * volume[row/3];
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(value), "**** NaN detected in CorrespondenceMaterial::computeAutomaticDifferentiationJacobian().\n");
+        scratchMatrix(row, col) = value;
+      }
+    }
+
+    // Sum the values into the global tangent matrix (this is expensive).
+    if (jacobianType == PeridigmNS::Material::FULL_MATRIX)
+      jacobian.addValues((int)globalIndices.size(), &globalIndices[0], scratchMatrix.Data());
+    else if (jacobianType == PeridigmNS::Material::BLOCK_DIAGONAL) {
+      jacobian.addBlockDiagonalValues((int)globalIndices.size(), &globalIndices[0], scratchMatrix.Data());
+    }
+    else // unknown jacobian type
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Unknown Jacobian Type\n");
+  }
 }
@@ -50,6 +50,7 @@
 
 #include "Peridigm_Material.hpp"
 #include "Peridigm_InfluenceFunction.hpp"
+#include <Sacado.hpp>
 
 namespace PeridigmNS {
 
@@ -96,6 +97,35 @@ namespace PeridigmNS {
                               const int* neighborhoodList,
                               PeridigmNS::DataManager& dataManager) const;
 
+    //! Evaluate the jacobian.
+    virtual void
+    computeJacobian(const double dt,
+                    const int numOwnedPoints,
+                    const int* ownedIDs,
+                    const int* neighborhoodList,
+                    PeridigmNS::DataManager& dataManager,
+                    PeridigmNS::SerialMatrix& jacobian,
+                    PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const;
+
+    //! Evaluate the jacobian via automatic differentiation.
+    virtual void
+    computeAutomaticDifferentiationJacobian(const double dt,
+                                            const int numOwnedPoints,
+                                            const int* ownedIDs,
+                                            const int* neighborhoodList,
+                                            PeridigmNS::DataManager& dataManager,
+                                            PeridigmNS::SerialMatrix& jacobian,
+                                            PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const;
+
+    //! Evaluate the unrotated Cauchy stress using AD types (must be implemented by derived correspondence material models that support the automatic differentiation Jacobian).
+    //! State at step N is read from the DataManager, nothing is written to it.
+    virtual void
+    computeAutomaticDifferentiationCauchyStress(const double dt,
+                                                const int numOwnedPoints,
+                                                const Sacado::Fad::DFad<double>* unrotatedRateOfDeformation,
+                                                Sacado::Fad::DFad<double>* unrotatedCauchyStressNP1,
+                                                PeridigmNS::DataManager& dataManager) const;
+
   protected:
 
     // material parameters
@@ -103,6 +133,7 @@ namespace PeridigmNS {
     double m_shearModulus;
     double m_density;
     double m_hourglassCoefficient;
+    bool m_applyAutomaticDifferentiationJacobian;
     PeridigmNS::InfluenceFunction::functionPointer m_OMEGA;
 
     // field spec ids for all relevant data
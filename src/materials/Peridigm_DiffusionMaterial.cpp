@@ -48,6 +48,7 @@
 #include "Peridigm_DiffusionMaterial.hpp"
 #include "Peridigm_Field.hpp"
 #include "Peridigm_Constants.hpp"
+#include "Peridigm_DegreesOfFreedomManager.hpp"
 #ifdef PERIDIGM_IMPROVED_QUADRATURE
   #include <gsl/gsl_linalg.h>
   #include <gsl/gsl_cblas.h>
@@ -149,9 +150,6 @@ PeridigmNS::DiffusionMaterial::computeFluxDivergence(const double dt,
                                                      const int* neighborhoodList,
                                                      PeridigmNS::DataManager& dataManager) const
 {
-  Teuchos::RCP< std::map< std::string, std::vector<int> > > node_sets = bc_manager_->getNodeSets();
-  //std::cout << "DEBUGGING number of node sets " << node_sets->size() << std::endl;
-
   // Zero out the flux divergence
   dataManager.getData(m_fluxDivergenceFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
 
@@ -191,8 +189,97 @@ PeridigmNS::DiffusionMaterial::computeFluxDivergence(const double dt,
       kernel = 6.0/(pi*m_horizon*m_horizon*m_horizon*m_horizon*initialDistance);
       temperatureDifference = temperature[neighborID] - nodeTemperature;
       nodeFluxDivergence = m_coefficient*kernel*temperatureDifference*quadWeight;
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(nodeFluxDivergence), "**** NaN detected in DiffusionMaterial::computeFluxDivergence().\n");
       fluxDivergence[iID] += nodeFluxDivergence;
     }
   }
+
+  // Check for NaNs after the fact; a non-finite bond contribution propagates into the nodal sum
+  bool isFinite = true;
+  for(iID=0 ; iID<numOwnedPoints ; ++iID)
+    isFinite &= std::isfinite(fluxDivergence[iID]);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!isFinite, "**** NaN detected in DiffusionMaterial::computeFluxDivergence().\n");
+}
+
+void
+PeridigmNS::DiffusionMaterial::computeJacobian(const double dt,
+                                               const int numOwnedPoints,
+                                               const int* ownedIDs,
+                                               const int* neighborhoodList,
+                                               PeridigmNS::DataManager& dataManager,
+                                               PeridigmNS::SerialMatrix& jacobian,
+                                               PeridigmNS::Material::JacobianType jacobianType) const
+{
+  // The flux divergence is linear in the temperature, so the Jacobian is assembled directly from the bond kernel:
+  //
+  //   d(fluxDivergence_i)/dT_j =  coefficient * kernel_ij * quadWeight_ij
+  //   d(fluxDivergence_i)/dT_i = -sum_j d(fluxDivergence_i)/dT_j
+  //
+  // Only the row of the owned point is nonzero, so a single row is summed into the tangent for each point.
+
+  PeridigmNS::DegreesOfFreedomManager& dofManager = PeridigmNS::DegreesOfFreedomManager::self();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!dofManager.temperatureTreatedAsUnknown(), "**** DiffusionMaterial::computeJacobian() requires that temperature be treated as an unknown.\n");
+  int numDof = dofManager.totalNumberOfDegreesOfFreedom();
+  int temperatureDofOffset = dofManager.temperatureDofOffset();
+
+  // Extract pointers to the underlying data
+  double *volume, *modelCoord, *quadratureWeights;
+  dataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&volume);
+  dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&modelCoord);
+  if (m_useImprovedQuadrature) {
+    dataManager.getData(m_quadratureWeightsFieldId, PeridigmField::STEP_NONE)->ExtractView(&quadratureWeights);
+  }
+
+  const Epetra_BlockMap& ownedScalarPointMap = *dataManager.getOwnedScalarPointMap();
+  const Epetra_BlockMap& overlapScalarPointMap = *dataManager.getOverlapScalarPointMap();
+
+  const double pi = value_of_pi();
+  const double kernelConstant = 6.0/(pi*m_horizon*m_horizon*m_horizon*m_horizon);
+
+  std::vector<int> globalIndices;
+  std::vector<double> values;
+
+  int neighborhoodListIndex(0), bondListIndex(0);
+  int numNeighbors, neighborID, iID, iNID;
+  double nodeInitialPosition[3], initialDistance, quadWeight, value, diagonalValue;
+
+  for(iID=0 ; iID<numOwnedPoints ; ++iID){
+    nodeInitialPosition[0] = modelCoord[iID*3];
+    nodeInitialPosition[1] = modelCoord[iID*3+1];
+    nodeInitialPosition[2] = modelCoord[iID*3+2];
+    numNeighbors = neighborhoodList[neighborhoodListIndex++];
+
+    // The first entry in the row is the diagonal, followed by one entry for each neighbor
+    globalIndices.resize(numNeighbors+1);
+    values.resize(numNeighbors+1);
+    int globalRow = numDof*ownedScalarPointMap.GID(iID) + temperatureDofOffset;
+    globalIndices[0] = globalRow;
+
+    // Multiply by nodal volume along the way to convert flux divergence density to flux divergence
+    diagonalValue = 0.0;
+    for(iNID=0 ; iNID<numNeighbors ; ++iNID){
+      neighborID = neighborhoodList[neighborhoodListIndex++];
+      quadWeight = volume[neighborID];
+      if (m_useImprovedQuadrature) {
+        quadWeight = quadratureWeights[bondListIndex++];
+      }
+      initialDistance = distance(nodeInitialPosition[0], nodeInitialPosition[1], nodeInitialPosition[2],
+				 modelCoord[neighborID*3], modelCoord[neighborID*3+1], modelCoord[neighborID*3+2]);
+      value = m_coefficient*kernelConstant*quadWeight*volume[iID]/initialDistance;
+      globalIndices[iNID+1] = numDof*overlapScalarPointMap.GID(neighborID) + temperatureDofOffset;
+      values[iNID+1] = value;
+      diagonalValue -= value;
+    }
+    values[0] = diagonalValue;
+
+    // Check for NaNs; any non-finite off-diagonal entry propagates into the diagonal
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(diagonalValue), "**** NaN detected in DiffusionMaterial::computeJacobian().\n");
+
+    // Sum the values into the global tangent matrix
+    if (jacobianType == PeridigmNS::Material::FULL_MATRIX)
+      jacobian.addRowValues(globalRow, numNeighbors+1, &globalIndices[0], &values[0]);
+    else if (jacobianType == PeridigmNS::Material::BLOCK_DIAGONAL)
+      jacobian.addRowValues(globalRow, 1, &globalIndices[0], &values[0]);
+    else // unknown jacobian type
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Unknown Jacobian Type\n");
+  }
 }
@@ -107,6 +107,16 @@ namespace PeridigmNS {
                           const int* neighborhoodList,
                           PeridigmNS::DataManager& dataManager) const;
 
+    //! Evaluate the jacobian of the flux divergence with respect to the temperature.
+    virtual void
+    computeJacobian(const double dt,
+                    const int numOwnedPoints,
+                    const int* ownedIDs,
+                    const int* neighborhoodList,
+                    PeridigmNS::DataManager& dataManager,
+                    PeridigmNS::SerialMatrix& jacobian,
+                    PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const;
+
   protected:
 
     //! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
@@ -48,6 +48,7 @@
 #include "Peridigm_ElasticBondBasedMaterial.hpp"
 #include "Peridigm_Field.hpp"
 #include "elastic_bond_based.h"
+#include "Peridigm_BitPackedBondData.hpp"
 #include <Teuchos_Assert.hpp>
 
 PeridigmNS::ElasticBondBasedMaterial::ElasticBondBasedMaterial(const Teuchos::ParameterList& params)
@@ -108,8 +109,55 @@ PeridigmNS::ElasticBondBasedMaterial::computeForce(const double dt,
   dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
   dataManager.getData(m_coordinatesFieldId, PeridigmField::STEP_NP1)->ExtractView(&y);
   dataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
-  dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&force);
 
-  MATERIAL_EVALUATION::computeInternalForceElasticBondBased(x,y,cellVolume,bondDamage,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_horizon);
+  // The kernel is instantiated for each bond damage storage format
+  if(dataManager.isBitPacked(m_bondDamageFieldId)){
+    PeridigmNS::BitPackedBondView bitPackedBondDamage(dataManager.getBitPackedData(m_bondDamageFieldId, PeridigmField::STEP_NP1));
+    MATERIAL_EVALUATION::computeInternalForceElasticBondBased(x,y,cellVolume,bitPackedBondDamage,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_horizon);
+  }
+  else if(dataManager.isSinglePrecision(m_bondDamageFieldId)){
+    const float* singlePrecisionBondDamage = dataManager.getSinglePrecisionData(m_bondDamageFieldId, PeridigmField::STEP_NP1);
+    MATERIAL_EVALUATION::computeInternalForceElasticBondBased(x,y,cellVolume,singlePrecisionBondDamage,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_horizon);
+  }
+  else{
+    dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+    MATERIAL_EVALUATION::computeInternalForceElasticBondBased(x,y,cellVolume,static_cast<const double*>(bondDamage),force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_horizon);
+  }
+}
+
+void
+PeridigmNS::ElasticBondBasedMaterial::computeForceOnPoints(const double dt,
+                                                           const int numOwnedPoints,
+                                                           const int* ownedIDs,
+                                                           const int* neighborhoodList,
+                                                           PeridigmNS::DataManager& dataManager,
+                                                           const int firstPoint,
+                                                           const int lastPoint) const
+{
+  // Zero out the forces at the start of a split evaluation; later ranges accumulate
+  if(firstPoint == 0)
+    dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
+
+  // Extract pointers to the underlying data
+  double *x, *y, *cellVolume, *bondDamage, *force;
+
+  dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
+  dataManager.getData(m_coordinatesFieldId, PeridigmField::STEP_NP1)->ExtractView(&y);
+  dataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
+  dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&force);
+
+  // The kernel is instantiated for each bond damage storage format
+  if(dataManager.isBitPacked(m_bondDamageFieldId)){
+    PeridigmNS::BitPackedBondView bitPackedBondDamage(dataManager.getBitPackedData(m_bondDamageFieldId, PeridigmField::STEP_NP1));
+    MATERIAL_EVALUATION::computeInternalForceElasticBondBasedOnPoints(x,y,cellVolume,bitPackedBondDamage,force,neighborhoodList,firstPoint,lastPoint,m_bulkModulus,m_horizon);
+  }
+  else if(dataManager.isSinglePrecision(m_bondDamageFieldId)){
+    const float* singlePrecisionBondDamage = dataManager.getSinglePrecisionData(m_bondDamageFieldId, PeridigmField::STEP_NP1);
+    MATERIAL_EVALUATION::computeInternalForceElasticBondBasedOnPoints(x,y,cellVolume,singlePrecisionBondDamage,force,neighborhoodList,firstPoint,lastPoint,m_bulkModulus,m_horizon);
+  }
+  else{
+    dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+    MATERIAL_EVALUATION::computeInternalForceElasticBondBasedOnPoints(x,y,cellVolume,static_cast<const double*>(bondDamage),force,neighborhoodList,firstPoint,lastPoint,m_bulkModulus,m_horizon);
+  }
 }
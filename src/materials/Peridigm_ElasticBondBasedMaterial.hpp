@@ -81,6 +81,12 @@ namespace PeridigmNS {
     //! Returns a vector of field IDs corresponding to the variables associated with the material.
     virtual std::vector<int> FieldIds() const { return m_fieldIds; }
 
+    //! Bond damage may be stored in single precision; forces are accumulated in double precision.
+    virtual std::vector<int> SinglePrecisionBondFieldIds() const { return std::vector<int>(1, m_bondDamageFieldId); }
+
+    //! Bond damage may be stored as one bit per bond when it is produced by a binary damage model.
+    virtual std::vector<int> BitPackedBondFieldIds() const { return std::vector<int>(1, m_bondDamageFieldId); }
+
     //! Initialized data containers and computes weighted volume.
     virtual void
     initialize(const double dt,
@@ -97,6 +103,19 @@ namespace PeridigmNS {
                  const int* neighborhoodList,
                  PeridigmNS::DataManager& dataManager) const;
 
+    //! The bond-based force can be split over ranges of owned points.
+    virtual bool supportsPartialForceEvaluation() const { return true; }
+
+    //! Evaluate the internal force contributions of owned points firstPoint through lastPoint-1.
+    virtual void
+    computeForceOnPoints(const double dt,
+                         const int numOwnedPoints,
+                         const int* ownedIDs,
+                         const int* neighborhoodList,
+                         PeridigmNS::DataManager& dataManager,
+                         const int firstPoint,
+                         const int lastPoint) const;
+
   protected:
 	
     //! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
@@ -119,3 +119,40 @@ PeridigmNS::ElasticCorrespondenceMaterial::computeCauchyStress(const double dt,
                                             m_alpha,
                                             dt);
 }
+
+void
+PeridigmNS::ElasticCorrespondenceMaterial::computeAutomaticDifferentiationCauchyStress(const double dt,
+                                                                                       const int numOwnedPoints,
+                                                                                       const Sacado::Fad::DFad<double>* unrotatedRateOfDeformation,
+                                                                                       Sacado::Fad::DFad<double>* unrotatedCauchyStressNP1,
+                                                                                       PeridigmNS::DataManager& dataManager) const
+{
+  // State data at step N enter the AD evaluation as constants
+  double *unrotatedCauchyStressN;
+  dataManager.getData(m_unrotatedCauchyStressFieldId, PeridigmField::STEP_N)->ExtractView(&unrotatedCauchyStressN);
+  vector<Sacado::Fad::DFad<double> > unrotatedCauchyStressN_AD(unrotatedCauchyStressN, unrotatedCauchyStressN + 9*numOwnedPoints);
+
+  vector<Sacado::Fad::DFad<double> > deltaTemperatureN_AD, deltaTemperatureNP1_AD;
+  const Sacado::Fad::DFad<double> *deltaTemperatureN = 0;
+  const Sacado::Fad::DFad<double> *deltaTemperatureNP1 = 0;
+  if(m_applyThermalStrains){
+    double *deltaTemperatureNValues, *deltaTemperatureNP1Values;
+    dataManager.getData(m_deltaTemperatureFieldId, PeridigmField::STEP_N)->ExtractView(&deltaTemperatureNValues);
+    dataManager.getData(m_deltaTemperatureFieldId, PeridigmField::STEP_NP1)->ExtractView(&deltaTemperatureNP1Values);
+    deltaTemperatureN_AD.assign(deltaTemperatureNValues, deltaTemperatureNValues + numOwnedPoints);
+    deltaTemperatureNP1_AD.assign(deltaTemperatureNP1Values, deltaTemperatureNP1Values + numOwnedPoints);
+    deltaTemperatureN = &deltaTemperatureN_AD[0];
+    deltaTemperatureNP1 = &deltaTemperatureNP1_AD[0];
+  }
+
+  CORRESPONDENCE::updateElasticCauchyStress(deltaTemperatureN,
+                                            deltaTemperatureNP1,
+                                            unrotatedRateOfDeformation,
+                                            &unrotatedCauchyStressN_AD[0],
+                                            unrotatedCauchyStressNP1,
+                                            numOwnedPoints,
+                                            m_bulkModulus,
+                                            m_shearModulus,
+                                            m_alpha,
+                                            dt);
+}
@@ -60,6 +60,7 @@ PeridigmNS::ElasticMaterial::ElasticMaterial(const Teuchos::ParameterList& param
   : Material(params),
     m_bulkModulus(0.0), m_shearModulus(0.0), m_density(0.0), m_alpha(0.0), m_horizon(0.0),
     m_applyAutomaticDifferentiationJacobian(true),
+    m_cacheBondGeometry(false),
     m_applyThermalStrains(false),
     m_computePartialStress(false),
     m_OMEGA(PeridigmNS::InfluenceFunction::self().getInfluenceFunction()),
@@ -74,6 +75,8 @@ PeridigmNS::ElasticMaterial::ElasticMaterial(const Teuchos::ParameterList& param
   m_horizon = params.get<double>("Horizon");
   if(params.isParameter("Apply Automatic Differentiation Jacobian"))
     m_applyAutomaticDifferentiationJacobian = params.get<bool>("Apply Automatic Differentiation Jacobian");
+  if(params.isParameter("Cache Bond Geometry"))
+    m_cacheBondGeometry = params.get<bool>("Cache Bond Geometry");
 
   if(params.isParameter("Thermal Expansion Coefficient")){
     m_alpha = params.get<double>("Thermal Expansion Coefficient");
@@ -167,8 +170,19 @@ PeridigmNS::ElasticMaterial::computeForce(const double dt,
   if(m_computePartialStress)
     dataManager.getData(m_partialStressFieldId, PeridigmField::STEP_NP1)->ExtractView(&partialStress);
 
-  MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,cellVolume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
-  MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,y,weightedVolume,cellVolume,dilatation,bondDamage,force,partialStress,neighborhoodList,numOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
+  // Optionally cache the bond geometry evaluated in the dilatation sweep for reuse by the force evaluation
+  double* bondGeometry = NULL;
+  if(m_cacheBondGeometry){
+    m_bondGeometry.resize(MATERIAL_EVALUATION::BOND_GEOMETRY_SIZE*dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->MyLength());
+    if(!m_bondGeometry.empty())
+      bondGeometry = &m_bondGeometry[0];
+  }
+
+  // Partition the owned points among threads; the reaction-force scatter goes through thread-private buffers
+  threadForceBuffers.Setup(numOwnedPoints, neighborhoodList, dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->MyLength());
+
+  MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,cellVolume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature,bondGeometry);
+  MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,y,weightedVolume,cellVolume,dilatation,bondDamage,force,partialStress,neighborhoodList,numOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature,bondGeometry,&threadForceBuffers);
 }
 
 void
@@ -255,6 +269,94 @@ PeridigmNS::ElasticMaterial::computeJacobian(const double dt,
 }
 
 
+template<typename FadT>
+void
+PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobianBlock(const int numDof,
+                                                                          const double* x,
+                                                                          const double* y,
+                                                                          const double* cellVolume,
+                                                                          const double* weightedVolume,
+                                                                          const double* bondDamage,
+                                                                          const double* deltaTemperature,
+                                                                          const int* tempNeighborhoodList) const
+{
+  int numEntries = numDof/3;
+  int tempNumOwnedPoints = 1;
+
+  // To reduce memory re-allocation, use static variable to store Fad types for
+  // current coordinates (independent variables).
+  static vector<FadT> y_AD;
+
+  // Create arrays of Fad objects for the current coordinates, dilatation, and force density
+  // Modify the existing vector of Fad objects for the current coordinates
+  if((int)y_AD.size() < numDof)
+    y_AD.resize(numDof);
+  for(int i=0 ; i<numDof ; ++i){
+    y_AD[i].diff(i, numDof);
+    y_AD[i].val() = y[i];
+  }
+  // Create vectors of empty AD types for the dependent variables
+  vector<FadT> dilatation_AD(numEntries);
+  vector<FadT> force_AD(numDof);
+
+  // The partial stress is accumulated for the single owned point only
+  vector<FadT> partialStress_AD;
+  FadT *partialStress_AD_Ptr = NULL;
+  if(m_computePartialStress){
+    partialStress_AD.resize(9*tempNumOwnedPoints);
+    partialStress_AD_Ptr = &partialStress_AD[0];
+  }
+
+  // Evaluate the constitutive model using the AD types
+  MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],tempNeighborhoodList,tempNumOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
+  MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,&y_AD[0],weightedVolume,cellVolume,&dilatation_AD[0],bondDamage,&force_AD[0],partialStress_AD_Ptr,tempNeighborhoodList,tempNumOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
+
+  // Load derivative values into scratch matrix
+  // Multiply by volume along the way to convert force density to force
+  double value;
+  for(int row=0 ; row<numDof ; ++row){
+    for(int col=0 ; col<numDof ; ++col){
+      value = force_AD[row].dx(col) * cellVolume[row/3];
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(value), "**** NaN detected in ElasticMaterial::computeAutomaticDifferentiationJacobian().\n");
+      scratchMatrix(row, col) = value;
+    }
+  }
+}
+
+template void PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::DFad<double> >(const int numDof,
+                                                                                                                const double* x,
+                                                                                                                const double* y,
+                                                                                                                const double* cellVolume,
+                                                                                                                const double* weightedVolume,
+                                                                                                                const double* bondDamage,
+                                                                                                                const double* deltaTemperature,
+                                                                                                                const int* tempNeighborhoodList) const;
+
+void
+PeridigmNS::ElasticMaterial::evaluateAutomaticDifferentiationJacobianBlock(const int numDof,
+                                                                           const double* x,
+                                                                           const double* y,
+                                                                           const double* cellVolume,
+                                                                           const double* weightedVolume,
+                                                                           const double* bondDamage,
+                                                                           const double* deltaTemperature,
+                                                                           const int* tempNeighborhoodList) const
+{
+  // Evaluate the constitutive model with the smallest static-storage AD type that can hold numDof derivative
+  // components, which avoids a heap allocation for every intermediate Fad value; large neighborhoods fall back
+  // to the dynamically-sized Fad type.
+  if(numDof <= 64)
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::SLFad<double,64> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature, tempNeighborhoodList);
+  else if(numDof <= 128)
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::SLFad<double,128> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature, tempNeighborhoodList);
+  else if(numDof <= 256)
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::SLFad<double,256> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature, tempNeighborhoodList);
+  else if(numDof <= 512)
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::SLFad<double,512> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature, tempNeighborhoodList);
+  else
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::DFad<double> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature, tempNeighborhoodList);
+}
+
 void
 PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const double dt,
                                                                      const int numOwnedPoints,
@@ -266,10 +368,6 @@ PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const doubl
 {
   // Compute contributions to the tangent matrix on an element-by-element basis
 
-  // To reduce memory re-allocation, use static variable to store Fad types for
-  // current coordinates (independent variables).
-  static vector<Sacado::Fad::DFad<double> > y_AD;
-
   // Loop over all points.
   int neighborhoodListIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
@@ -302,8 +400,9 @@ PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const doubl
                             tempThreeDimensionalMap,
                             tempBondMap);
 
-    // The temporary data manager will have the same field specs and data as the real data manager.
+    // The temporary data manager will have the same field specs, bond storage formats, and data as the real data manager.
     vector<int> fieldIds = dataManager.getFieldIds();
+    tempDataManager.setStorageFormats(dataManager);
     tempDataManager.allocateData(fieldIds);
     tempDataManager.copyLocallyOwnedDataFromDataManager(dataManager);
 
@@ -337,39 +436,7 @@ PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const doubl
     deltaTemperature = NULL;
     if(m_applyThermalStrains)
       tempDataManager.getData(m_deltaTemperatureFieldId, PeridigmField::STEP_NP1)->ExtractView(&deltaTemperature);
-    // Create arrays of Fad objects for the current coordinates, dilatation, and force density
-    // Modify the existing vector of Fad objects for the current coordinates
-    if((int)y_AD.size() < numDof)
-      y_AD.resize(numDof);
-    for(int i=0 ; i<numDof ; ++i){
-      y_AD[i].diff(i, numDof);
-      y_AD[i].val() = y[i];
-    }
-    // Create vectors of empty AD types for the dependent variables
-    vector<Sacado::Fad::DFad<double> > dilatation_AD(numEntries);
-    vector<Sacado::Fad::DFad<double> > force_AD(numDof);
-
-    vector<Sacado::Fad::DFad<double> > partialStress_AD;
-    Sacado::Fad::DFad<double> *partialStress_AD_Ptr = NULL;
-    if(m_computePartialStress){
-      partialStress_AD.resize(numDof*numDof);
-      partialStress_AD_Ptr = &partialStress_AD[0];
-    }
-
-    // Evaluate the constitutive model using the AD types
-    MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],&tempNeighborhoodList[0],tempNumOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
-    MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,&y_AD[0],weightedVolume,cellVolume,&dilatation_AD[0],bondDamage,&force_AD[0],partialStress_AD_Ptr,&tempNeighborhoodList[0],tempNumOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
-
-    // Load derivative values into scratch matrix
-    // Multiply by volume along the way to convert force density to force
-    double value;
-    for(int row=0 ; row<numDof ; ++row){
-      for(int col=0 ; col<numDof ; ++col){
-	value = force_AD[row].dx(col) * cellVolume[row/3];
-	TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(value), "**** NaN detected in ElasticMaterial::computeAutomaticDifferentiationJacobian().\n");
-        scratchMatrix(row, col) = value;
-      }
-    }
+    evaluateAutomaticDifferentiationJacobianBlock(numDof, x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature, &tempNeighborhoodList[0]);
 
     // Sum the values into the global tangent matrix (this is expensive).
     if (jacobianType == PeridigmNS::Material::FULL_MATRIX)
@@ -166,7 +166,35 @@ namespace PeridigmNS {
                                             PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const;
 
   protected:
-	
+
+    /*! \brief Evaluates the tangent for a single neighborhood and stores it in the scratch matrix.
+     *
+     *  The neighborhood is evaluated with the smallest Sacado::Fad::SLFad type that holds numDof derivative
+     *  components, or with Sacado::Fad::DFad if numDof exceeds 512.  The ElasticPlastic and ElasticPlasticHardening
+     *  materials use the same buckets.  The MultiphysicsElastic and correspondence models still evaluate their tangents
+     *  with DFad: the former differentiates the coupled force and fluid flow kernels with respect to four degrees of
+     *  freedom per point, and the latter would need every kernel in correspondence.cxx instantiated once per bucket.
+     */
+    virtual void evaluateAutomaticDifferentiationJacobianBlock(const int numDof,
+                                                               const double* x,
+                                                               const double* y,
+                                                               const double* cellVolume,
+                                                               const double* weightedVolume,
+                                                               const double* bondDamage,
+                                                               const double* deltaTemperature,
+                                                               const int* tempNeighborhoodList) const;
+
+    //! Evaluates the tangent for a single neighborhood with the given Fad type and stores it in the scratch matrix.
+    template<typename FadT>
+    void computeAutomaticDifferentiationJacobianBlock(const int numDof,
+                                                      const double* x,
+                                                      const double* y,
+                                                      const double* cellVolume,
+                                                      const double* weightedVolume,
+                                                      const double* bondDamage,
+                                                      const double* deltaTemperature,
+                                                      const int* tempNeighborhoodList) const;
+
     //! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
     inline double distance(double a1, double a2, double a3,
                            double b1, double b2, double b3) const
@@ -181,6 +209,7 @@ namespace PeridigmNS {
     double m_alpha;
     double m_horizon;
     bool m_applyAutomaticDifferentiationJacobian;
+    bool m_cacheBondGeometry;
     bool m_applyThermalStrains;
     bool m_computePartialStress;
     PeridigmNS::InfluenceFunction::functionPointer m_OMEGA;
@@ -198,6 +227,9 @@ namespace PeridigmNS {
     int m_bondDamageFieldId;
     int m_temperatureFieldId;
     int m_deltaTemperatureFieldId;
+
+    //! Scratch storage for the bond geometry shared by the dilatation and force evaluations.
+    mutable std::vector<double> m_bondGeometry;
   };
 }
 
@@ -128,3 +128,35 @@ PeridigmNS::ElasticPlasticCorrespondenceMaterial::computeCauchyStress(const doub
                                                             m_yieldStress, 
                                                             dt);
 }
+
+void
+PeridigmNS::ElasticPlasticCorrespondenceMaterial::computeAutomaticDifferentiationCauchyStress(const double dt,
+                                                                                              const int numOwnedPoints,
+                                                                                              const Sacado::Fad::DFad<double>* unrotatedRateOfDeformation,
+                                                                                              Sacado::Fad::DFad<double>* unrotatedCauchyStressNP1,
+                                                                                              PeridigmNS::DataManager& dataManager) const
+{
+  // State data at step N enter the AD evaluation as constants
+  double *unrotatedCauchyStressN;
+  dataManager.getData(m_unrotatedCauchyStressFieldId, PeridigmField::STEP_N)->ExtractView(&unrotatedCauchyStressN);
+  vector<Sacado::Fad::DFad<double> > unrotatedCauchyStressN_AD(unrotatedCauchyStressN, unrotatedCauchyStressN + 9*numOwnedPoints);
+
+  double *equivalentPlasticStrainN;
+  dataManager.getData(m_equivalentPlasticStrainFieldId, PeridigmField::STEP_N)->ExtractView(&equivalentPlasticStrainN);
+  vector<Sacado::Fad::DFad<double> > equivalentPlasticStrainN_AD(equivalentPlasticStrainN, equivalentPlasticStrainN + numOwnedPoints);
+
+  // Von Mises stress and equivalent plastic strain at step N+1 are not needed for the Jacobian
+  vector<Sacado::Fad::DFad<double> > vonMisesStress_AD(numOwnedPoints), equivalentPlasticStrainNP1_AD(numOwnedPoints);
+
+  CORRESPONDENCE::updateElasticPerfectlyPlasticCauchyStress(unrotatedRateOfDeformation,
+                                                            &unrotatedCauchyStressN_AD[0],
+                                                            unrotatedCauchyStressNP1,
+                                                            &vonMisesStress_AD[0],
+                                                            &equivalentPlasticStrainN_AD[0],
+                                                            &equivalentPlasticStrainNP1_AD[0],
+                                                            numOwnedPoints,
+                                                            m_bulkModulus,
+                                                            m_shearModulus,
+                                                            m_yieldStress,
+                                                            dt);
+}
@@ -118,6 +118,37 @@ namespace PeridigmNS {
 
   protected:
 
+    /*! \brief Evaluates the tangent for a single neighborhood and stores it in the scratch matrix.
+     *
+     *  The neighborhood is evaluated with the smallest Sacado::Fad::SLFad type that holds numDof derivative
+     *  components, or with Sacado::Fad::DFad if numDof exceeds 512.
+     */
+    virtual void evaluateAutomaticDifferentiationJacobianBlock(const int numDof,
+                                                               const double* x,
+                                                               const double* y,
+                                                               const double* cellVolume,
+                                                               const double* weightedVolume,
+                                                               const double* bondDamage,
+                                                               const double* ownedShearCorrectionFactor,
+                                                               const double* edpN,
+                                                               const double* lambdaN,
+                                                               const int numBonds,
+                                                               const int* tempNeighborhoodList) const;
+
+    //! Evaluates the tangent for a single neighborhood with the given Fad type and stores it in the scratch matrix.
+    template<typename FadT>
+    void computeAutomaticDifferentiationJacobianBlock(const int numDof,
+                                                      const double* x,
+                                                      const double* y,
+                                                      const double* cellVolume,
+                                                      const double* weightedVolume,
+                                                      const double* bondDamage,
+                                                      const double* ownedShearCorrectionFactor,
+                                                      const double* edpN,
+                                                      const double* lambdaN,
+                                                      const int numBonds,
+                                                      const int* tempNeighborhoodList) const;
+
     // material parameters
     double m_bulkModulus;
     double m_shearModulus;
@@ -128,6 +159,7 @@ namespace PeridigmNS {
     bool m_applySurfaceCorrectionFactor;
     bool m_disablePlasticity;
     bool m_applyAutomaticDifferentiationJacobian;
+    bool m_cacheBondGeometry;
 
 
     // field spec ids for all relevant data
@@ -143,6 +175,9 @@ namespace PeridigmNS {
     int m_deviatoricPlasticExtensionFieldId;
     int m_lambdaFieldId;
     int m_surfaceCorrectionFactorFieldId;
+
+    //! Scratch storage for the bond geometry shared by the dilatation and force evaluations.
+    mutable std::vector<double> m_bondGeometry;
   };
 }
 
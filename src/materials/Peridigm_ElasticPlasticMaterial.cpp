@@ -62,6 +62,7 @@ PeridigmNS::ElasticPlasticMaterial::ElasticPlasticMaterial(const Teuchos::Parame
   : Material(params),
     m_disablePlasticity(false),
     m_applyAutomaticDifferentiationJacobian(true),
+    m_cacheBondGeometry(false),
     m_isPlanarProblem(false),
     m_volumeFieldId(-1), m_damageFieldId(-1), m_weightedVolumeFieldId(-1), m_dilatationFieldId(-1), m_modelCoordinatesFieldId(-1),
     m_coordinatesFieldId(-1), m_forceDensityFieldId(-1), m_bondDamageFieldId(-1), m_deviatoricPlasticExtensionFieldId(-1),
@@ -77,6 +78,8 @@ PeridigmNS::ElasticPlasticMaterial::ElasticPlasticMaterial(const Teuchos::Parame
     m_disablePlasticity = params.get<bool>("Disable Plasticity");
   if(params.isParameter("Apply Automatic Differentiation Jacobian"))
     m_applyAutomaticDifferentiationJacobian = params.get<bool>("Apply Automatic Differentiation Jacobian");
+  if(params.isParameter("Cache Bond Geometry"))
+    m_cacheBondGeometry = params.get<bool>("Cache Bond Geometry");
   if(params.isParameter("Planar Problem")){
     m_isPlanarProblem= params.get<bool>("Planar Problem");
     m_thickness= params.get<double>("Thickness");
@@ -154,7 +157,18 @@ PeridigmNS::ElasticPlasticMaterial::computeForce(const double dt,
   // Zero out the force
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
 
-  MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,volume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon);
+  // Optionally cache the bond geometry evaluated in the dilatation sweep for reuse by the force evaluation
+  double* bondGeometry = NULL;
+  if(m_cacheBondGeometry){
+    m_bondGeometry.resize(MATERIAL_EVALUATION::BOND_GEOMETRY_SIZE*dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->MyLength());
+    if(!m_bondGeometry.empty())
+      bondGeometry = &m_bondGeometry[0];
+  }
+
+  // Partition the owned points among threads; the reaction-force scatter goes through thread-private buffers
+  threadForceBuffers.Setup(numOwnedPoints, neighborhoodList, dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->MyLength());
+
+  MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,volume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon,PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),0.0,NULL,bondGeometry);
   MATERIAL_EVALUATION::computeInternalForceIsotropicElasticPlastic
      (
        x,
@@ -175,7 +189,9 @@ PeridigmNS::ElasticPlasticMaterial::computeForce(const double dt,
        m_horizon,
        m_yieldStress,
        m_isPlanarProblem,
-       m_thickness
+       m_thickness,
+       bondGeometry,
+       &threadForceBuffers
     );
 }
 
@@ -198,6 +214,109 @@ PeridigmNS::ElasticPlasticMaterial::computeJacobian(const double dt,
   }
 }
 
+template<typename FadT>
+void
+PeridigmNS::ElasticPlasticMaterial::computeAutomaticDifferentiationJacobianBlock(const int numDof,
+                                                                                 const double* x,
+                                                                                 const double* y,
+                                                                                 const double* cellVolume,
+                                                                                 const double* weightedVolume,
+                                                                                 const double* bondDamage,
+                                                                                 const double* edpN,
+                                                                                 const double* lambdaN,
+                                                                                 const int numBonds,
+                                                                                 const int* tempNeighborhoodList) const
+{
+  int numEntries = numDof/3;
+  int tempNumOwnedPoints = 1;
+
+  // To reduce memory re-allocation, use static variable to store Fad types for
+  // current coordinates (independent variables).
+  static vector<FadT> y_AD;
+
+  // Create arrays of Fad objects for the current coordinates, dilatation, and force density
+  // Modify the existing vector of Fad objects for the current coordinates
+  if((int)y_AD.size() < numDof)
+    y_AD.resize(numDof);
+  for(int i=0 ; i<numDof ; ++i){
+    y_AD[i].diff(i, numDof);
+    y_AD[i].val() = y[i];
+  }
+  // Create vectors of empty AD types for the dependent variables
+  vector<FadT> dilatation_AD(numEntries);
+  vector<FadT> lambdaNP1_AD(numEntries);
+  vector<FadT> edpNP1(numBonds);
+  vector<FadT> force_AD(numDof);
+
+  // Evaluate the constitutive model using the AD types
+  MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],tempNeighborhoodList,tempNumOwnedPoints,m_horizon);
+  MATERIAL_EVALUATION::computeInternalForceIsotropicElasticPlastic
+     (
+       x,
+       &y_AD[0],
+       weightedVolume,
+       cellVolume,
+       &dilatation_AD[0],
+       bondDamage,
+       edpN,
+       &edpNP1[0],
+       lambdaN,
+       &lambdaNP1_AD[0],
+       &force_AD[0],
+       tempNeighborhoodList,
+       tempNumOwnedPoints,
+       m_bulkModulus,
+       m_shearModulus,
+       m_horizon,
+       m_yieldStress,
+       m_isPlanarProblem,
+       m_thickness);
+
+  // Load derivative values into scratch matrix
+  // Multiply by volume along the way to convert force density to force
+  for(int row=0 ; row<numDof ; ++row){
+    for(int col=0 ; col<numDof ; ++col){
+      scratchMatrix(row, col) = force_AD[row].dx(col) * cellVolume[row/3];
+    }
+  }
+}
+
+template void PeridigmNS::ElasticPlasticMaterial::computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::DFad<double> >(const int numDof,
+                                                                                                                       const double* x,
+                                                                                                                       const double* y,
+                                                                                                                       const double* cellVolume,
+                                                                                                                       const double* weightedVolume,
+                                                                                                                       const double* bondDamage,
+                                                                                                                       const double* edpN,
+                                                                                                                       const double* lambdaN,
+                                                                                                                       const int numBonds,
+                                                                                                                       const int* tempNeighborhoodList) const;
+
+void
+PeridigmNS::ElasticPlasticMaterial::evaluateAutomaticDifferentiationJacobianBlock(const int numDof,
+                                                                                  const double* x,
+                                                                                  const double* y,
+                                                                                  const double* cellVolume,
+                                                                                  const double* weightedVolume,
+                                                                                  const double* bondDamage,
+                                                                                  const double* edpN,
+                                                                                  const double* lambdaN,
+                                                                                  const int numBonds,
+                                                                                  const int* tempNeighborhoodList) const
+{
+  // Use the same neighborhood-size buckets as ElasticMaterial
+  if(numDof <= 64)
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::SLFad<double,64> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, edpN, lambdaN, numBonds, tempNeighborhoodList);
+  else if(numDof <= 128)
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::SLFad<double,128> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, edpN, lambdaN, numBonds, tempNeighborhoodList);
+  else if(numDof <= 256)
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::SLFad<double,256> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, edpN, lambdaN, numBonds, tempNeighborhoodList);
+  else if(numDof <= 512)
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::SLFad<double,512> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, edpN, lambdaN, numBonds, tempNeighborhoodList);
+  else
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::DFad<double> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, edpN, lambdaN, numBonds, tempNeighborhoodList);
+}
+
 void
 PeridigmNS::ElasticPlasticMaterial::computeAutomaticDifferentiationJacobian(const double dt,
                                                                             const int numOwnedPoints,
@@ -209,10 +328,6 @@ PeridigmNS::ElasticPlasticMaterial::computeAutomaticDifferentiationJacobian(cons
 {
   // Compute contributions to the tangent matrix on an element-by-element basis
 
-  // To reduce memory re-allocation, use static variable to store Fad types for
-  // current coordinates (independent variables).
-  static vector<Sacado::Fad::DFad<double> > y_AD;
-
   // Loop over all points.
   int neighborhoodListIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
@@ -244,8 +359,9 @@ PeridigmNS::ElasticPlasticMaterial::computeAutomaticDifferentiationJacobian(cons
                             tempThreeDimensionalMap,
                             tempBondMap);
 
-    // The temporary data manager will have the same fields and data as the real data manager.
+    // The temporary data manager will have the same fields, bond storage formats, and data as the real data manager.
     vector<int> fieldIds = dataManager.getFieldIds();
+    tempDataManager.setStorageFormats(dataManager);
     tempDataManager.allocateData(fieldIds);
     tempDataManager.copyLocallyOwnedDataFromDataManager(dataManager);
 
@@ -279,52 +395,8 @@ PeridigmNS::ElasticPlasticMaterial::computeAutomaticDifferentiationJacobian(cons
     tempDataManager.getData(m_deviatoricPlasticExtensionFieldId, PeridigmField::STEP_N)->ExtractView(&edpN);
     tempDataManager.getData(m_lambdaFieldId, PeridigmField::STEP_N)->ExtractView(&lambdaN);
 
-    // Create arrays of Fad objects for the current coordinates, dilatation, and force density
-    // Modify the existing vector of Fad objects for the current coordinates
-    if((int)y_AD.size() < numDof)
-      y_AD.resize(numDof);
-    for(int i=0 ; i<numDof ; ++i){
-      y_AD[i].diff(i, numDof);
-      y_AD[i].val() = y[i];
-    }
-    // Create vectors of empty AD types for the dependent variables
-    vector<Sacado::Fad::DFad<double> > dilatation_AD(numEntries);
-    vector<Sacado::Fad::DFad<double> > lambdaNP1_AD(numEntries);
     int numBonds = tempDataManager.getData(m_deviatoricPlasticExtensionFieldId, PeridigmField::STEP_N)->MyLength();
-    vector<Sacado::Fad::DFad<double> > edpNP1(numBonds);
-    vector<Sacado::Fad::DFad<double> > force_AD(numDof);
-
-    // Evaluate the constitutive model using the AD types
-    MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],&tempNeighborhoodList[0],tempNumOwnedPoints,m_horizon);
-    MATERIAL_EVALUATION::computeInternalForceIsotropicElasticPlastic
-       (
-         x,
-         &y_AD[0],
-         weightedVolume,
-         cellVolume,
-         &dilatation_AD[0],
-         bondDamage,
-         edpN,
-         &edpNP1[0],
-         lambdaN,
-         &lambdaNP1_AD[0],
-         &force_AD[0],
-         &tempNeighborhoodList[0],
-         tempNumOwnedPoints,
-         m_bulkModulus,
-         m_shearModulus,
-         m_horizon,
-         m_yieldStress,
-         m_isPlanarProblem,
-         m_thickness);
-
-    // Load derivative values into scratch matrix
-    // Multiply by volume along the way to convert force density to force
-    for(int row=0 ; row<numDof ; ++row){
-      for(int col=0 ; col<numDof ; ++col){
-        scratchMatrix(row, col) = force_AD[row].dx(col) * cellVolume[row/3];
-      }
-    }
+    evaluateAutomaticDifferentiationJacobianBlock(numDof, x, y, cellVolume, weightedVolume, bondDamage, edpN, lambdaN, numBonds, &tempNeighborhoodList[0]);
 
     // Sum the values into the global tangent matrix (this is expensive).
     jacobian.addValues((int)globalIndices.size(), &globalIndices[0], scratchMatrix.Data());
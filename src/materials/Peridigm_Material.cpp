@@ -154,8 +154,9 @@ void PeridigmNS::Material::computeFiniteDifferenceJacobian(const double dt,
                             tempThreeDimensionalMap,
                             tempBondMap);
 
-    // The temporary data manager will have the same fields and data as the real data manager.
+    // The temporary data manager will have the same fields, bond storage formats, and data as the real data manager.
     vector<int> fieldIds = dataManager.getFieldIds();
+    tempDataManager.setStorageFormats(dataManager);
     tempDataManager.allocateData(fieldIds);
     tempDataManager.copyLocallyOwnedDataFromDataManager(dataManager);
 
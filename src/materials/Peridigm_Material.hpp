@@ -58,6 +58,7 @@
 #include "Peridigm_DataManager.hpp"
 #include "Peridigm_SerialMatrix.hpp"
 #include "Peridigm_ScratchMatrix.hpp"
+#include "Peridigm_ThreadForceBuffers.hpp"
 #include "Peridigm_BoundaryAndInitialConditionManager.hpp"
 
 namespace PeridigmNS {
@@ -104,6 +105,18 @@ namespace PeridigmNS {
     //! Returns a vector of field IDs corresponding to the variables associated with the material.
     virtual std::vector<int> FieldIds() const = 0;
 
+    //! Returns the bond field IDs that the material can read and write in single precision (see DataManager::getSinglePrecisionData()).
+    virtual std::vector<int> SinglePrecisionBondFieldIds() const {
+      std::vector<int> empty;
+      return empty;
+    }
+
+    //! Returns the bond field IDs that the material can read and write as one bit per bond (see DataManager::getBitPackedData()).
+    virtual std::vector<int> BitPackedBondFieldIds() const {
+      std::vector<int> empty;
+      return empty;
+    }
+
     //! Returns a vector of field IDs that need to be synchronized across block boundaries and MPI boundaries after initialize().
     virtual std::vector<int> FieldIdsForSynchronizationAfterInitialize() const {
       std::vector<int> empty;
@@ -140,6 +153,24 @@ namespace PeridigmNS {
                  const int* neighborhoodList,
                  PeridigmNS::DataManager& dataManager) const {};
 
+    //! Returns false if the material cannot be evaluated with a time step larger than the step between updates of the kinematic fields.
+    virtual bool supportsSubcycling() const { return true; }
+
+    //! Returns true if the material implements computeForceOnPoints() and has no precompute() step.
+    virtual bool supportsPartialForceEvaluation() const { return false; }
+
+    //! Evaluate the internal force contributions of owned points firstPoint through lastPoint-1; forces are zeroed only when firstPoint is zero.
+    virtual void
+    computeForceOnPoints(const double dt,
+                         const int numOwnedPoints,
+                         const int* ownedIDs,
+                         const int* neighborhoodList,
+                         PeridigmNS::DataManager& dataManager,
+                         const int firstPoint,
+                         const int lastPoint) const {
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error:  Material::computeForceOnPoints() is not implemented for " + Name() + ".\n");
+    }
+
     //! Compute the divergence of the flux (for diffusion models).
     virtual void
     computeFluxDivergence(const double dt,
@@ -227,6 +258,9 @@ namespace PeridigmNS {
     //! Scratch matrix.
     mutable ScratchMatrix scratchMatrix;
 
+    //! Thread-private force buffers for bond kernels that opt in to threaded evaluation.
+    mutable ThreadForceBuffers<double> threadForceBuffers;
+
     //! Finite-difference probe length
     double m_finiteDifferenceProbeLength;
 
@@ -399,8 +399,9 @@ PeridigmNS::MultiphysicsElasticMaterial::computeAutomaticDifferentiationJacobian
                             tempThreeDimensionalMap,
                             tempBondMap);
 
-    // The temporary data manager will have the same field specs and data as the real data manager.
+    // The temporary data manager will have the same field specs, bond storage formats, and data as the real data manager.
     vector<int> fieldIds = dataManager.getFieldIds();
+    tempDataManager.setStorageFormats(dataManager);
     tempDataManager.allocateData(fieldIds);
     tempDataManager.copyLocallyOwnedDataFromDataManager(dataManager);
 
@@ -479,21 +480,25 @@ m_horizon,m_fluidReynoldsViscosityTemperatureEffect,deltaTemperature);
 
     // Load derivative values into scratch matrix
     // Multiply by volume along the way to convert force density to force
+    // NaN checks are accumulated and tested once the scratch matrix is loaded
     double value;
+    bool forceIsFinite = true, fluidFlowIsFinite = true;
     for(int row=0 ; row<numTotalNeighborhoodDof ; row+=dofPerNode){
       for(int col=0 ; col<numTotalNeighborhoodDof ; col+=dofPerNode){
 			  for(int subcol=0 ; subcol<dofPerNode ; ++subcol){
 					for(int subrow=0 ; subrow<(dofPerNode-1) ; ++subrow){
 							value = force_AD[row*3/dofPerNode + subrow].dx(col + subcol) * cellVolume[row/dofPerNode];
-							TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(value), "**** NaN detected in MultiphysicsElasticMaterial::computeAutomaticDifferentiationJacobian() (internal force).\n");
+							forceIsFinite &= std::isfinite(value);
 							scratchMatrix(row+subrow, col+subcol) = value;
 					}
 					value = fluidFlow_AD[row/dofPerNode].dx(col + subcol) * cellVolume[row/dofPerNode];
-					TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(value), "**** NaN detected in MultiphysicsElasticMaterial::computeAutomaticDifferentiationJacobian() (fluid flow).\n");
+					fluidFlowIsFinite &= std::isfinite(value);
         	scratchMatrix(row +dofPerNode -1, col+subcol) = value;
 				}
 			}
 		}
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!forceIsFinite, "**** NaN detected in MultiphysicsElasticMaterial::computeAutomaticDifferentiationJacobian() (internal force).\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!fluidFlowIsFinite, "**** NaN detected in MultiphysicsElasticMaterial::computeAutomaticDifferentiationJacobian() (fluid flow).\n");
 
     // Sum the values into the global tangent matrix (this is expensive).
     if (jacobianType == PeridigmNS::Material::FULL_MATRIX)
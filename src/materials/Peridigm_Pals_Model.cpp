@@ -61,12 +61,13 @@ using MATERIAL_EVALUATION::PALS::NUM_LAGRANGE_MULTIPLIERS;
 
 PeridigmNS::Pals_Model::Pals_Model(const Teuchos::ParameterList& params)
   : Material(params),
-    m_bulkModulus(0.0), m_shearModulus(0.0), m_density(0.0), m_horizon(0.0),
+    m_bulkModulus(0.0), m_shearModulus(0.0), m_density(0.0), m_horizon(0.0), m_cacheBondInfluence(false),
     m_OMEGA_0(&PeridigmInfluenceFunction::one), m_SIGMA_0(&PeridigmInfluenceFunction::one),
     m_volumeFieldId(-1), m_weightedVolumeFieldId(-1), m_normalizedWeightedVolumeFieldId(-1),
     m_dilatationFieldId(-1), m_palsPressureFieldId(-1),
     m_modelCoordinatesFieldId(-1), m_coordinatesFieldId(-1), m_forceDensityFieldId(-1),
     m_bondDamageFieldId(-1),
+    m_referenceBondLengthFieldId(-1), m_dilatationBondInfluenceFieldId(-1), m_deviatoricBondInfluenceFieldId(-1),
     num_lagrange_multipliers(NUM_LAGRANGE_MULTIPLIERS),
     m_dilatationNormalizationFieldId(-1), m_deviatoricNormalizationFieldId(-1),
     m_dilatationLagrangeMultiplersFieldIds(NUM_LAGRANGE_MULTIPLIERS),
@@ -77,7 +78,8 @@ PeridigmNS::Pals_Model::Pals_Model(const Teuchos::ParameterList& params)
   m_shearModulus = calculateShearModulus(params);
   m_density = params.get<double>("Density");
   m_horizon = params.get<double>("Horizon");
-
+  if(params.isParameter("Cache Bond Influence"))
+    m_cacheBondInfluence = params.get<bool>("Cache Bond Influence");
 
   if(params.isParameter("Dilatation Influence Function")){
 	string type = params.get<string>("Dilatation Influence Function");
@@ -127,6 +129,16 @@ PeridigmNS::Pals_Model::Pals_Model(const Teuchos::ParameterList& params)
     m_deviatoricLagrangeMultiplersFieldIds[i]=m_devId;
   }
 
+  // Optional per-bond storage of the influence functions, which depend only on the reference configuration
+  if(m_cacheBondInfluence){
+    m_referenceBondLengthFieldId     = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Pals_Reference_Bond_Length");
+    m_dilatationBondInfluenceFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Pals_Dilatation_Influence");
+    m_deviatoricBondInfluenceFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Pals_Deviatoric_Influence");
+    m_fieldIds.push_back(m_referenceBondLengthFieldId);
+    m_fieldIds.push_back(m_dilatationBondInfluenceFieldId);
+    m_fieldIds.push_back(m_deviatoricBondInfluenceFieldId);
+  }
+
 }
 
 PeridigmNS::Pals_Model::~Pals_Model()
@@ -221,6 +233,40 @@ initialize(const double dt,
 			m_SIGMA_0
 		);
 	}
+
+	/*
+	 * Optionally evaluate the influence functions once per bond for reuse at every step
+	 */
+	if(m_cacheBondInfluence){
+		vector<const double *> omega_multipliers(num_lagrange_multipliers), sigma_multipliers(num_lagrange_multipliers);
+		for(int i=0;i<num_lagrange_multipliers;i++){
+			double *dil, *dev;
+			dataManager.getData(m_dilatationLagrangeMultiplersFieldIds[i],PeridigmField::STEP_NONE)->ExtractView(&dil);
+			dataManager.getData(m_deviatoricLagrangeMultiplersFieldIds[i],PeridigmField::STEP_NONE)->ExtractView(&dev);
+			omega_multipliers[i]=dil;
+			sigma_multipliers[i]=dev;
+		}
+		double *bond_length, *omega_bond, *sigma_bond;
+		dataManager.getData(m_referenceBondLengthFieldId, PeridigmField::STEP_NONE)->ExtractView(&bond_length);
+		dataManager.getData(m_dilatationBondInfluenceFieldId, PeridigmField::STEP_NONE)->ExtractView(&omega_bond);
+		dataManager.getData(m_deviatoricBondInfluenceFieldId, PeridigmField::STEP_NONE)->ExtractView(&sigma_bond);
+		computeBondInfluence
+		(
+			xOverlap,
+			omega_multipliers,
+			omega_constants,
+			sigma_multipliers,
+			sigma_constants,
+			bond_length,
+			omega_bond,
+			sigma_bond,
+			neighborhoodList,
+			numOwnedPoints,
+			m_horizon,
+			m_OMEGA_0,
+			m_SIGMA_0
+		);
+	}
 }
 
 
@@ -236,9 +282,7 @@ PeridigmNS::Pals_Model::computeForce(const double dt,
 
 	// Extract pointers to the underlying data
 	double *x, *y, *cellVolume, *pals_pressure, *force, *weightedVolume;
-	double *omega_constants, *sigma_constants;
 	double *dilatation;
-	vector<const double *> omega_multipliers(num_lagrange_multipliers), sigma_multipliers(num_lagrange_multipliers);
 	dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
 	dataManager.getData(m_coordinatesFieldId, PeridigmField::STEP_NP1)->ExtractView(&y);
 	dataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
@@ -246,6 +290,38 @@ PeridigmNS::Pals_Model::computeForce(const double dt,
 	dataManager.getData(m_dilatationFieldId, PeridigmField::STEP_NP1)->ExtractView(&dilatation);
 	dataManager.getData(m_palsPressureFieldId, PeridigmField::STEP_NP1)->ExtractView(&pals_pressure);
 	dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&force);
+
+	// namespace PALS
+	using namespace MATERIAL_EVALUATION::PALS;
+
+	// With the influence functions cached per bond, evaluate dilatation, pressure and force in a single sweep
+	if(m_cacheBondInfluence){
+		double *bond_length, *omega_bond, *sigma_bond;
+		dataManager.getData(m_referenceBondLengthFieldId, PeridigmField::STEP_NONE)->ExtractView(&bond_length);
+		dataManager.getData(m_dilatationBondInfluenceFieldId, PeridigmField::STEP_NONE)->ExtractView(&omega_bond);
+		dataManager.getData(m_deviatoricBondInfluenceFieldId, PeridigmField::STEP_NONE)->ExtractView(&sigma_bond);
+		computeDilatationPalsPressureAndInternalForce
+		(
+			y,
+			cellVolume,
+			bond_length,
+			omega_bond,
+			sigma_bond,
+			weightedVolume,
+			dilatation,
+			pals_pressure,
+			force,
+			neighborhoodList,
+			numOwnedPoints,
+			m_bulkModulus,
+			m_shearModulus
+		);
+		return;
+	}
+
+	// Otherwise the influence functions are evaluated from the Lagrange multipliers and normalization constants
+	double *omega_constants, *sigma_constants;
+	vector<const double *> omega_multipliers(num_lagrange_multipliers), sigma_multipliers(num_lagrange_multipliers);
 	dataManager.getData(m_dilatationNormalizationFieldId, PeridigmField::STEP_NONE)->ExtractView(&omega_constants);
 	dataManager.getData(m_deviatoricNormalizationFieldId, PeridigmField::STEP_NONE)->ExtractView(&sigma_constants);
 
@@ -257,8 +333,6 @@ PeridigmNS::Pals_Model::computeForce(const double dt,
 		sigma_multipliers[i]=dev;
 	}
 
-	// namespace PALS
-	using namespace MATERIAL_EVALUATION::PALS;
 	computeDilatationAndPalsPressure
 	(
 		x,
@@ -74,6 +74,7 @@ public:
    double m_shearModulus;
    double m_density;
    double m_horizon;
+   bool m_cacheBondInfluence;
 
    // Influence functions
    FunctionPointer m_OMEGA_0;
@@ -90,6 +91,9 @@ public:
    int m_coordinatesFieldId;
    int m_forceDensityFieldId;
    int m_bondDamageFieldId;
+   int m_referenceBondLengthFieldId;
+   int m_dilatationBondInfluenceFieldId;
+   int m_deviatoricBondInfluenceFieldId;
 
    const int num_lagrange_multipliers;
    int m_dilatationNormalizationFieldId;
@@ -124,8 +124,13 @@ PeridigmNS::SpeciesConcentrationMaterial::computeFluxDivergence(const double dt,
       double mu = 1.0; // PLACEHOLDER
       double coefficient = m_coefficient * (1.0 + 0.0001*nodeTemperature); // PLACEHOLDER
       double contribution_to_flux_divergence = mu * coefficient * (concentrationDifference / initialDistance) * neighborVolume;
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(contribution_to_flux_divergence), "**** NaN detected in SpeciesConcentrationMaterial::computeFluxDivergence().\n");
       fluxDivergence[iID] += contribution_to_flux_divergence;
     }
   }
+
+  // Check for NaNs after the fact; a non-finite bond contribution propagates into the nodal sum
+  bool isFinite = true;
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID)
+    isFinite &= std::isfinite(fluxDivergence[iID]);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!isFinite, "**** NaN detected in SpeciesConcentrationMaterial::computeFluxDivergence().\n");
 }
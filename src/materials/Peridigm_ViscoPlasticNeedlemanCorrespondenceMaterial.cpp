@@ -58,7 +58,7 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::ViscoplasticNeedlemanCo
     m_yieldStress(0.0), m_strainHardeningExponent(0.0), m_rateHardeningExponent(0.0), m_refStrainRate(0.0), m_refStrain0(0.0), m_refStrain1(0.0),
     m_isFlaw(false), m_flawLocationX(0.0), m_flawLocationY(0.0), m_flawLocationZ(0.0), m_flawSize(0.0), m_flawMagnitude(0.0),
     m_modelCoordinatesFieldId(-1), m_unrotatedRateOfDeformationFieldId(-1), m_unrotatedCauchyStressFieldId(-1), m_vonMisesStressFieldId(-1), 
-    m_equivalentPlasticStrainFieldId(-1)
+    m_equivalentPlasticStrainFieldId(-1), m_plasticMultiplierIncrementFieldId(-1), m_returnMapIterationsFieldId(-1)
 {
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Thermal Expansion Coefficient"), "**** Error:  Thermal expansion is not currently supported for the selected correspondence material model.\n");
 
@@ -85,12 +85,16 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::ViscoplasticNeedlemanCo
   m_vonMisesStressFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Von_Mises_Stress");
 
   m_equivalentPlasticStrainFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Equivalent_Plastic_Strain");
+  m_plasticMultiplierIncrementFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Plastic_Multiplier_Increment");
+  m_returnMapIterationsFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Return_Map_Iterations");
 
   m_fieldIds.push_back(m_modelCoordinatesFieldId);
   m_fieldIds.push_back(m_unrotatedRateOfDeformationFieldId);
   m_fieldIds.push_back(m_unrotatedCauchyStressFieldId);
   m_fieldIds.push_back(m_vonMisesStressFieldId);
   m_fieldIds.push_back(m_equivalentPlasticStrainFieldId);
+  m_fieldIds.push_back(m_plasticMultiplierIncrementFieldId);
+  m_fieldIds.push_back(m_returnMapIterationsFieldId);
 }
 
 PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::~ViscoplasticNeedlemanCorrespondenceMaterial()
@@ -114,6 +118,9 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::initialize(const double
   dataManager.getData(m_vonMisesStressFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
   dataManager.getData(m_equivalentPlasticStrainFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
   dataManager.getData(m_equivalentPlasticStrainFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+  dataManager.getData(m_plasticMultiplierIncrementFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
+  dataManager.getData(m_plasticMultiplierIncrementFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+  dataManager.getData(m_returnMapIterationsFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
 }
 
 void
@@ -135,6 +142,13 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::computeCauchyStress(con
   dataManager.getData(m_equivalentPlasticStrainFieldId, PeridigmField::STEP_NP1)->ExtractView(&equivalentPlasticStrainNP1);
   dataManager.getData(m_equivalentPlasticStrainFieldId, PeridigmField::STEP_N)->ExtractView(&equivalentPlasticStrainN);
 
+  // The plastic multiplier increment from the previous step is the initial
+  // guess for the return mapping; the number of iterations is a diagnostic
+  double *plasticMultiplierIncrementN, *plasticMultiplierIncrementNP1, *returnMapIterations;
+  dataManager.getData(m_plasticMultiplierIncrementFieldId, PeridigmField::STEP_N)->ExtractView(&plasticMultiplierIncrementN);
+  dataManager.getData(m_plasticMultiplierIncrementFieldId, PeridigmField::STEP_NP1)->ExtractView(&plasticMultiplierIncrementNP1);
+  dataManager.getData(m_returnMapIterationsFieldId, PeridigmField::STEP_NONE)->ExtractView(&returnMapIterations);
+
   double *modelCoordinates;
   dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&modelCoordinates);
 
@@ -145,6 +159,9 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::computeCauchyStress(con
                                                         vonMisesStress,
                                                         equivalentPlasticStrainN, 
                                                         equivalentPlasticStrainNP1, 
+                                                        plasticMultiplierIncrementN,
+                                                        plasticMultiplierIncrementNP1,
+                                                        returnMapIterations,
                                                         numOwnedPoints, 
                                                         m_bulkModulus, 
                                                         m_shearModulus, 
@@ -162,3 +179,57 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::computeCauchyStress(con
                                                         m_flawMagnitude,
                                                         dt);
 }
+
+void
+PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::computeAutomaticDifferentiationCauchyStress(const double dt,
+                                                                                                     const int numOwnedPoints,
+                                                                                                     const Sacado::Fad::DFad<double>* unrotatedRateOfDeformation,
+                                                                                                     Sacado::Fad::DFad<double>* unrotatedCauchyStressNP1,
+                                                                                                     PeridigmNS::DataManager& dataManager) const
+{
+  // State data at step N enter the AD evaluation as constants
+  double *unrotatedCauchyStressN;
+  dataManager.getData(m_unrotatedCauchyStressFieldId, PeridigmField::STEP_N)->ExtractView(&unrotatedCauchyStressN);
+  vector<Sacado::Fad::DFad<double> > unrotatedCauchyStressN_AD(unrotatedCauchyStressN, unrotatedCauchyStressN + 9*numOwnedPoints);
+
+  double *equivalentPlasticStrainN;
+  dataManager.getData(m_equivalentPlasticStrainFieldId, PeridigmField::STEP_N)->ExtractView(&equivalentPlasticStrainN);
+  vector<Sacado::Fad::DFad<double> > equivalentPlasticStrainN_AD(equivalentPlasticStrainN, equivalentPlasticStrainN + numOwnedPoints);
+
+  double *plasticMultiplierIncrementN;
+  dataManager.getData(m_plasticMultiplierIncrementFieldId, PeridigmField::STEP_N)->ExtractView(&plasticMultiplierIncrementN);
+  vector<Sacado::Fad::DFad<double> > plasticMultiplierIncrementN_AD(plasticMultiplierIncrementN, plasticMultiplierIncrementN + numOwnedPoints);
+
+  // Von Mises stress, equivalent plastic strain, and plastic multiplier increment at step N+1 are not needed for the Jacobian
+  vector<Sacado::Fad::DFad<double> > vonMisesStress_AD(numOwnedPoints), equivalentPlasticStrainNP1_AD(numOwnedPoints), plasticMultiplierIncrementNP1_AD(numOwnedPoints);
+
+  double *modelCoordinates;
+  dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&modelCoordinates);
+
+  CORRESPONDENCE::updateElasticViscoplasticCauchyStress(modelCoordinates,
+                                                        unrotatedRateOfDeformation,
+                                                        &unrotatedCauchyStressN_AD[0],
+                                                        unrotatedCauchyStressNP1,
+                                                        &vonMisesStress_AD[0],
+                                                        &equivalentPlasticStrainN_AD[0],
+                                                        &equivalentPlasticStrainNP1_AD[0],
+                                                        &plasticMultiplierIncrementN_AD[0],
+                                                        &plasticMultiplierIncrementNP1_AD[0],
+                                                        NULL,
+                                                        numOwnedPoints,
+                                                        m_bulkModulus,
+                                                        m_shearModulus,
+                                                        m_yieldStress,
+                                                        m_strainHardeningExponent,
+                                                        m_rateHardeningExponent,
+                                                        m_refStrainRate,
+                                                        m_refStrain0,
+                                                        m_refStrain1,
+                                                        m_isFlaw,
+                                                        m_flawLocationX,
+                                                        m_flawLocationY,
+                                                        m_flawLocationZ,
+                                                        m_flawSize,
+                                                        m_flawMagnitude,
+                                                        dt);
+}
@@ -77,6 +77,13 @@ namespace PeridigmNS {
                                      const int numOwnedPoints,
                                      PeridigmNS::DataManager& dataManager) const;
 
+    //! Evaluate the Cauchy stress using AD types.
+    virtual void computeAutomaticDifferentiationCauchyStress(const double dt,
+                                                             const int numOwnedPoints,
+                                                             const Sacado::Fad::DFad<double>* unrotatedRateOfDeformation,
+                                                             Sacado::Fad::DFad<double>* unrotatedCauchyStressNP1,
+                                                             PeridigmNS::DataManager& dataManager) const;
+
     //! Returns the requested material property
     //! A dummy method here.
     virtual double lookupMaterialProperty(const std::string keyname) const {return 0.0;}
@@ -103,6 +110,8 @@ namespace PeridigmNS {
     int m_unrotatedCauchyStressFieldId;
     int m_vonMisesStressFieldId;
     int m_equivalentPlasticStrainFieldId;
+    int m_plasticMultiplierIncrementFieldId;
+    int m_returnMapIterationsFieldId;
   };
 }
 
@@ -57,6 +57,7 @@
 PeridigmNS::ViscoelasticMaterial::ViscoelasticMaterial(const Teuchos::ParameterList & params)
  : Material(params),
    m_applyAutomaticDifferentiationJacobian(false),
+   m_cacheBondGeometry(false),
    m_volumeFieldId(-1), m_damageFieldId(-1), m_weightedVolumeFieldId(-1), m_dilatationFieldId(-1), m_modelCoordinatesFieldId(-1),
    m_coordinatesFieldId(-1), m_forceDensityFieldId(-1), m_bondDamageFieldId(-1), m_deviatoricBackExtensionFieldId(-1)
 {
@@ -71,6 +72,8 @@ PeridigmNS::ViscoelasticMaterial::ViscoelasticMaterial(const Teuchos::ParameterL
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Apply Automatic Differentiation Jacobian"), "**** Error:  Automatic Differentiation is not supported for the Viscoelastic material model.\n");
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Apply Shear Correction Factor"), "**** Error:  Shear Correction Factor is not supported for the Viscoelastic material model.\n");
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Thermal Expansion Coefficient"), "**** Error:  Thermal expansion is not currently supported for the Viscoelastic material model.\n");
+  if(params.isParameter("Cache Bond Geometry"))
+    m_cacheBondGeometry = params.get<bool>("Cache Bond Geometry");
 
   PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
   m_volumeFieldId                      = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Volume");
@@ -134,7 +137,15 @@ PeridigmNS::ViscoelasticMaterial::computeForce(const double dt,
 
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
 
-  MATERIAL_EVALUATION::computeDilatation(x,yNP1,weightedVolume,volume,bondDamage,dilatationNp1,neighborhoodList,numOwnedPoints,m_horizon);
+  // Optionally cache the bond geometry evaluated in the dilatation sweep for reuse by the force evaluation
+  double* bondGeometry = NULL;
+  if(m_cacheBondGeometry){
+    m_bondGeometry.resize(MATERIAL_EVALUATION::BOND_GEOMETRY_SIZE*dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->MyLength());
+    if(!m_bondGeometry.empty())
+      bondGeometry = &m_bondGeometry[0];
+  }
+
+  MATERIAL_EVALUATION::computeDilatation(x,yNP1,weightedVolume,volume,bondDamage,dilatationNp1,neighborhoodList,numOwnedPoints,m_horizon,PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),0.0,NULL,bondGeometry);
   MATERIAL_EVALUATION::computeInternalForceViscoelasticStandardLinearSolid(dt,
                                                                            x,
                                                                            yN,
@@ -152,6 +163,7 @@ PeridigmNS::ViscoelasticMaterial::computeForce(const double dt,
                                                                            m_bulkModulus,
                                                                            m_shearModulus,
                                                                            m_lambda_i,
-                                                                           m_tau_b);
+                                                                           m_tau_b,
+                                                                           bondGeometry);
 }
 
@@ -79,6 +79,9 @@ namespace PeridigmNS {
     //! Returns a vector of field IDs corresponding to the variables associated with the material.
     virtual std::vector<int> FieldIds() const { return m_fieldIds; }
 
+    //! The strain rate is computed from the coordinates at step N, so the material must be evaluated every step.
+    virtual bool supportsSubcycling() const { return false; }
+
     //! Initialized data containers and computes weighted volume.
     virtual void
     initialize(const double dt,
@@ -105,6 +108,7 @@ namespace PeridigmNS {
     double m_lambda_i;
     double m_tau_b;
     bool m_applyAutomaticDifferentiationJacobian;
+    bool m_cacheBondGeometry;
 
     // field ids for all relevant data
     std::vector<int> m_fieldIds;
@@ -117,6 +121,9 @@ namespace PeridigmNS {
     int m_forceDensityFieldId;
     int m_bondDamageFieldId;
     int m_deviatoricBackExtensionFieldId;
+
+    //! Scratch storage for the bond geometry shared by the dilatation and force evaluations.
+    mutable std::vector<double> m_bondGeometry;
   };
 }
 
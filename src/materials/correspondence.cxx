@@ -212,6 +212,136 @@ void MatrixMultiply
   }
 }
 
+template<typename ScalarT>
+void gatherTensorBatch
+(
+ const ScalarT* tensors,
+ ScalarT* batch,
+ int numLanes
+)
+{
+  const int B = TENSOR_BATCH_SIZE;
+  for(int l=0 ; l<numLanes ; ++l){
+    for(int k=0 ; k<9 ; ++k)
+      batch[k*B+l] = tensors[9*l+k];
+  }
+}
+
+template<typename ScalarT>
+void scatterTensorBatch
+(
+ const ScalarT* batch,
+ ScalarT* tensors,
+ int numLanes
+)
+{
+  const int B = TENSOR_BATCH_SIZE;
+  for(int l=0 ; l<numLanes ; ++l){
+    for(int k=0 ; k<9 ; ++k)
+      tensors[9*l+k] = batch[k*B+l];
+  }
+}
+
+template<typename ScalarT>
+int Invert3by3MatrixBatch
+(
+ const ScalarT* matrix,
+ ScalarT* determinant,
+ ScalarT* inverse,
+ int numLanes
+)
+{
+  // Same sequence of operations as Invert3by3Matrix(), applied lane by lane
+  const int B = TENSOR_BATCH_SIZE;
+  const ScalarT* m = matrix;
+  ScalarT* inv = inverse;
+  int returnCode(0);
+
+#ifdef PERIDIGM_OPENMP
+  #pragma omp simd
+#endif
+  for(int l=0 ; l<numLanes ; ++l){
+    ScalarT minor0 =  m[4*B+l] * m[8*B+l] - m[5*B+l] * m[7*B+l];
+    ScalarT minor1 =  m[3*B+l] * m[8*B+l] - m[5*B+l] * m[6*B+l];
+    ScalarT minor2 =  m[3*B+l] * m[7*B+l] - m[4*B+l] * m[6*B+l];
+    ScalarT minor3 =  m[1*B+l] * m[8*B+l] - m[2*B+l] * m[7*B+l];
+    ScalarT minor4 =  m[l]     * m[8*B+l] - m[6*B+l] * m[2*B+l];
+    ScalarT minor5 =  m[l]     * m[7*B+l] - m[1*B+l] * m[6*B+l];
+    ScalarT minor6 =  m[1*B+l] * m[5*B+l] - m[2*B+l] * m[4*B+l];
+    ScalarT minor7 =  m[l]     * m[5*B+l] - m[2*B+l] * m[3*B+l];
+    ScalarT minor8 =  m[l]     * m[4*B+l] - m[1*B+l] * m[3*B+l];
+    ScalarT det = m[l] * minor0 - m[1*B+l] * minor1 + m[2*B+l] * minor2;
+    determinant[l] = det;
+
+    bool singular = (det == ScalarT(0.0));
+    inv[l]     = singular ? ScalarT(0.0) : ScalarT(minor0/det);
+    inv[1*B+l] = singular ? ScalarT(0.0) : ScalarT(-1.0*minor3/det);
+    inv[2*B+l] = singular ? ScalarT(0.0) : ScalarT(minor6/det);
+    inv[3*B+l] = singular ? ScalarT(0.0) : ScalarT(-1.0*minor1/det);
+    inv[4*B+l] = singular ? ScalarT(0.0) : ScalarT(minor4/det);
+    inv[5*B+l] = singular ? ScalarT(0.0) : ScalarT(-1.0*minor7/det);
+    inv[6*B+l] = singular ? ScalarT(0.0) : ScalarT(minor2/det);
+    inv[7*B+l] = singular ? ScalarT(0.0) : ScalarT(-1.0*minor5/det);
+    inv[8*B+l] = singular ? ScalarT(0.0) : ScalarT(minor8/det);
+  }
+
+  for(int l=0 ; l<numLanes ; ++l){
+    if(determinant[l] == ScalarT(0.0))
+      returnCode = 1;
+  }
+
+  return returnCode;
+}
+
+template<typename ScalarT>
+void MatrixMultiplyBatch
+(
+ bool transA,
+ bool transB,
+ const ScalarT* alpha,
+ const ScalarT* a,
+ const ScalarT* b,
+ ScalarT* result,
+ int numLanes
+)
+{
+  // Lane-wise result = alpha * a * b, with the same summation order as
+  // MatrixMultiply().  A NULL alpha is equivalent to alpha = 1.0.
+  const int B = TENSOR_BATCH_SIZE;
+
+  // Offsets of component (i,k) of a and (k,j) of b, accounting for transposition
+  const int aRowStride = transA ? B : 3*B;
+  const int aColStride = transA ? 3*B : B;
+  const int bRowStride = transB ? B : 3*B;
+  const int bColStride = transB ? 3*B : B;
+
+  for(int i=0 ; i<3 ; ++i){
+    for(int j=0 ; j<3 ; ++j){
+      const ScalarT* a0 = a + i*aRowStride;
+      const ScalarT* a1 = a0 + aColStride;
+      const ScalarT* a2 = a1 + aColStride;
+      const ScalarT* b0 = b + j*bColStride;
+      const ScalarT* b1 = b0 + bRowStride;
+      const ScalarT* b2 = b1 + bRowStride;
+      ScalarT* r = result + (3*i+j)*B;
+#ifdef PERIDIGM_OPENMP
+      #pragma omp simd
+#endif
+      for(int l=0 ; l<numLanes ; ++l)
+        r[l] = a0[l] * b0[l] + a1[l] * b1[l] + a2[l] * b2[l];
+    }
+  }
+
+  if(alpha != 0){
+    for(int l=0 ; l<numLanes ; ++l){
+      if(alpha[l] != 1.0){
+        for(int k=0 ; k<9 ; ++k)
+          result[k*B+l] *= alpha[l];
+      }
+    }
+  }
+}
+
 template<typename ScalarT>
 int computeShapeTensorInverseAndApproximateDeformationGradient
 (
@@ -314,22 +444,332 @@ int numPoints
 
     // Matrix multiply the first term and the shape tensor inverse to compute
     // the deformation gradient
-    MatrixMultiply(false, false, 1.0, defGradFirstTerm, shapeTensorInv, defGrad);
+    MatrixMultiply<ScalarT>(false, false, 1.0, defGradFirstTerm, shapeTensorInv, defGrad);
   }
 
   return returnCode;
 }
 
-//Performs kinematic computations following Flanagan and Taylor (1987), returns
-//unrotated rate-of-deformation and rotation tensors
+//Point-local part of the Flanagan & Taylor (1987) kinematics: given the
+//Eulerian velocity gradient L at a point, updates the left stretch and
+//rotation tensors and returns the unrotated rate-of-deformation
+template<typename ScalarT>
+void updateLeftStretchRotationAndUnrotatedRateOfDeformation
+(
+const ScalarT* eulerianVelGrad,
+const ScalarT* leftStretchN,
+const ScalarT* rotTensorN,
+ScalarT* leftStretchNP1,
+ScalarT* rotTensorNP1,
+ScalarT* unrotRateOfDef,
+double dt
+)
+{
+  ScalarT rateOfDef[9], spin[9], temp[9], tempInv[9], OmegaTensor[9], QMatrix[9], OmegaTensorSq[9];
+  ScalarT tempA[9], tempB[9], rateOfStretch[9];
+
+  ScalarT determinant;
+  ScalarT omegaX, omegaY, omegaZ;
+  ScalarT zX, zY, zZ;
+  ScalarT wX, wY, wZ;
+  ScalarT traceV, Omega, OmegaSq, scaleFactor1, scaleFactor2;
+
+  // Compute rate-of-deformation tensor, D = 1/2 * (L + Lt)
+  *(rateOfDef)   = *(eulerianVelGrad);
+  *(rateOfDef+1) = 0.5 * ( *(eulerianVelGrad+1) + *(eulerianVelGrad+3) );
+  *(rateOfDef+2) = 0.5 * ( *(eulerianVelGrad+2) + *(eulerianVelGrad+6) );
+  *(rateOfDef+3) = *(rateOfDef+1);
+  *(rateOfDef+4) = *(eulerianVelGrad+4);
+  *(rateOfDef+5) = 0.5 * ( *(eulerianVelGrad+5) + *(eulerianVelGrad+7) );
+  *(rateOfDef+6) = *(rateOfDef+2);
+  *(rateOfDef+7) = *(rateOfDef+5);
+  *(rateOfDef+8) = *(eulerianVelGrad+8);
+
+  // Compute spin tensor, W = 1/2 * (L - Lt)
+  *(spin)   = 0.0;
+  *(spin+1) = 0.5 * ( *(eulerianVelGrad+1) - *(eulerianVelGrad+3) );
+  *(spin+2) = 0.5 * ( *(eulerianVelGrad+2) - *(eulerianVelGrad+6) );
+  *(spin+3) = -1.0 * *(spin+1);
+  *(spin+4) = 0.0;
+  *(spin+5) = 0.5 * ( *(eulerianVelGrad+5) - *(eulerianVelGrad+7) );
+  *(spin+6) = -1.0 * *(spin+2);
+  *(spin+7) = -1.0 * *(spin+5);
+  *(spin+8) = 0.0;
+ 
+  //Following Flanagan & Taylor (T&F) 
+  //
+  //Find the vector z_i = \epsilon_{ikj} * D_{jm} * V_{mk} (T&F Eq. 13)
+  //
+  //where \epsilon_{ikj} is the alternator tensor.
+  //
+  //Components below copied from computer algebra solution to the expansion
+  //above
+  
+  
+  zX = - *(leftStretchN+2) *  *(rateOfDef+3) -  *(leftStretchN+5) *  *(rateOfDef+4) - 
+         *(leftStretchN+8) *  *(rateOfDef+5) +  *(leftStretchN+1) *  *(rateOfDef+6) + 
+         *(leftStretchN+4) *  *(rateOfDef+7) +  *(leftStretchN+7) *  *(rateOfDef+8);
+  zY =   *(leftStretchN+2) *  *(rateOfDef)   +  *(leftStretchN+5) *  *(rateOfDef+1) + 
+         *(leftStretchN+8) *  *(rateOfDef+2) -  *(leftStretchN)   *  *(rateOfDef+6) - 
+         *(leftStretchN+3) *  *(rateOfDef+7) -  *(leftStretchN+6) *  *(rateOfDef+8);
+  zZ = - *(leftStretchN+1) *  *(rateOfDef)   -  *(leftStretchN+4) *  *(rateOfDef+1) - 
+         *(leftStretchN+7) *  *(rateOfDef+2) +  *(leftStretchN)   *  *(rateOfDef+3) + 
+         *(leftStretchN+3) *  *(rateOfDef+4) +  *(leftStretchN+6) *  *(rateOfDef+5);
+
+  //Find the vector w_i = -1/2 * \epsilon_{ijk} * W_{jk} (T&F Eq. 11)
+  wX = 0.5 * ( *(spin+7) - *(spin+5) );
+  wY = 0.5 * ( *(spin+2) - *(spin+6) );
+  wZ = 0.5 * ( *(spin+3) - *(spin+1) );
+
+  //Find trace(V)
+  traceV = *(leftStretchN) + *(leftStretchN+4) + *(leftStretchN+8);
+
+  // Compute (trace(V) * I - V) store in temp
+  *(temp)   = traceV - *(leftStretchN);
+  *(temp+1) = - *(leftStretchN+1);
+  *(temp+2) = - *(leftStretchN+2);
+  *(temp+3) = - *(leftStretchN+3);
+  *(temp+4) = traceV - *(leftStretchN+4);
+  *(temp+5) = - *(leftStretchN+5);
+  *(temp+6) = - *(leftStretchN+6);
+  *(temp+7) = - *(leftStretchN+7);
+  *(temp+8) = traceV - *(leftStretchN+8);
+
+  // Compute the inverse of the temp matrix
+  Invert3by3Matrix(temp, determinant, tempInv);
+
+  //Find omega vector, i.e. \omega = w +  (trace(V) I - V)^(-1) * z (T&F Eq. 12)
+  omegaX =  wX + *(tempInv)   * zX + *(tempInv+1) * zY + *(tempInv+2) * zZ;
+  omegaY =  wY + *(tempInv+3) * zX + *(tempInv+4) * zY + *(tempInv+5) * zZ;
+  omegaZ =  wZ + *(tempInv+6) * zX + *(tempInv+7) * zY + *(tempInv+8) * zZ;
+
+  //Find the tensor \Omega_{ij} = \epsilon_{ikj} * w_k (T&F Eq. 10)
+  *(OmegaTensor) = 0.0;
+  *(OmegaTensor+1) = -omegaZ;
+  *(OmegaTensor+2) = omegaY;
+  *(OmegaTensor+3) = omegaZ;
+  *(OmegaTensor+4) = 0.0;
+  *(OmegaTensor+5) = -omegaX;
+  *(OmegaTensor+6) = -omegaY;
+  *(OmegaTensor+7) = omegaX;
+  *(OmegaTensor+8) = 0.0;
+
+  //Increment R with (T&F Eq. 36 and 44) as opposed to solving (T&F 39) this
+  //is desirable for accuracy in implicit solves and has no effect on
+  //explicit solves (other than a slight decrease in speed).
+  //
+  // Compute Q with (T&F Eq. 44)
+  //
+  // Omega^2 = w_i * w_i (T&F Eq. 42)
+  OmegaSq = omegaX*omegaX + omegaY*omegaY + omegaZ*omegaZ;
+  // Omega = \sqrt{OmegaSq}
+  Omega = sqrt(OmegaSq);
+
+  // Avoid a potential divide-by-zero
+  if ( OmegaSq > 1.e-30){
+
+    // Compute Q = I + sin( dt * Omega ) * OmegaTensor / Omega - (1. - cos(dt * Omega)) * omegaTensor^2 / OmegaSq
+    //           = I + scaleFactor1 * OmegaTensor + scaleFactor2 * OmegaTensorSq
+    scaleFactor1 = sin(dt*Omega) / Omega;
+    scaleFactor2 = -(1.0 - cos(dt*Omega)) / OmegaSq;
+    MatrixMultiply<ScalarT>(false, false, 1.0, OmegaTensor, OmegaTensor, OmegaTensorSq);
+    *(QMatrix)   = 1.0 + scaleFactor1 * *(OmegaTensor)   + scaleFactor2 * *(OmegaTensorSq)   ;
+    *(QMatrix+1) =       scaleFactor1 * *(OmegaTensor+1) + scaleFactor2 * *(OmegaTensorSq+1) ;
+    *(QMatrix+2) =       scaleFactor1 * *(OmegaTensor+2) + scaleFactor2 * *(OmegaTensorSq+2) ;
+    *(QMatrix+3) =       scaleFactor1 * *(OmegaTensor+3) + scaleFactor2 * *(OmegaTensorSq+3) ;
+    *(QMatrix+4) = 1.0 + scaleFactor1 * *(OmegaTensor+4) + scaleFactor2 * *(OmegaTensorSq+4) ;
+    *(QMatrix+5) =       scaleFactor1 * *(OmegaTensor+5) + scaleFactor2 * *(OmegaTensorSq+5) ;
+    *(QMatrix+6) =       scaleFactor1 * *(OmegaTensor+6) + scaleFactor2 * *(OmegaTensorSq+6) ;
+    *(QMatrix+7) =       scaleFactor1 * *(OmegaTensor+7) + scaleFactor2 * *(OmegaTensorSq+7) ;
+    *(QMatrix+8) = 1.0 + scaleFactor1 * *(OmegaTensor+8) + scaleFactor2 * *(OmegaTensorSq+8) ;
+
+  } else {
+    *(QMatrix)   = 1.0 ; *(QMatrix+1) = 0.0 ; *(QMatrix+2) = 0.0 ;
+    *(QMatrix+3) = 0.0 ; *(QMatrix+4) = 1.0 ; *(QMatrix+5) = 0.0 ;
+    *(QMatrix+6) = 0.0 ; *(QMatrix+7) = 0.0 ; *(QMatrix+8) = 1.0 ;
+  };
+
+  // Compute R_STEP_NP1 = QMatrix * R_STEP_N (T&F Eq. 36)
+  MatrixMultiply<ScalarT>(false, false, 1.0, QMatrix, rotTensorN, rotTensorNP1);
+
+  // Compute rate of stretch, Vdot = L*V - V*Omega
+  // First tempA = L*V, 
+  MatrixMultiply<ScalarT>(false, false, 1.0, eulerianVelGrad, leftStretchN, tempA);
+
+  // tempB = V*Omega
+  MatrixMultiply<ScalarT>(false, false, 1.0, leftStretchN, OmegaTensor, tempB);
+
+  //Vdot = tempA - tempB
+  for(int i=0 ; i<9 ; ++i)
+    *(rateOfStretch+i) = *(tempA+i) - *(tempB+i);
+
+  //V_STEP_NP1 = V_STEP_N + dt*Vdot
+  for(int i=0 ; i<9 ; ++i)
+    *(leftStretchNP1+i) = *(leftStretchN+i) + dt * *(rateOfStretch+i);
+
+  // Compute the unrotated rate-of-deformation, d, i.e., temp = D * R
+  MatrixMultiply<ScalarT>(false, false, 1.0, rateOfDef, rotTensorNP1, temp);
+
+  // d = Rt * temp
+  MatrixMultiply<ScalarT>(true, false, 1.0, rotTensorNP1, temp, unrotRateOfDef);
+}
+
+//Batched form of updateLeftStretchRotationAndUnrotatedRateOfDeformation() on
+//structure-of-arrays data; performs the same sequence of operations in each lane
 template<typename ScalarT>
-int computeUnrotatedRateOfDeformationAndRotationTensor(
+void updateLeftStretchRotationAndUnrotatedRateOfDeformationBatch
+(
+const ScalarT* eulerianVelGrad,
+const ScalarT* leftStretchN,
+const ScalarT* rotTensorN,
+ScalarT* leftStretchNP1,
+ScalarT* rotTensorNP1,
+ScalarT* unrotRateOfDef,
+double dt,
+int numLanes
+)
+{
+  const int B = TENSOR_BATCH_SIZE;
+  const ScalarT* L = eulerianVelGrad;
+  const ScalarT* V = leftStretchN;
+
+  ScalarT rateOfDef[9*B], temp[9*B], tempInv[9*B], OmegaTensor[9*B], QMatrix[9*B], OmegaTensorSq[9*B];
+  ScalarT tempA[9*B], tempB[9*B];
+  ScalarT determinant[B], scaleFactor1[B], scaleFactor2[B];
+  bool rotating[B];
+
+  for(int l=0 ; l<numLanes ; ++l){
+
+    // Rate-of-deformation tensor, D = 1/2 * (L + Lt)
+    rateOfDef[l]     = L[l];
+    rateOfDef[1*B+l] = 0.5 * ( L[1*B+l] + L[3*B+l] );
+    rateOfDef[2*B+l] = 0.5 * ( L[2*B+l] + L[6*B+l] );
+    rateOfDef[3*B+l] = rateOfDef[1*B+l];
+    rateOfDef[4*B+l] = L[4*B+l];
+    rateOfDef[5*B+l] = 0.5 * ( L[5*B+l] + L[7*B+l] );
+    rateOfDef[6*B+l] = rateOfDef[2*B+l];
+    rateOfDef[7*B+l] = rateOfDef[5*B+l];
+    rateOfDef[8*B+l] = L[8*B+l];
+
+    // (trace(V) * I - V)
+    ScalarT traceV = V[l] + V[4*B+l] + V[8*B+l];
+    temp[l]     = traceV - V[l];
+    temp[1*B+l] = - V[1*B+l];
+    temp[2*B+l] = - V[2*B+l];
+    temp[3*B+l] = - V[3*B+l];
+    temp[4*B+l] = traceV - V[4*B+l];
+    temp[5*B+l] = - V[5*B+l];
+    temp[6*B+l] = - V[6*B+l];
+    temp[7*B+l] = - V[7*B+l];
+    temp[8*B+l] = traceV - V[8*B+l];
+  }
+
+  Invert3by3MatrixBatch(temp, determinant, tempInv, numLanes);
+
+  for(int l=0 ; l<numLanes ; ++l){
+
+    // Spin tensor, W = 1/2 * (L - Lt)
+    ScalarT spin1 = 0.5 * ( L[1*B+l] - L[3*B+l] );
+    ScalarT spin2 = 0.5 * ( L[2*B+l] - L[6*B+l] );
+    ScalarT spin3 = -1.0 * spin1;
+    ScalarT spin5 = 0.5 * ( L[5*B+l] - L[7*B+l] );
+    ScalarT spin6 = -1.0 * spin2;
+    ScalarT spin7 = -1.0 * spin5;
+
+    // z_i = \epsilon_{ikj} * D_{jm} * V_{mk} (T&F Eq. 13)
+    ScalarT zX = - V[2*B+l] * rateOfDef[3*B+l] - V[5*B+l] * rateOfDef[4*B+l] -
+                   V[8*B+l] * rateOfDef[5*B+l] + V[1*B+l] * rateOfDef[6*B+l] +
+                   V[4*B+l] * rateOfDef[7*B+l] + V[7*B+l] * rateOfDef[8*B+l];
+    ScalarT zY =   V[2*B+l] * rateOfDef[l]     + V[5*B+l] * rateOfDef[1*B+l] +
+                   V[8*B+l] * rateOfDef[2*B+l] - V[l]     * rateOfDef[6*B+l] -
+                   V[3*B+l] * rateOfDef[7*B+l] - V[6*B+l] * rateOfDef[8*B+l];
+    ScalarT zZ = - V[1*B+l] * rateOfDef[l]     - V[4*B+l] * rateOfDef[1*B+l] -
+                   V[7*B+l] * rateOfDef[2*B+l] + V[l]     * rateOfDef[3*B+l] +
+                   V[3*B+l] * rateOfDef[4*B+l] + V[6*B+l] * rateOfDef[5*B+l];
+
+    // w_i = -1/2 * \epsilon_{ijk} * W_{jk} (T&F Eq. 11)
+    ScalarT wX = 0.5 * ( spin7 - spin5 );
+    ScalarT wY = 0.5 * ( spin2 - spin6 );
+    ScalarT wZ = 0.5 * ( spin3 - spin1 );
+
+    // \omega = w +  (trace(V) I - V)^(-1) * z (T&F Eq. 12)
+    ScalarT omegaX =  wX + tempInv[l]     * zX + tempInv[1*B+l] * zY + tempInv[2*B+l] * zZ;
+    ScalarT omegaY =  wY + tempInv[3*B+l] * zX + tempInv[4*B+l] * zY + tempInv[5*B+l] * zZ;
+    ScalarT omegaZ =  wZ + tempInv[6*B+l] * zX + tempInv[7*B+l] * zY + tempInv[8*B+l] * zZ;
+
+    // \Omega_{ij} = \epsilon_{ikj} * w_k (T&F Eq. 10)
+    OmegaTensor[l]     = 0.0;
+    OmegaTensor[1*B+l] = -omegaZ;
+    OmegaTensor[2*B+l] = omegaY;
+    OmegaTensor[3*B+l] = omegaZ;
+    OmegaTensor[4*B+l] = 0.0;
+    OmegaTensor[5*B+l] = -omegaX;
+    OmegaTensor[6*B+l] = -omegaY;
+    OmegaTensor[7*B+l] = omegaX;
+    OmegaTensor[8*B+l] = 0.0;
+
+    // Omega^2 = w_i * w_i (T&F Eq. 42)
+    ScalarT OmegaSq = omegaX*omegaX + omegaY*omegaY + omegaZ*omegaZ;
+    ScalarT Omega = sqrt(OmegaSq);
+
+    // Avoid a potential divide-by-zero
+    rotating[l] = ( OmegaSq > 1.e-30 );
+    if(rotating[l]){
+      scaleFactor1[l] = sin(dt*Omega) / Omega;
+      scaleFactor2[l] = -(1.0 - cos(dt*Omega)) / OmegaSq;
+    }
+  }
+
+  MatrixMultiplyBatch<ScalarT>(false, false, 0, OmegaTensor, OmegaTensor, OmegaTensorSq, numLanes);
+
+  // Q = I + scaleFactor1 * OmegaTensor + scaleFactor2 * OmegaTensorSq (T&F Eq. 44)
+  for(int l=0 ; l<numLanes ; ++l){
+    for(int k=0 ; k<9 ; ++k){
+      bool diagonal = (k == 0 || k == 4 || k == 8);
+      if(rotating[l]){
+        if(diagonal)
+          QMatrix[k*B+l] = 1.0 + scaleFactor1[l] * OmegaTensor[k*B+l] + scaleFactor2[l] * OmegaTensorSq[k*B+l];
+        else
+          QMatrix[k*B+l] =       scaleFactor1[l] * OmegaTensor[k*B+l] + scaleFactor2[l] * OmegaTensorSq[k*B+l];
+      }
+      else
+        QMatrix[k*B+l] = diagonal ? 1.0 : 0.0;
+    }
+  }
+
+  // R_STEP_NP1 = QMatrix * R_STEP_N (T&F Eq. 36)
+  MatrixMultiplyBatch<ScalarT>(false, false, 0, QMatrix, rotTensorN, rotTensorNP1, numLanes);
+
+  // Vdot = L*V - V*Omega, V_STEP_NP1 = V_STEP_N + dt*Vdot
+  MatrixMultiplyBatch<ScalarT>(false, false, 0, L, V, tempA, numLanes);
+  MatrixMultiplyBatch<ScalarT>(false, false, 0, V, OmegaTensor, tempB, numLanes);
+  for(int k=0 ; k<9 ; ++k){
+#ifdef PERIDIGM_OPENMP
+    #pragma omp simd
+#endif
+    for(int l=0 ; l<numLanes ; ++l)
+      leftStretchNP1[k*B+l] = V[k*B+l] + dt * ( tempA[k*B+l] - tempB[k*B+l] );
+  }
+
+  // Unrotated rate-of-deformation, d = Rt * D * R
+  MatrixMultiplyBatch<ScalarT>(false, false, 0, rateOfDef, rotTensorNP1, temp, numLanes);
+  MatrixMultiplyBatch<ScalarT>(true, false, 0, rotTensorNP1, temp, unrotRateOfDef, numLanes);
+}
+
+//Single-pass kinematics: accumulates the shape tensor, the first term of the
+//deformation gradient, and the first term of its rate in one sweep over the
+//neighbor list, then performs the Flanagan and Taylor (1987) update at the
+//point.
+template<typename ScalarT, typename InfluenceFunctionT>
+int computeShapeTensorInverseDeformationGradientAndUnrotatedRateOfDeformationKernel
+(
 const double* volume,
 const double* horizon,
 const double* modelCoordinates,
+const ScalarT* coordinates,
 const ScalarT* velocities,
-const ScalarT* deformationGradient,
-const ScalarT* shapeTensorInverse,
+ScalarT* shapeTensorInverse,
+ScalarT* deformationGradient,
 const ScalarT* leftStretchTensorN,
 const ScalarT* rotationTensorN,
 ScalarT* leftStretchTensorNP1,
@@ -337,255 +777,201 @@ ScalarT* rotationTensorNP1,
 ScalarT* unrotatedRateOfDeformation,
 const int* neighborhoodList,
 int numPoints,
-double dt
+double dt,
+const InfluenceFunctionT influenceFunction
 )
 {
   int returnCode = 0;
 
-  const double* delta = horizon;
-  const double* modelCoord = modelCoordinates;
+  const int B = TENSOR_BATCH_SIZE;
+
+  const double* delta;
+  const double* modelCoord;
   const double* neighborModelCoord;
-  const ScalarT* vel = velocities;
+  const ScalarT* coord;
+  const ScalarT* neighborCoord;
+  const ScalarT* vel;
   const ScalarT* neighborVel;
-  const ScalarT* defGrad = deformationGradient;
-  const ScalarT* shapeTensorInv = shapeTensorInverse;
-  const ScalarT* leftStretchN = leftStretchTensorN;
-  const ScalarT* rotTensorN = rotationTensorN;
 
-  ScalarT* leftStretchNP1 = leftStretchTensorNP1;
-  ScalarT* rotTensorNP1 = rotationTensorNP1;
-  ScalarT* unrotRateOfDef = unrotatedRateOfDeformation;
+  double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
+  ScalarT deformedBondX, deformedBondY, deformedBondZ;
+  ScalarT velStateX, velStateY, velStateZ;
+  double neighborVolume, omega, temp;
 
-  std::vector<ScalarT> FdotFirstTermVector(9) ; ScalarT* FdotFirstTerm = &FdotFirstTermVector[0];
-  std::vector<ScalarT> FdotVector(9) ; ScalarT* Fdot = &FdotVector[0];
-  std::vector<ScalarT> FinverseVector(9) ; ScalarT* Finverse = &FinverseVector[0];
-  std::vector<ScalarT> eulerianVelGradVector(9) ; ScalarT* eulerianVelGrad = &eulerianVelGradVector[0];
-  std::vector<ScalarT> rateOfDefVector(9) ; ScalarT* rateOfDef = &rateOfDefVector[0];
-  std::vector<ScalarT> spinVector(9) ; ScalarT* spin = &spinVector[0];
-  std::vector<ScalarT> tempVector(9) ; ScalarT* temp = &tempVector[0];
-  std::vector<ScalarT> tempInvVector(9) ; ScalarT* tempInv = &tempInvVector[0];
-  std::vector<ScalarT> OmegaTensorVector(9) ; ScalarT* OmegaTensor = &OmegaTensorVector[0];
-  std::vector<ScalarT> QMatrixVector(9) ; ScalarT* QMatrix = &QMatrixVector[0];
-  std::vector<ScalarT> OmegaTensorSqVector(9) ; ScalarT* OmegaTensorSq = &OmegaTensorSqVector[0];
-  std::vector<ScalarT> tempAVector(9) ; ScalarT* tempA = &tempAVector[0];
-  std::vector<ScalarT> tempBVector(9) ; ScalarT* tempB = &tempBVector[0];
-  std::vector<ScalarT> rateOfStretchVector(9) ; ScalarT* rateOfStretch = &rateOfStretchVector[0];
+  // Points are processed in batches; tensors are held in structure-of-arrays
+  // form so that the point-local tensor algebra runs across the batch
+  ScalarT shapeTensor[9*B], defGradFirstTerm[9*B], FdotFirstTerm[9*B];
+  ScalarT shapeTensorInv[9*B], defGrad[9*B], Fdot[9*B], Finverse[9*B], eulerianVelGrad[9*B];
+  ScalarT leftStretchN[9*B], rotTensorN[9*B], leftStretchNP1[9*B], rotTensorNP1[9*B], unrotRateOfDef[9*B];
+  ScalarT determinant[B];
 
-  ScalarT determinant;
-  ScalarT omegaX, omegaY, omegaZ;
-  ScalarT zX, zY, zZ;
-  ScalarT wX, wY, wZ;
-  ScalarT velStateX, velStateY, velStateZ;
-  ScalarT traceV, Omega, OmegaSq, scaleFactor1, scaleFactor2;
-  double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
-  double neighborVolume, omega, scalarTemp; 
   int inversionReturnCode(0);
 
-  // placeholder for bond damage
-  double bondDamage = 0.0;
-
   int neighborIndex, numNeighbors;
   const int *neighborListPtr = neighborhoodList;
-  for(int iID=0 ; iID<numPoints ; ++iID, delta++, modelCoord+=3, vel+=3,
-        shapeTensorInv+=9, rotTensorN+=9, rotTensorNP1+=9, leftStretchNP1+=9, leftStretchN+=9,
-        unrotRateOfDef+=9, defGrad+=9){
-
-    // Initialize data
-    *(FdotFirstTerm)   = 0.0 ; *(FdotFirstTerm+1) = 0.0 ;  *(FdotFirstTerm+2) = 0.0;
-    *(FdotFirstTerm+3) = 0.0 ; *(FdotFirstTerm+4) = 0.0 ;  *(FdotFirstTerm+5) = 0.0;
-    *(FdotFirstTerm+6) = 0.0 ; *(FdotFirstTerm+7) = 0.0 ;  *(FdotFirstTerm+8) = 0.0;
-    
-    //Compute Fdot
-    numNeighbors = *neighborListPtr; neighborListPtr++;
-    for(int n=0; n<numNeighbors; n++, neighborListPtr++){
+  for(int firstID=0 ; firstID<numPoints ; firstID+=B){
 
-      neighborIndex = *neighborListPtr;
-      neighborVolume = volume[neighborIndex];
-      neighborModelCoord = modelCoordinates + 3*neighborIndex;
-      neighborVel = velocities + 3*neighborIndex;
+    int numLanes = numPoints - firstID < B ? numPoints - firstID : B;
 
-      undeformedBondX = *(neighborModelCoord)   - *(modelCoord);
-      undeformedBondY = *(neighborModelCoord+1) - *(modelCoord+1);
-      undeformedBondZ = *(neighborModelCoord+2) - *(modelCoord+2);
-      undeformedBondLength = sqrt(undeformedBondX*undeformedBondX +
-                                  undeformedBondY*undeformedBondY +
-                                  undeformedBondZ*undeformedBondZ);
+    // Zero out data
+    for(int i=0 ; i<9*B ; ++i){
+      shapeTensor[i] = 0.0;
+      defGradFirstTerm[i] = 0.0;
+      FdotFirstTerm[i] = 0.0;
+    }
 
-      // The velState is the relative difference in velocities of the nodes at
-      // each end of a bond. i.e., v_j - v_i
-      velStateX = *(neighborVel)   - *(vel);
-      velStateY = *(neighborVel+1) - *(vel+1);
-      velStateZ = *(neighborVel+2) - *(vel+2);
+    for(int l=0 ; l<numLanes ; ++l){
 
-      omega = MATERIAL_EVALUATION::scalarInfluenceFunction(undeformedBondLength, *delta);
+      int iID = firstID + l;
+      delta = horizon + iID;
+      modelCoord = modelCoordinates + 3*iID;
+      coord = coordinates + 3*iID;
+      vel = velocities + 3*iID;
+
+      numNeighbors = *neighborListPtr; neighborListPtr++;
+      for(int n=0; n<numNeighbors; n++, neighborListPtr++){
+
+        neighborIndex = *neighborListPtr;
+        neighborVolume = volume[neighborIndex];
+        neighborModelCoord = modelCoordinates + 3*neighborIndex;
+        neighborCoord = coordinates + 3*neighborIndex;
+        neighborVel = velocities + 3*neighborIndex;
 
-      scalarTemp = (1.0 - bondDamage) * omega * neighborVolume;
-
-      *(FdotFirstTerm)   += scalarTemp * velStateX * undeformedBondX;
-      *(FdotFirstTerm+1) += scalarTemp * velStateX * undeformedBondY;
-      *(FdotFirstTerm+2) += scalarTemp * velStateX * undeformedBondZ;
-      *(FdotFirstTerm+3) += scalarTemp * velStateY * undeformedBondX;
-      *(FdotFirstTerm+4) += scalarTemp * velStateY * undeformedBondY;
-      *(FdotFirstTerm+5) += scalarTemp * velStateY * undeformedBondZ;
-      *(FdotFirstTerm+6) += scalarTemp * velStateZ * undeformedBondX;
-      *(FdotFirstTerm+7) += scalarTemp * velStateZ * undeformedBondY;
-      *(FdotFirstTerm+8) += scalarTemp * velStateZ * undeformedBondZ;
+        undeformedBondX = *(neighborModelCoord)   - *(modelCoord);
+        undeformedBondY = *(neighborModelCoord+1) - *(modelCoord+1);
+        undeformedBondZ = *(neighborModelCoord+2) - *(modelCoord+2);
+        undeformedBondLength = sqrt(undeformedBondX*undeformedBondX +
+                                    undeformedBondY*undeformedBondY +
+                                    undeformedBondZ*undeformedBondZ);
+
+        deformedBondX = *(neighborCoord)   - *(coord);
+        deformedBondY = *(neighborCoord+1) - *(coord+1);
+        deformedBondZ = *(neighborCoord+2) - *(coord+2);
+
+        // The velState is the relative difference in velocities of the nodes at
+        // each end of a bond. i.e., v_j - v_i
+        velStateX = *(neighborVel)   - *(vel);
+        velStateY = *(neighborVel+1) - *(vel+1);
+        velStateZ = *(neighborVel+2) - *(vel+2);
+
+        omega = influenceFunction(undeformedBondLength, *delta);
+
+        temp = omega * neighborVolume;
+
+        shapeTensor[0*B+l] += temp * undeformedBondX * undeformedBondX;
+        shapeTensor[1*B+l] += temp * undeformedBondX * undeformedBondY;
+        shapeTensor[2*B+l] += temp * undeformedBondX * undeformedBondZ;
+        shapeTensor[3*B+l] += temp * undeformedBondY * undeformedBondX;
+        shapeTensor[4*B+l] += temp * undeformedBondY * undeformedBondY;
+        shapeTensor[5*B+l] += temp * undeformedBondY * undeformedBondZ;
+        shapeTensor[6*B+l] += temp * undeformedBondZ * undeformedBondX;
+        shapeTensor[7*B+l] += temp * undeformedBondZ * undeformedBondY;
+        shapeTensor[8*B+l] += temp * undeformedBondZ * undeformedBondZ;
+
+        defGradFirstTerm[0*B+l] += temp * deformedBondX * undeformedBondX;
+        defGradFirstTerm[1*B+l] += temp * deformedBondX * undeformedBondY;
+        defGradFirstTerm[2*B+l] += temp * deformedBondX * undeformedBondZ;
+        defGradFirstTerm[3*B+l] += temp * deformedBondY * undeformedBondX;
+        defGradFirstTerm[4*B+l] += temp * deformedBondY * undeformedBondY;
+        defGradFirstTerm[5*B+l] += temp * deformedBondY * undeformedBondZ;
+        defGradFirstTerm[6*B+l] += temp * deformedBondZ * undeformedBondX;
+        defGradFirstTerm[7*B+l] += temp * deformedBondZ * undeformedBondY;
+        defGradFirstTerm[8*B+l] += temp * deformedBondZ * undeformedBondZ;
+
+        FdotFirstTerm[0*B+l] += temp * velStateX * undeformedBondX;
+        FdotFirstTerm[1*B+l] += temp * velStateX * undeformedBondY;
+        FdotFirstTerm[2*B+l] += temp * velStateX * undeformedBondZ;
+        FdotFirstTerm[3*B+l] += temp * velStateY * undeformedBondX;
+        FdotFirstTerm[4*B+l] += temp * velStateY * undeformedBondY;
+        FdotFirstTerm[5*B+l] += temp * velStateY * undeformedBondZ;
+        FdotFirstTerm[6*B+l] += temp * velStateZ * undeformedBondX;
+        FdotFirstTerm[7*B+l] += temp * velStateZ * undeformedBondY;
+        FdotFirstTerm[8*B+l] += temp * velStateZ * undeformedBondZ;
+      }
     }
 
-    // Compute Fdot
-    MatrixMultiply(false, false, 1.0, FdotFirstTerm, shapeTensorInv, Fdot);
+    inversionReturnCode = Invert3by3MatrixBatch(shapeTensor, determinant, shapeTensorInv, numLanes);
+    if(inversionReturnCode > 0)
+      returnCode = inversionReturnCode;
+
+    // Deformation gradient and its rate
+    MatrixMultiplyBatch<ScalarT>(false, false, 0, defGradFirstTerm, shapeTensorInv, defGrad, numLanes);
+    MatrixMultiplyBatch<ScalarT>(false, false, 0, FdotFirstTerm, shapeTensorInv, Fdot, numLanes);
 
     // Compute the inverse of the deformation gradient, Finverse
-    inversionReturnCode = Invert3by3Matrix(defGrad, determinant, Finverse);
+    inversionReturnCode = Invert3by3MatrixBatch(defGrad, determinant, Finverse, numLanes);
     if(inversionReturnCode > 0)
       returnCode = inversionReturnCode;
 
     // Compute the Eulerian velocity gradient L = Fdot * Finv
-    MatrixMultiply(false, false, 1.0, Fdot, Finverse, eulerianVelGrad);
-
-    // Compute rate-of-deformation tensor, D = 1/2 * (L + Lt)
-    *(rateOfDef)   = *(eulerianVelGrad);
-    *(rateOfDef+1) = 0.5 * ( *(eulerianVelGrad+1) + *(eulerianVelGrad+3) );
-    *(rateOfDef+2) = 0.5 * ( *(eulerianVelGrad+2) + *(eulerianVelGrad+6) );
-    *(rateOfDef+3) = *(rateOfDef+1);
-    *(rateOfDef+4) = *(eulerianVelGrad+4);
-    *(rateOfDef+5) = 0.5 * ( *(eulerianVelGrad+5) + *(eulerianVelGrad+7) );
-    *(rateOfDef+6) = *(rateOfDef+2);
-    *(rateOfDef+7) = *(rateOfDef+5);
-    *(rateOfDef+8) = *(eulerianVelGrad+8);
-
-    // Compute spin tensor, W = 1/2 * (L - Lt)
-    *(spin)   = 0.0;
-    *(spin+1) = 0.5 * ( *(eulerianVelGrad+1) - *(eulerianVelGrad+3) );
-    *(spin+2) = 0.5 * ( *(eulerianVelGrad+2) - *(eulerianVelGrad+6) );
-    *(spin+3) = -1.0 * *(spin+1);
-    *(spin+4) = 0.0;
-    *(spin+5) = 0.5 * ( *(eulerianVelGrad+5) - *(eulerianVelGrad+7) );
-    *(spin+6) = -1.0 * *(spin+2);
-    *(spin+7) = -1.0 * *(spin+5);
-    *(spin+8) = 0.0;
-   
-    //Following Flanagan & Taylor (T&F) 
-    //
-    //Find the vector z_i = \epsilon_{ikj} * D_{jm} * V_{mk} (T&F Eq. 13)
-    //
-    //where \epsilon_{ikj} is the alternator tensor.
-    //
-    //Components below copied from computer algebra solution to the expansion
-    //above
-    
-    
-    zX = - *(leftStretchN+2) *  *(rateOfDef+3) -  *(leftStretchN+5) *  *(rateOfDef+4) - 
-           *(leftStretchN+8) *  *(rateOfDef+5) +  *(leftStretchN+1) *  *(rateOfDef+6) + 
-           *(leftStretchN+4) *  *(rateOfDef+7) +  *(leftStretchN+7) *  *(rateOfDef+8);
-    zY =   *(leftStretchN+2) *  *(rateOfDef)   +  *(leftStretchN+5) *  *(rateOfDef+1) + 
-           *(leftStretchN+8) *  *(rateOfDef+2) -  *(leftStretchN)   *  *(rateOfDef+6) - 
-           *(leftStretchN+3) *  *(rateOfDef+7) -  *(leftStretchN+6) *  *(rateOfDef+8);
-    zZ = - *(leftStretchN+1) *  *(rateOfDef)   -  *(leftStretchN+4) *  *(rateOfDef+1) - 
-           *(leftStretchN+7) *  *(rateOfDef+2) +  *(leftStretchN)   *  *(rateOfDef+3) + 
-           *(leftStretchN+3) *  *(rateOfDef+4) +  *(leftStretchN+6) *  *(rateOfDef+5);
-
-    //Find the vector w_i = -1/2 * \epsilon_{ijk} * W_{jk} (T&F Eq. 11)
-    wX = 0.5 * ( *(spin+7) - *(spin+5) );
-    wY = 0.5 * ( *(spin+2) - *(spin+6) );
-    wZ = 0.5 * ( *(spin+3) - *(spin+1) );
-
-    //Find trace(V)
-    traceV = *(leftStretchN) + *(leftStretchN+4) + *(leftStretchN+8);
-
-    // Compute (trace(V) * I - V) store in temp
-    *(temp)   = traceV - *(leftStretchN);
-    *(temp+1) = - *(leftStretchN+1);
-    *(temp+2) = - *(leftStretchN+2);
-    *(temp+3) = - *(leftStretchN+3);
-    *(temp+4) = traceV - *(leftStretchN+4);
-    *(temp+5) = - *(leftStretchN+5);
-    *(temp+6) = - *(leftStretchN+6);
-    *(temp+7) = - *(leftStretchN+7);
-    *(temp+8) = traceV - *(leftStretchN+8);
-
-    // Compute the inverse of the temp matrix
-    Invert3by3Matrix(temp, determinant, tempInv);
-    if(inversionReturnCode > 0)
-      returnCode = inversionReturnCode;
+    MatrixMultiplyBatch<ScalarT>(false, false, 0, Fdot, Finverse, eulerianVelGrad, numLanes);
 
-    //Find omega vector, i.e. \omega = w +  (trace(V) I - V)^(-1) * z (T&F Eq. 12)
-    omegaX =  wX + *(tempInv)   * zX + *(tempInv+1) * zY + *(tempInv+2) * zZ;
-    omegaY =  wY + *(tempInv+3) * zX + *(tempInv+4) * zY + *(tempInv+5) * zZ;
-    omegaZ =  wZ + *(tempInv+6) * zX + *(tempInv+7) * zY + *(tempInv+8) * zZ;
-
-    //Find the tensor \Omega_{ij} = \epsilon_{ikj} * w_k (T&F Eq. 10)
-    *(OmegaTensor) = 0.0;
-    *(OmegaTensor+1) = -omegaZ;
-    *(OmegaTensor+2) = omegaY;
-    *(OmegaTensor+3) = omegaZ;
-    *(OmegaTensor+4) = 0.0;
-    *(OmegaTensor+5) = -omegaX;
-    *(OmegaTensor+6) = -omegaY;
-    *(OmegaTensor+7) = omegaX;
-    *(OmegaTensor+8) = 0.0;
-
-    //Increment R with (T&F Eq. 36 and 44) as opposed to solving (T&F 39) this
-    //is desirable for accuracy in implicit solves and has no effect on
-    //explicit solves (other than a slight decrease in speed).
-    //
-    // Compute Q with (T&F Eq. 44)
-    //
-    // Omega^2 = w_i * w_i (T&F Eq. 42)
-    OmegaSq = omegaX*omegaX + omegaY*omegaY + omegaZ*omegaZ;
-    // Omega = \sqrt{OmegaSq}
-    Omega = sqrt(OmegaSq);
+    gatherTensorBatch(leftStretchTensorN + 9*firstID, leftStretchN, numLanes);
+    gatherTensorBatch(rotationTensorN + 9*firstID, rotTensorN, numLanes);
 
-    // Avoid a potential divide-by-zero
-    if ( OmegaSq > 1.e-30){
-
-      // Compute Q = I + sin( dt * Omega ) * OmegaTensor / Omega - (1. - cos(dt * Omega)) * omegaTensor^2 / OmegaSq
-      //           = I + scaleFactor1 * OmegaTensor + scaleFactor2 * OmegaTensorSq
-      scaleFactor1 = sin(dt*Omega) / Omega;
-      scaleFactor2 = -(1.0 - cos(dt*Omega)) / OmegaSq;
-      MatrixMultiply(false, false, 1.0, OmegaTensor, OmegaTensor, OmegaTensorSq);
-      *(QMatrix)   = 1.0 + scaleFactor1 * *(OmegaTensor)   + scaleFactor2 * *(OmegaTensorSq)   ;
-      *(QMatrix+1) =       scaleFactor1 * *(OmegaTensor+1) + scaleFactor2 * *(OmegaTensorSq+1) ;
-      *(QMatrix+2) =       scaleFactor1 * *(OmegaTensor+2) + scaleFactor2 * *(OmegaTensorSq+2) ;
-      *(QMatrix+3) =       scaleFactor1 * *(OmegaTensor+3) + scaleFactor2 * *(OmegaTensorSq+3) ;
-      *(QMatrix+4) = 1.0 + scaleFactor1 * *(OmegaTensor+4) + scaleFactor2 * *(OmegaTensorSq+4) ;
-      *(QMatrix+5) =       scaleFactor1 * *(OmegaTensor+5) + scaleFactor2 * *(OmegaTensorSq+5) ;
-      *(QMatrix+6) =       scaleFactor1 * *(OmegaTensor+6) + scaleFactor2 * *(OmegaTensorSq+6) ;
-      *(QMatrix+7) =       scaleFactor1 * *(OmegaTensor+7) + scaleFactor2 * *(OmegaTensorSq+7) ;
-      *(QMatrix+8) = 1.0 + scaleFactor1 * *(OmegaTensor+8) + scaleFactor2 * *(OmegaTensorSq+8) ;
-
-    } else {
-      *(QMatrix)   = 1.0 ; *(QMatrix+1) = 0.0 ; *(QMatrix+2) = 0.0 ;
-      *(QMatrix+3) = 0.0 ; *(QMatrix+4) = 1.0 ; *(QMatrix+5) = 0.0 ;
-      *(QMatrix+6) = 0.0 ; *(QMatrix+7) = 0.0 ; *(QMatrix+8) = 1.0 ;
-    };
-
-    // Compute R_STEP_NP1 = QMatrix * R_STEP_N (T&F Eq. 36)
-    MatrixMultiply(false, false, 1.0, QMatrix, rotTensorN, rotTensorNP1);
-
-    // Compute rate of stretch, Vdot = L*V - V*Omega
-    // First tempA = L*V, 
-    MatrixMultiply(false, false, 1.0, eulerianVelGrad, leftStretchN, tempA);
-
-    // tempB = V*Omega
-    MatrixMultiply(false, false, 1.0, leftStretchN, OmegaTensor, tempB);
-
-    //Vdot = tempA - tempB
-    for(int i=0 ; i<9 ; ++i)
-      *(rateOfStretch+i) = *(tempA+i) - *(tempB+i);
+    updateLeftStretchRotationAndUnrotatedRateOfDeformationBatch(eulerianVelGrad, leftStretchN, rotTensorN,
+                                                                leftStretchNP1, rotTensorNP1, unrotRateOfDef,
+                                                                dt, numLanes);
 
-    //V_STEP_NP1 = V_STEP_N + dt*Vdot
-    for(int i=0 ; i<9 ; ++i)
-      *(leftStretchNP1+i) = *(leftStretchN+i) + dt * *(rateOfStretch+i);
+    scatterTensorBatch(shapeTensorInv, shapeTensorInverse + 9*firstID, numLanes);
+    scatterTensorBatch(defGrad, deformationGradient + 9*firstID, numLanes);
+    scatterTensorBatch(leftStretchNP1, leftStretchTensorNP1 + 9*firstID, numLanes);
+    scatterTensorBatch(rotTensorNP1, rotationTensorNP1 + 9*firstID, numLanes);
+    scatterTensorBatch(unrotRateOfDef, unrotatedRateOfDeformation + 9*firstID, numLanes);
+  }
 
-    // Compute the unrotated rate-of-deformation, d, i.e., temp = D * R
-    MatrixMultiply(false, false, 1.0, rateOfDef, rotTensorNP1, temp);
+  return returnCode;
+}
 
-    // d = Rt * temp
-    MatrixMultiply(true, false, 1.0, rotTensorNP1, temp, unrotRateOfDef);
+template<typename ScalarT>
+struct ComputeShapeTensorInverseDeformationGradientAndUnrotatedRateOfDeformation {
+  const double* volume;
+  const double* horizon;
+  const double* modelCoordinates;
+  const ScalarT* coordinates;
+  const ScalarT* velocities;
+  ScalarT* shapeTensorInverse;
+  ScalarT* deformationGradient;
+  const ScalarT* leftStretchTensorN;
+  const ScalarT* rotationTensorN;
+  ScalarT* leftStretchTensorNP1;
+  ScalarT* rotationTensorNP1;
+  ScalarT* unrotatedRateOfDeformation;
+  const int* neighborhoodList;
+  int numPoints;
+  double dt;
+  int returnCode;
+
+  template<typename InfluenceFunctionT>
+  void operator()(const InfluenceFunctionT influenceFunction)
+  {
+    returnCode = computeShapeTensorInverseDeformationGradientAndUnrotatedRateOfDeformationKernel(volume, horizon, modelCoordinates, coordinates, velocities, shapeTensorInverse, deformationGradient, leftStretchTensorN, rotationTensorN, leftStretchTensorNP1, rotationTensorNP1, unrotatedRateOfDeformation, neighborhoodList, numPoints, dt, influenceFunction);
   }
+};
 
-  return returnCode;
+template<typename ScalarT>
+int computeShapeTensorInverseDeformationGradientAndUnrotatedRateOfDeformation
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const ScalarT* coordinates,
+const ScalarT* velocities,
+ScalarT* shapeTensorInverse,
+ScalarT* deformationGradient,
+const ScalarT* leftStretchTensorN,
+const ScalarT* rotationTensorN,
+ScalarT* leftStretchTensorNP1,
+ScalarT* rotationTensorNP1,
+ScalarT* unrotatedRateOfDeformation,
+const int* neighborhoodList,
+int numPoints,
+double dt
+)
+{
+  ComputeShapeTensorInverseDeformationGradientAndUnrotatedRateOfDeformation<ScalarT> kernel = {volume, horizon, modelCoordinates, coordinates, velocities, shapeTensorInverse, deformationGradient, leftStretchTensorN, rotationTensorN, leftStretchTensorNP1, rotationTensorNP1, unrotatedRateOfDeformation, neighborhoodList, numPoints, dt, 0};
+  PeridigmNS::InfluenceFunction::dispatch(PeridigmNS::InfluenceFunction::self().getInfluenceFunction(), kernel);
+  return kernel.returnCode;
 }
 
 template<typename ScalarT>
@@ -653,106 +1039,232 @@ void computeGreenLagrangeStrain
   }
 }
 
-template<typename ScalarT>
-void computeHourglassForce
+//Single-pass force evaluation: converts the Cauchy stress to a first
+//Piola-Kirchhoff stress and sums the resulting pairwise force densities and
+//the hourglass force densities in one sweep over the neighbor list.  The
+//hourglass contribution is included in forceDensity and also stored
+//separately in hourglassForceDensity.  The partial stress is accumulated if
+//partialStress is not NULL.  Returns nonzero if a deformation gradient
+//cannot be inverted.
+template<typename ScalarT, typename InfluenceFunctionT>
+int computeForceDensityAndHourglassForceDensityKernel
 (
 const double* volume,
 const double* horizon,
 const double* modelCoordinates,
 const ScalarT* coordinates,
 const ScalarT* deformationGradient,
+const ScalarT* shapeTensorInverse,
+const ScalarT* cauchyStress,
+ScalarT* forceDensity,
 ScalarT* hourglassForceDensity,
+ScalarT* partialStress,
 const int* neighborhoodList,
 int numPoints,
 double bulkModulus,
-double hourglassCoefficient
+double hourglassCoefficient,
+const InfluenceFunctionT influenceFunction
 )
 {
-  double vol, neighborVol;
-  double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
-  ScalarT deformedBondX, deformedBondY, deformedBondZ, deformedBondLength;
-  ScalarT expectedNeighborLocationX, expectedNeighborLocationY, expectedNeighborLocationZ;
-  ScalarT hourglassVectorX, hourglassVectorY, hourglassVectorZ;
-  ScalarT dot, magnitude;
-  int neighborIndex, numNeighbors;
+  int returnCode = 0;
 
-  const ScalarT* defGrad = deformationGradient;
+  const int B = TENSOR_BATCH_SIZE;
 
-  const double* delta = horizon;
-  const double* modelCoord = modelCoordinates;
+  const double* delta;
+  const double* modelCoord;
   const double* neighborModelCoord;
-  const ScalarT* coord = coordinates;
+  const ScalarT* coord;
   const ScalarT* neighborCoord;
-  ScalarT* hourglassForceDensityPtr = hourglassForceDensity;
+  const ScalarT* defGrad;
+  ScalarT* forceDensityPtr;
+  ScalarT* neighborForceDensityPtr;
+  ScalarT* hourglassForceDensityPtr;
   ScalarT* neighborHourglassForceDensityPtr;
+  ScalarT* partialStressPtr = partialStress;
 
-  // placeholder for inclusion of bond damage
-  double bondDamage = 0.0;
+  double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
+  ScalarT deformedBondX, deformedBondY, deformedBondZ, deformedBondLength;
+  ScalarT hourglassVectorX, hourglassVectorY, hourglassVectorZ;
+  ScalarT TX, TY, TZ, dot, magnitude, hourglassX, hourglassY, hourglassZ;
+  double omega, vol, neighborVol;
+
+  // The Piola stress is formed for a batch of points in structure-of-arrays
+  // form, then the bonds of each point in the batch are visited in turn
+  ScalarT defGradBatch[9*B], stressBatch[9*B], shapeTensorInvBatch[9*B];
+  ScalarT defGradInv[9*B], piolaStress[9*B], tempBatch[9*B], temp[9];
+  ScalarT jacobianDeterminant[B];
 
   const double pi = PeridigmNS::value_of_pi();
   double firstPartOfConstant = 18.0*hourglassCoefficient*bulkModulus/pi;
   double constant;
 
+  int inversionReturnCode(0);
+
+  int neighborIndex, numNeighbors;
   const int *neighborListPtr = neighborhoodList;
-  for(int iID=0 ; iID<numPoints ; ++iID, delta++, modelCoord+=3, coord+=3,
-        defGrad+=9, hourglassForceDensityPtr+=3){
+  for(int firstID=0 ; firstID<numPoints ; firstID+=B){
 
-    constant = firstPartOfConstant/( (*delta)*(*delta)*(*delta)*(*delta) );
+    int numLanes = numPoints - firstID < B ? numPoints - firstID : B;
 
-    numNeighbors = *neighborListPtr; neighborListPtr++;
-    for(int n=0; n<numNeighbors; n++, neighborListPtr++){
-      neighborIndex = *neighborListPtr;
-      neighborModelCoord = modelCoordinates + 3*neighborIndex;
-      neighborCoord = coordinates + 3*neighborIndex;
+    gatherTensorBatch(deformationGradient + 9*firstID, defGradBatch, numLanes);
+    gatherTensorBatch(cauchyStress + 9*firstID, stressBatch, numLanes);
+    gatherTensorBatch(shapeTensorInverse + 9*firstID, shapeTensorInvBatch, numLanes);
 
-      undeformedBondX = *(neighborModelCoord)   - *(modelCoord);
-      undeformedBondY = *(neighborModelCoord+1) - *(modelCoord+1);
-      undeformedBondZ = *(neighborModelCoord+2) - *(modelCoord+2);
-      undeformedBondLength = sqrt(undeformedBondX*undeformedBondX +
-                                  undeformedBondY*undeformedBondY +
-                                  undeformedBondZ*undeformedBondZ);
+    // first Piola-Kirchhoff stress = J * cauchyStress * defGrad^-T
+    inversionReturnCode = Invert3by3MatrixBatch(defGradBatch, jacobianDeterminant, defGradInv, numLanes);
+    if(inversionReturnCode > 0)
+      returnCode = inversionReturnCode;
 
-      deformedBondX = *(neighborCoord)   - *(coord);
-      deformedBondY = *(neighborCoord+1) - *(coord+1);
-      deformedBondZ = *(neighborCoord+2) - *(coord+2);
-      deformedBondLength = sqrt(deformedBondX*deformedBondX +
-                                deformedBondY*deformedBondY +
-                                deformedBondZ*deformedBondZ);
+    //P = J * \sigma * F^(-T)
+    MatrixMultiplyBatch<ScalarT>(false, true, jacobianDeterminant, stressBatch, defGradInv, piolaStress, numLanes);
 
-      expectedNeighborLocationX = *(coord) +
-        *(defGrad) * undeformedBondX +
-        *(defGrad+1) * undeformedBondY +
-        *(defGrad+2) * undeformedBondZ;
-      expectedNeighborLocationY = *(coord+1) +
-        *(defGrad+3) * undeformedBondX +
-        *(defGrad+4) * undeformedBondY +
-        *(defGrad+5) * undeformedBondZ;
-      expectedNeighborLocationZ = *(coord+2) +
-        *(defGrad+6) * undeformedBondX +
-        *(defGrad+7) * undeformedBondY +
-        *(defGrad+8) * undeformedBondZ;
+    // Inner product of Piola stress and the inverse of the shape tensor
+    MatrixMultiplyBatch<ScalarT>(false, false, 0, piolaStress, shapeTensorInvBatch, tempBatch, numLanes);
 
-      hourglassVectorX = expectedNeighborLocationX - *(neighborCoord);
-      hourglassVectorY = expectedNeighborLocationY - *(neighborCoord+1);
-      hourglassVectorZ = expectedNeighborLocationZ - *(neighborCoord+2);
+    for(int l=0 ; l<numLanes ; ++l){
 
-      dot = hourglassVectorX*deformedBondX + hourglassVectorY*deformedBondY + hourglassVectorZ*deformedBondZ;
-      dot *= -1.0;
+      int iID = firstID + l;
+      delta = horizon + iID;
+      modelCoord = modelCoordinates + 3*iID;
+      coord = coordinates + 3*iID;
+      defGrad = deformationGradient + 9*iID;
+      forceDensityPtr = forceDensity + 3*iID;
+      hourglassForceDensityPtr = hourglassForceDensity + 3*iID;
 
-      magnitude = (1.0-bondDamage) * constant * (dot/undeformedBondLength) * (1.0/deformedBondLength);
+      for(int k=0 ; k<9 ; ++k)
+        temp[k] = tempBatch[k*B+l];
 
+      constant = firstPartOfConstant/( (*delta)*(*delta)*(*delta)*(*delta) );
       vol = volume[iID];
-      neighborVol = volume[neighborIndex];
-      neighborHourglassForceDensityPtr = hourglassForceDensity + 3*neighborIndex;
-
-      *(hourglassForceDensityPtr)   += magnitude * deformedBondX * neighborVol;
-      *(hourglassForceDensityPtr+1) += magnitude * deformedBondY * neighborVol;
-      *(hourglassForceDensityPtr+2) += magnitude * deformedBondZ * neighborVol;
-      *(neighborHourglassForceDensityPtr)   -= magnitude * deformedBondX * vol;
-      *(neighborHourglassForceDensityPtr+1) -= magnitude * deformedBondY * vol;
-      *(neighborHourglassForceDensityPtr+2) -= magnitude * deformedBondZ * vol;
+
+      if(partialStressPtr != 0)
+        partialStressPtr = partialStress + 9*iID;
+
+      numNeighbors = *neighborListPtr; neighborListPtr++;
+      for(int n=0; n<numNeighbors; n++, neighborListPtr++){
+
+        neighborIndex = *neighborListPtr;
+        neighborVol = volume[neighborIndex];
+        neighborModelCoord = modelCoordinates + 3*neighborIndex;
+        neighborCoord = coordinates + 3*neighborIndex;
+
+        undeformedBondX = *(neighborModelCoord)   - *(modelCoord);
+        undeformedBondY = *(neighborModelCoord+1) - *(modelCoord+1);
+        undeformedBondZ = *(neighborModelCoord+2) - *(modelCoord+2);
+        undeformedBondLength = sqrt(undeformedBondX*undeformedBondX +
+                                    undeformedBondY*undeformedBondY +
+                                    undeformedBondZ*undeformedBondZ);
+
+        deformedBondX = *(neighborCoord)   - *(coord);
+        deformedBondY = *(neighborCoord+1) - *(coord+1);
+        deformedBondZ = *(neighborCoord+2) - *(coord+2);
+        deformedBondLength = sqrt(deformedBondX*deformedBondX +
+                                  deformedBondY*deformedBondY +
+                                  deformedBondZ*deformedBondZ);
+
+        // Force state from the Piola stress
+        omega = influenceFunction(undeformedBondLength, *delta);
+        TX = omega * ( temp[0] * undeformedBondX + temp[1] * undeformedBondY + temp[2] * undeformedBondZ );
+        TY = omega * ( temp[3] * undeformedBondX + temp[4] * undeformedBondY + temp[5] * undeformedBondZ );
+        TZ = omega * ( temp[6] * undeformedBondX + temp[7] * undeformedBondY + temp[8] * undeformedBondZ );
+
+        // Hourglass force, i.e., the difference between the expected
+        // and actual neighbor location projected on the deformed bond
+        hourglassVectorX = *(defGrad)   * undeformedBondX + *(defGrad+1) * undeformedBondY + *(defGrad+2) * undeformedBondZ - deformedBondX;
+        hourglassVectorY = *(defGrad+3) * undeformedBondX + *(defGrad+4) * undeformedBondY + *(defGrad+5) * undeformedBondZ - deformedBondY;
+        hourglassVectorZ = *(defGrad+6) * undeformedBondX + *(defGrad+7) * undeformedBondY + *(defGrad+8) * undeformedBondZ - deformedBondZ;
+
+        dot = hourglassVectorX*deformedBondX + hourglassVectorY*deformedBondY + hourglassVectorZ*deformedBondZ;
+        dot *= -1.0;
+
+        magnitude = constant * (dot/undeformedBondLength) * (1.0/deformedBondLength);
+        hourglassX = magnitude * deformedBondX;
+        hourglassY = magnitude * deformedBondY;
+        hourglassZ = magnitude * deformedBondZ;
+
+        neighborForceDensityPtr = forceDensity + 3*neighborIndex;
+        neighborHourglassForceDensityPtr = hourglassForceDensity + 3*neighborIndex;
+
+        *(forceDensityPtr)   += (TX + hourglassX) * neighborVol;
+        *(forceDensityPtr+1) += (TY + hourglassY) * neighborVol;
+        *(forceDensityPtr+2) += (TZ + hourglassZ) * neighborVol;
+        *(neighborForceDensityPtr)   -= (TX + hourglassX) * vol;
+        *(neighborForceDensityPtr+1) -= (TY + hourglassY) * vol;
+        *(neighborForceDensityPtr+2) -= (TZ + hourglassZ) * vol;
+
+        *(hourglassForceDensityPtr)   += hourglassX * neighborVol;
+        *(hourglassForceDensityPtr+1) += hourglassY * neighborVol;
+        *(hourglassForceDensityPtr+2) += hourglassZ * neighborVol;
+        *(neighborHourglassForceDensityPtr)   -= hourglassX * vol;
+        *(neighborHourglassForceDensityPtr+1) -= hourglassY * vol;
+        *(neighborHourglassForceDensityPtr+2) -= hourglassZ * vol;
+
+        if(partialStressPtr != 0){
+          *(partialStressPtr)   += TX*undeformedBondX*neighborVol;
+          *(partialStressPtr+1) += TX*undeformedBondY*neighborVol;
+          *(partialStressPtr+2) += TX*undeformedBondZ*neighborVol;
+          *(partialStressPtr+3) += TY*undeformedBondX*neighborVol;
+          *(partialStressPtr+4) += TY*undeformedBondY*neighborVol;
+          *(partialStressPtr+5) += TY*undeformedBondZ*neighborVol;
+          *(partialStressPtr+6) += TZ*undeformedBondX*neighborVol;
+          *(partialStressPtr+7) += TZ*undeformedBondY*neighborVol;
+          *(partialStressPtr+8) += TZ*undeformedBondZ*neighborVol;
+        }
+      }
     }
   }
+
+  return returnCode;
+}
+
+template<typename ScalarT>
+struct ComputeForceDensityAndHourglassForceDensity {
+  const double* volume;
+  const double* horizon;
+  const double* modelCoordinates;
+  const ScalarT* coordinates;
+  const ScalarT* deformationGradient;
+  const ScalarT* shapeTensorInverse;
+  const ScalarT* cauchyStress;
+  ScalarT* forceDensity;
+  ScalarT* hourglassForceDensity;
+  ScalarT* partialStress;
+  const int* neighborhoodList;
+  int numPoints;
+  double bulkModulus;
+  double hourglassCoefficient;
+  int returnCode;
+
+  template<typename InfluenceFunctionT>
+  void operator()(const InfluenceFunctionT influenceFunction)
+  {
+    returnCode = computeForceDensityAndHourglassForceDensityKernel(volume, horizon, modelCoordinates, coordinates, deformationGradient, shapeTensorInverse, cauchyStress, forceDensity, hourglassForceDensity, partialStress, neighborhoodList, numPoints, bulkModulus, hourglassCoefficient, influenceFunction);
+  }
+};
+
+template<typename ScalarT>
+int computeForceDensityAndHourglassForceDensity
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const ScalarT* coordinates,
+const ScalarT* deformationGradient,
+const ScalarT* shapeTensorInverse,
+const ScalarT* cauchyStress,
+ScalarT* forceDensity,
+ScalarT* hourglassForceDensity,
+ScalarT* partialStress,
+const int* neighborhoodList,
+int numPoints,
+double bulkModulus,
+double hourglassCoefficient,
+double (*influenceFunction)(double, double)
+)
+{
+  ComputeForceDensityAndHourglassForceDensity<ScalarT> kernel = {volume, horizon, modelCoordinates, coordinates, deformationGradient, shapeTensorInverse, cauchyStress, forceDensity, hourglassForceDensity, partialStress, neighborhoodList, numPoints, bulkModulus, hourglassCoefficient, 0};
+  PeridigmNS::InfluenceFunction::dispatch(influenceFunction, kernel);
+  return kernel.returnCode;
 }
 
 template<typename ScalarT>
@@ -764,18 +1276,22 @@ void rotateCauchyStress
  int numPoints
 )
 {
-  const ScalarT* rotTensor = rotationTensor;
-  const ScalarT* unrotatedStress = unrotatedCauchyStress;
-  ScalarT* rotatedStress = rotatedCauchyStress;
-  ScalarT temp[9];
+  const int B = TENSOR_BATCH_SIZE;
+  ScalarT rotTensor[9*B], unrotatedStress[9*B], rotatedStress[9*B], temp[9*B];
 
-  for(int iID=0 ; iID<numPoints ; ++iID, 
-        rotTensor+=9, unrotatedStress+=9, rotatedStress+=9){ 
+  for(int firstID=0 ; firstID<numPoints ; firstID+=B){
+
+      int numLanes = numPoints - firstID < B ? numPoints - firstID : B;
+
+      gatherTensorBatch(rotationTensor + 9*firstID, rotTensor, numLanes);
+      gatherTensorBatch(unrotatedCauchyStress + 9*firstID, unrotatedStress, numLanes);
 
       // temp = \sigma_unrot * Rt
-      CORRESPONDENCE::MatrixMultiply(false, true, 1.0, unrotatedStress, rotTensor, temp);
+      CORRESPONDENCE::MatrixMultiplyBatch<ScalarT>(false, true, 0, unrotatedStress, rotTensor, temp, numLanes);
       // \sigma_rot = R * temp
-      CORRESPONDENCE::MatrixMultiply(false, false, 1.0, rotTensor, temp, rotatedStress);
+      CORRESPONDENCE::MatrixMultiplyBatch<ScalarT>(false, false, 0, rotTensor, temp, rotatedStress, numLanes);
+
+      scatterTensorBatch(rotatedStress, rotatedCauchyStress + 9*firstID, numLanes);
   }
 }
 
@@ -2375,6 +2891,62 @@ template void rotateCauchyStress<double>
  int numPoints
  );
 
+template void gatherTensorBatch<double>
+(
+ const double* tensors,
+ double* batch,
+ int numLanes
+);
+
+template void scatterTensorBatch<double>
+(
+ const double* batch,
+ double* tensors,
+ int numLanes
+);
+
+template int Invert3by3MatrixBatch<double>
+(
+ const double* matrix,
+ double* determinant,
+ double* inverse,
+ int numLanes
+);
+
+template void MatrixMultiplyBatch<double>
+(
+ bool transA,
+ bool transB,
+ const double* alpha,
+ const double* a,
+ const double* b,
+ double* result,
+ int numLanes
+);
+
+template void updateLeftStretchRotationAndUnrotatedRateOfDeformation<double>
+(
+const double* eulerianVelGrad,
+const double* leftStretchN,
+const double* rotTensorN,
+double* leftStretchNP1,
+double* rotTensorNP1,
+double* unrotRateOfDef,
+double dt
+);
+
+template void updateLeftStretchRotationAndUnrotatedRateOfDeformationBatch<double>
+(
+const double* eulerianVelGrad,
+const double* leftStretchN,
+const double* rotTensorN,
+double* leftStretchNP1,
+double* rotTensorNP1,
+double* unrotRateOfDef,
+double dt,
+int numLanes
+);
+
 template int Invert3by3Matrix<double>
 (
  const double* matrix,
@@ -2394,24 +2966,6 @@ const int* neighborhoodList,
 int numPoints
 );
 
-template int computeUnrotatedRateOfDeformationAndRotationTensor<double>
-(
-const double* volume,
-const double* horizon,
-const double* modelCoordinates,
-const double* velocities,
-const double* deformationGradient,
-const double* shapeTensorInverse,
-const double* leftStretchTensorN,
-const double* rotationTensorN,
-double* leftStretchTensorNP1,
-double* rotationTensorNP1,
-double* unrotatedRateOfDeformation,
-const int* neighborhoodList,
-int numPoints,
-double dt
-);
-
 template void computeGreenLagrangeStrain<double>
 (
   const double* deformationGradientXX,
@@ -2435,18 +2989,42 @@ template void computeGreenLagrangeStrain<double>
   int numPoints
 );
 
-template void computeHourglassForce<double>
+template int computeShapeTensorInverseDeformationGradientAndUnrotatedRateOfDeformation<double>
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const double* coordinates,
+const double* velocities,
+double* shapeTensorInverse,
+double* deformationGradient,
+const double* leftStretchTensorN,
+const double* rotationTensorN,
+double* leftStretchTensorNP1,
+double* rotationTensorNP1,
+double* unrotatedRateOfDeformation,
+const int* neighborhoodList,
+int numPoints,
+double dt
+);
+
+template int computeForceDensityAndHourglassForceDensity<double>
 (
 const double* volume,
 const double* horizon,
 const double* modelCoordinates,
 const double* coordinates,
 const double* deformationGradient,
+const double* shapeTensorInverse,
+const double* cauchyStress,
+double* forceDensity,
 double* hourglassForceDensity,
+double* partialStress,
 const int* neighborhoodList,
 int numPoints,
 double bulkModulus,
-double hourglassCoefficient
+double hourglassCoefficient,
+double (*influenceFunction)(double, double)
 );
 
 template void setOnesOnDiagonalFullTensor<double>
@@ -2733,6 +3311,62 @@ template void MatrixMultiply<Sacado::Fad::DFad<double> >
  Sacado::Fad::DFad<double>* result
 );
 
+template void gatherTensorBatch<Sacado::Fad::DFad<double> >
+(
+ const Sacado::Fad::DFad<double>* tensors,
+ Sacado::Fad::DFad<double>* batch,
+ int numLanes
+);
+
+template void scatterTensorBatch<Sacado::Fad::DFad<double> >
+(
+ const Sacado::Fad::DFad<double>* batch,
+ Sacado::Fad::DFad<double>* tensors,
+ int numLanes
+);
+
+template int Invert3by3MatrixBatch<Sacado::Fad::DFad<double> >
+(
+ const Sacado::Fad::DFad<double>* matrix,
+ Sacado::Fad::DFad<double>* determinant,
+ Sacado::Fad::DFad<double>* inverse,
+ int numLanes
+);
+
+template void MatrixMultiplyBatch<Sacado::Fad::DFad<double> >
+(
+ bool transA,
+ bool transB,
+ const Sacado::Fad::DFad<double>* alpha,
+ const Sacado::Fad::DFad<double>* a,
+ const Sacado::Fad::DFad<double>* b,
+ Sacado::Fad::DFad<double>* result,
+ int numLanes
+);
+
+template void updateLeftStretchRotationAndUnrotatedRateOfDeformation<Sacado::Fad::DFad<double> >
+(
+const Sacado::Fad::DFad<double>* eulerianVelGrad,
+const Sacado::Fad::DFad<double>* leftStretchN,
+const Sacado::Fad::DFad<double>* rotTensorN,
+Sacado::Fad::DFad<double>* leftStretchNP1,
+Sacado::Fad::DFad<double>* rotTensorNP1,
+Sacado::Fad::DFad<double>* unrotRateOfDef,
+double dt
+);
+
+template void updateLeftStretchRotationAndUnrotatedRateOfDeformationBatch<Sacado::Fad::DFad<double> >
+(
+const Sacado::Fad::DFad<double>* eulerianVelGrad,
+const Sacado::Fad::DFad<double>* leftStretchN,
+const Sacado::Fad::DFad<double>* rotTensorN,
+Sacado::Fad::DFad<double>* leftStretchNP1,
+Sacado::Fad::DFad<double>* rotTensorNP1,
+Sacado::Fad::DFad<double>* unrotRateOfDef,
+double dt,
+int numLanes
+);
+
 template int Invert3by3Matrix<Sacado::Fad::DFad<double> >
 (
  const Sacado::Fad::DFad<double>* matrix,
@@ -2740,6 +3374,64 @@ template int Invert3by3Matrix<Sacado::Fad::DFad<double> >
  Sacado::Fad::DFad<double>* inverse
 );
 
+template void rotateCauchyStress<Sacado::Fad::DFad<double> >
+(
+ const Sacado::Fad::DFad<double>* rotationTensor,
+ const Sacado::Fad::DFad<double>* unrotatedCauchyStress,
+ Sacado::Fad::DFad<double>* rotatedCauchyStress,
+ int numPoints
+);
+
+template int computeShapeTensorInverseAndApproximateDeformationGradient<Sacado::Fad::DFad<double> >
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const Sacado::Fad::DFad<double>* coordinates,
+Sacado::Fad::DFad<double>* shapeTensorInverse,
+Sacado::Fad::DFad<double>* deformationGradient,
+const int* neighborhoodList,
+int numPoints
+);
+
+template int computeShapeTensorInverseDeformationGradientAndUnrotatedRateOfDeformation<Sacado::Fad::DFad<double> >
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const Sacado::Fad::DFad<double>* coordinates,
+const Sacado::Fad::DFad<double>* velocities,
+Sacado::Fad::DFad<double>* shapeTensorInverse,
+Sacado::Fad::DFad<double>* deformationGradient,
+const Sacado::Fad::DFad<double>* leftStretchTensorN,
+const Sacado::Fad::DFad<double>* rotationTensorN,
+Sacado::Fad::DFad<double>* leftStretchTensorNP1,
+Sacado::Fad::DFad<double>* rotationTensorNP1,
+Sacado::Fad::DFad<double>* unrotatedRateOfDeformation,
+const int* neighborhoodList,
+int numPoints,
+double dt
+);
+
+template int computeForceDensityAndHourglassForceDensity<Sacado::Fad::DFad<double> >
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const Sacado::Fad::DFad<double>* coordinates,
+const Sacado::Fad::DFad<double>* deformationGradient,
+const Sacado::Fad::DFad<double>* shapeTensorInverse,
+const Sacado::Fad::DFad<double>* cauchyStress,
+Sacado::Fad::DFad<double>* forceDensity,
+Sacado::Fad::DFad<double>* hourglassForceDensity,
+Sacado::Fad::DFad<double>* partialStress,
+const int* neighborhoodList,
+int numPoints,
+double bulkModulus,
+double hourglassCoefficient,
+double (*influenceFunction)(double, double)
+);
+
 template void computeGreenLagrangeStrain<Sacado::Fad::DFad<double> >
 (
   const Sacado::Fad::DFad<double>* deformationGradientXX,
@@ -50,6 +50,10 @@
 
 namespace CORRESPONDENCE {
 
+//! Number of material points processed together by the batched tensor kernels.
+//! Batched tensors are stored in structure-of-arrays form: component k of lane l is at index k*TENSOR_BATCH_SIZE+l.
+const int TENSOR_BATCH_SIZE = 8;
+
 //! Invert a single 3-by-3 matrix; returns zero of successful, one if not successful (e.g., singular matrix).
 template<typename ScalarT>
 int Invert3by3Matrix
@@ -79,6 +83,74 @@ void MatrixMultiply
  ScalarT* result
 );
 
+//! Copy numLanes consecutive 3-by-3 tensors into a structure-of-arrays batch.
+template<typename ScalarT>
+void gatherTensorBatch
+(
+ const ScalarT* tensors,
+ ScalarT* batch,
+ int numLanes
+);
+
+//! Copy a structure-of-arrays batch back into numLanes consecutive 3-by-3 tensors.
+template<typename ScalarT>
+void scatterTensorBatch
+(
+ const ScalarT* batch,
+ ScalarT* tensors,
+ int numLanes
+);
+
+//! Batched Invert3by3Matrix(); returns one if any matrix in the batch is singular.
+template<typename ScalarT>
+int Invert3by3MatrixBatch
+(
+ const ScalarT* matrix,
+ ScalarT* determinant,
+ ScalarT* inverse,
+ int numLanes
+);
+
+//! Batched MatrixMultiply() with a per-lane alpha; a NULL alpha is treated as one.
+template<typename ScalarT>
+void MatrixMultiplyBatch
+(
+ bool transA,
+ bool transB,
+ const ScalarT* alpha,
+ const ScalarT* a,
+ const ScalarT* b,
+ ScalarT* result,
+ int numLanes
+);
+
+//! Point-local Flanagan & Taylor update of the left stretch and rotation tensors given the Eulerian velocity gradient; returns the unrotated rate-of-deformation.
+template<typename ScalarT>
+void updateLeftStretchRotationAndUnrotatedRateOfDeformation
+(
+ const ScalarT* eulerianVelGrad,
+ const ScalarT* leftStretchN,
+ const ScalarT* rotTensorN,
+ ScalarT* leftStretchNP1,
+ ScalarT* rotTensorNP1,
+ ScalarT* unrotRateOfDef,
+ double dt
+);
+
+//! Batched updateLeftStretchRotationAndUnrotatedRateOfDeformation().
+template<typename ScalarT>
+void updateLeftStretchRotationAndUnrotatedRateOfDeformationBatch
+(
+ const ScalarT* eulerianVelGrad,
+ const ScalarT* leftStretchN,
+ const ScalarT* rotTensorN,
+ ScalarT* leftStretchNP1,
+ ScalarT* rotTensorNP1,
+ ScalarT* unrotRateOfDef,
+ double dt,
+ int numLanes
+);
+
 template<typename ScalarT>
 void rotateCauchyStress
 (
@@ -101,15 +173,17 @@ const int* neighborhoodList,
 int numPoints
 );
 
-// Calculation of stretch rates following Flanagan & Taylor
+//! Shape tensor, deformation gradient, and Flanagan & Taylor stretch rates in a single neighbor sweep.
 template<typename ScalarT>
-int computeUnrotatedRateOfDeformationAndRotationTensor(
+int computeShapeTensorInverseDeformationGradientAndUnrotatedRateOfDeformation
+(
 const double* volume,
 const double* horizon,
 const double* modelCoordinates,
+const ScalarT* coordinates,
 const ScalarT* velocities,
-const ScalarT* deformationGradient,
-const ScalarT* shapeTensorInverse,
+ScalarT* shapeTensorInverse,
+ScalarT* deformationGradient,
 const ScalarT* leftStretchTensorN,
 const ScalarT* rotationTensorN,
 ScalarT* leftStretchTensorNP1,
@@ -145,19 +219,25 @@ void computeGreenLagrangeStrain
   int numPoints
 );
 
+//! Pairwise force densities and hourglass force densities in a single neighbor sweep.
 template<typename ScalarT>
-void computeHourglassForce
+int computeForceDensityAndHourglassForceDensity
 (
 const double* volume,
 const double* horizon,
 const double* modelCoordinates,
 const ScalarT* coordinates,
 const ScalarT* deformationGradient,
+const ScalarT* shapeTensorInverse,
+const ScalarT* cauchyStress,
+ScalarT* forceDensity,
 ScalarT* hourglassForceDensity,
+ScalarT* partialStress,
 const int* neighborhoodList,
 int numPoints,
 double bulkModulus,
-double hourglassCoefficient
+double hourglassCoefficient,
+double (*influenceFunction)(double, double)
 );
 
 template<typename ScalarT>
@@ -49,11 +49,12 @@
 #include <Sacado.hpp>
 #include "elastic.h"
 #include "material_utilities.h"
+#include "Peridigm_ThreadForceBuffers.hpp"
 
 namespace MATERIAL_EVALUATION {
 
-template<typename ScalarT>
-void computeInternalForceLinearElastic
+template<typename ScalarT, typename InfluenceFunctionT>
+void computeInternalForceLinearElasticKernel
 (
 		const double* xOverlap,
 		const ScalarT* yOverlap,
@@ -64,12 +65,15 @@ void computeInternalForceLinearElastic
 		ScalarT* fInternalOverlap,
 		ScalarT* partialStressOverlap,
 		const int*  localNeighborList,
-		int numOwnedPoints,
+		int firstPoint,
+		int numPoints,
 		double BULK_MODULUS,
 		double SHEAR_MODULUS,
         double horizon,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        const ScalarT* bondGeometry,
+        const InfluenceFunctionT OMEGA
 )
 {
 
@@ -79,19 +83,19 @@ void computeInternalForceLinearElastic
 	double K = BULK_MODULUS;
 	double MU = SHEAR_MODULUS;
 
-	const double *xOwned = xOverlap;
-	const ScalarT *yOwned = yOverlap;
-    const double *deltaT = deltaTemperature;
-	const double *m = mOwned;
+	const double *xOwned = xOverlap + 3*firstPoint;
+	const ScalarT *yOwned = yOverlap + 3*firstPoint;
+    const double *deltaT = deltaTemperature ? deltaTemperature + firstPoint : 0;
+	const double *m = mOwned + firstPoint;
 	const double *v = volumeOverlap;
-	const ScalarT *theta = dilatationOwned;
-	ScalarT *fOwned = fInternalOverlap;
-	ScalarT *psOwned = partialStressOverlap;
+	const ScalarT *theta = dilatationOwned + firstPoint;
+	ScalarT *fOwned = fInternalOverlap + 3*firstPoint;
+	ScalarT *psOwned = partialStressOverlap ? partialStressOverlap + 9*firstPoint : 0;
 
 	const int *neighPtr = localNeighborList;
 	double cellVolume, alpha, X_dx, X_dy, X_dz, zeta, omega;
 	ScalarT Y_dx, Y_dy, Y_dz, dY, t, fx, fy, fz, e, c1;
-	for(int p=0;p<numOwnedPoints;p++, xOwned +=3, yOwned +=3, fOwned+=3, psOwned+=9, deltaT++, m++, theta++){
+	for(int p=firstPoint;p<firstPoint+numPoints;p++, xOwned +=3, yOwned +=3, fOwned+=3, psOwned+=9, deltaT++, m++, theta++){
 
 		int numNeigh = *neighPtr; neighPtr++;
 		const double *X = xOwned;
@@ -102,19 +106,29 @@ void computeInternalForceLinearElastic
 			int localId = *neighPtr;
 			cellVolume = v[localId];
 			const double *XP = &xOverlap[3*localId];
-			const ScalarT *YP = &yOverlap[3*localId];
 			X_dx = XP[0]-X[0];
 			X_dy = XP[1]-X[1];
 			X_dz = XP[2]-X[2];
-			zeta = sqrt(X_dx*X_dx+X_dy*X_dy+X_dz*X_dz);
-			Y_dx = YP[0]-Y[0];
-			Y_dy = YP[1]-Y[1];
-			Y_dz = YP[2]-Y[2];
-			dY = sqrt(Y_dx*Y_dx+Y_dy*Y_dy+Y_dz*Y_dz);
+			if(bondGeometry){
+				zeta = Sacado::ScalarValue<ScalarT>::eval(bondGeometry[0]);
+				Y_dx = bondGeometry[1];
+				Y_dy = bondGeometry[2];
+				Y_dz = bondGeometry[3];
+				dY = bondGeometry[4];
+				bondGeometry += BOND_GEOMETRY_SIZE;
+			}
+			else{
+				const ScalarT *YP = &yOverlap[3*localId];
+				zeta = sqrt(X_dx*X_dx+X_dy*X_dy+X_dz*X_dz);
+				Y_dx = YP[0]-Y[0];
+				Y_dy = YP[1]-Y[1];
+				Y_dz = YP[2]-Y[2];
+				dY = sqrt(Y_dx*Y_dx+Y_dy*Y_dy+Y_dz*Y_dz);
+			}
             e = dY - zeta;
             if(deltaTemperature)
               e -= thermalExpansionCoefficient*(*deltaT)*zeta;
-			omega = scalarInfluenceFunction(zeta,horizon);
+			omega = OMEGA(zeta,horizon);
 			// c1 = omega*(*theta)*(9.0*K-15.0*MU)/(3.0*(*m));
 			c1 = omega*(*theta)*(3.0*K/(*m)-alpha/3.0);
 			t = (1.0-*bondDamage)*(c1 * zeta + (1.0-*bondDamage) * omega * alpha * e);
@@ -145,6 +159,100 @@ void computeInternalForceLinearElastic
 	}
 }
 
+template<typename ScalarT>
+struct ComputeInternalForceLinearElastic {
+	const double* xOverlap;
+	const ScalarT* yOverlap;
+	const double* mOwned;
+	const double* volumeOverlap;
+	const ScalarT* dilatationOwned;
+	const double* bondDamage;
+	ScalarT* fInternalOverlap;
+	ScalarT* partialStressOverlap;
+	const int*  localNeighborList;
+	int firstPoint;
+	int numPoints;
+	double BULK_MODULUS;
+	double SHEAR_MODULUS;
+	double horizon;
+	double thermalExpansionCoefficient;
+	const double* deltaTemperature;
+	const ScalarT* bondGeometry;
+
+	template<typename InfluenceFunctionT>
+	void operator()(const InfluenceFunctionT OMEGA) const {
+		computeInternalForceLinearElasticKernel(xOverlap,yOverlap,mOwned,volumeOverlap,dilatationOwned,bondDamage,fInternalOverlap,partialStressOverlap,localNeighborList,firstPoint,numPoints,BULK_MODULUS,SHEAR_MODULUS,horizon,thermalExpansionCoefficient,deltaTemperature,bondGeometry,OMEGA);
+	}
+};
+
+template<typename ScalarT>
+void computeInternalForceLinearElasticRange
+(
+		const double* xOverlap,
+		const ScalarT* yOverlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const ScalarT* dilatationOwned,
+		const double* bondDamage,
+		ScalarT* fInternalOverlap,
+		ScalarT* partialStressOverlap,
+		const int*  localNeighborList,
+		int firstPoint,
+		int numPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const ScalarT* bondGeometry
+)
+{
+	ComputeInternalForceLinearElastic<ScalarT> kernel = {xOverlap,yOverlap,mOwned,volumeOverlap,dilatationOwned,bondDamage,fInternalOverlap,partialStressOverlap,localNeighborList,firstPoint,numPoints,BULK_MODULUS,SHEAR_MODULUS,horizon,thermalExpansionCoefficient,deltaTemperature,bondGeometry};
+	PeridigmNS::InfluenceFunction::dispatch(PeridigmNS::InfluenceFunction::self().getInfluenceFunction(), kernel);
+}
+
+template<typename ScalarT>
+void computeInternalForceLinearElastic
+(
+		const double* xOverlap,
+		const ScalarT* yOverlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const ScalarT* dilatationOwned,
+		const double* bondDamage,
+		ScalarT* fInternalOverlap,
+		ScalarT* partialStressOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const ScalarT* bondGeometry,
+        PeridigmNS::ThreadForceBuffers<ScalarT>* threadForceBuffers
+)
+{
+#ifdef PERIDIGM_OPENMP
+	// Each thread evaluates a contiguous range of owned points and scatters the reaction forces into its own
+	// overlap buffer; the buffers are summed into the force vector once all threads are done
+	if(threadForceBuffers != 0 && threadForceBuffers->NumThreads() > 1){
+		#pragma omp parallel num_threads(threadForceBuffers->NumThreads())
+		{
+			int thread = omp_get_thread_num();
+			int bondOffset = threadForceBuffers->BondOffset(thread);
+			computeInternalForceLinearElasticRange(xOverlap,yOverlap,mOwned,volumeOverlap,dilatationOwned,bondDamage+bondOffset,threadForceBuffers->ClearedBuffer(thread),partialStressOverlap,
+			                                       localNeighborList+threadForceBuffers->NeighborhoodListOffset(thread),threadForceBuffers->FirstPoint(thread),threadForceBuffers->NumPoints(thread),
+			                                       BULK_MODULUS,SHEAR_MODULUS,horizon,thermalExpansionCoefficient,deltaTemperature,
+			                                       bondGeometry ? bondGeometry+BOND_GEOMETRY_SIZE*bondOffset : 0);
+		}
+		threadForceBuffers->ReduceInto(fInternalOverlap);
+		return;
+	}
+#endif
+	computeInternalForceLinearElasticRange(xOverlap,yOverlap,mOwned,volumeOverlap,dilatationOwned,bondDamage,fInternalOverlap,partialStressOverlap,localNeighborList,0,numOwnedPoints,BULK_MODULUS,SHEAR_MODULUS,horizon,thermalExpansionCoefficient,deltaTemperature,bondGeometry);
+}
+
 /** Explicit template instantiation for double. */
 template void computeInternalForceLinearElastic<double>
 (
@@ -162,7 +270,9 @@ template void computeInternalForceLinearElastic<double>
 		double SHEAR_MODULUS,
         double horizon,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        const double* bondGeometry,
+        PeridigmNS::ThreadForceBuffers<double>* threadForceBuffers
  );
 
 /** Explicit template instantiation for Sacado::Fad::DFad<double>. */
@@ -182,7 +292,97 @@ template void computeInternalForceLinearElastic<Sacado::Fad::DFad<double> >
 		double SHEAR_MODULUS,
         double horizon,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        const Sacado::Fad::DFad<double>* bondGeometry,
+        PeridigmNS::ThreadForceBuffers<Sacado::Fad::DFad<double> >* threadForceBuffers
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,64>. */
+template void computeInternalForceLinearElastic<Sacado::Fad::SLFad<double,64> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,64>* yOverlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,64>* dilatationOwned,
+		const double* bondDamage,
+		Sacado::Fad::SLFad<double,64>* fInternalOverlap,
+		Sacado::Fad::SLFad<double,64>* partialStressOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const Sacado::Fad::SLFad<double,64>* bondGeometry,
+        PeridigmNS::ThreadForceBuffers<Sacado::Fad::SLFad<double,64> >* threadForceBuffers
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,128>. */
+template void computeInternalForceLinearElastic<Sacado::Fad::SLFad<double,128> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,128>* yOverlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,128>* dilatationOwned,
+		const double* bondDamage,
+		Sacado::Fad::SLFad<double,128>* fInternalOverlap,
+		Sacado::Fad::SLFad<double,128>* partialStressOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const Sacado::Fad::SLFad<double,128>* bondGeometry,
+        PeridigmNS::ThreadForceBuffers<Sacado::Fad::SLFad<double,128> >* threadForceBuffers
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,256>. */
+template void computeInternalForceLinearElastic<Sacado::Fad::SLFad<double,256> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,256>* yOverlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,256>* dilatationOwned,
+		const double* bondDamage,
+		Sacado::Fad::SLFad<double,256>* fInternalOverlap,
+		Sacado::Fad::SLFad<double,256>* partialStressOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const Sacado::Fad::SLFad<double,256>* bondGeometry,
+        PeridigmNS::ThreadForceBuffers<Sacado::Fad::SLFad<double,256> >* threadForceBuffers
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,512>. */
+template void computeInternalForceLinearElastic<Sacado::Fad::SLFad<double,512> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,512>* yOverlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,512>* dilatationOwned,
+		const double* bondDamage,
+		Sacado::Fad::SLFad<double,512>* fInternalOverlap,
+		Sacado::Fad::SLFad<double,512>* partialStressOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const Sacado::Fad::SLFad<double,512>* bondGeometry,
+        PeridigmNS::ThreadForceBuffers<Sacado::Fad::SLFad<double,512> >* threadForceBuffers
 );
 
 }
@@ -47,9 +47,15 @@
 #ifndef ELASTIC_H
 #define ELASTIC_H
 
+namespace PeridigmNS {
+  template<typename ScalarT> class ThreadForceBuffers;
+}
+
 namespace MATERIAL_EVALUATION {
 
 //! Computes contributions to the internal force resulting from owned points.
+//! If bondGeometry is not NULL, the bond geometry cached by computeDilatation() is used in place of the coordinates.
+//! If threadForceBuffers is not NULL and has been set up for more than one thread, the owned points are evaluated in parallel.
 template<typename ScalarT>
 void computeInternalForceLinearElastic
 (
@@ -67,8 +73,9 @@ void computeInternalForceLinearElastic
 		double SHEAR_MODULUS,
         double horizon,
         double thermalExpansionCoefficient = 0,
-        const double* deltaTemperature = 0
-
+        const double* deltaTemperature = 0,
+        const ScalarT* bondGeometry = 0,
+        PeridigmNS::ThreadForceBuffers<ScalarT>* threadForceBuffers = 0
 );
 
 }
@@ -49,22 +49,42 @@
 #include <Sacado.hpp>
 #include "elastic_bond_based.h"
 #include "material_utilities.h"
+#include "Peridigm_BitPackedBondData.hpp"
 
 namespace MATERIAL_EVALUATION {
 
-template<typename ScalarT>
+template<typename ScalarT, typename DamageT>
 void computeInternalForceElasticBondBased
 (
 		const double* xOverlap,
 		const ScalarT* yOverlap,
 		const double* volumeOverlap,
-		const double* bondDamage,
+		DamageT bondDamage,
 		ScalarT* fInternalOverlap,
 		const int* localNeighborList,
 		int numOwnedPoints,
 		double BULK_MODULUS,
         double horizon
 )
+{
+  computeInternalForceElasticBondBasedOnPoints(xOverlap, yOverlap, volumeOverlap, bondDamage, fInternalOverlap,
+                                               localNeighborList, 0, numOwnedPoints, BULK_MODULUS, horizon);
+}
+
+template<typename ScalarT, typename DamageT>
+void computeInternalForceElasticBondBasedOnPoints
+(
+		const double* xOverlap,
+		const ScalarT* yOverlap,
+		const double* volumeOverlap,
+		DamageT bondDamage,
+		ScalarT* fInternalOverlap,
+		const int* localNeighborList,
+		int firstPoint,
+		int lastPoint,
+		double BULK_MODULUS,
+        double horizon
+)
 {
   double volume, neighborVolume, X[3], neighborX[3], initialBondLength, damageOnBond;
   ScalarT Y[3], neighborY[3], currentBondLength, stretch, t, fx, fy, fz;
@@ -73,7 +93,14 @@ void computeInternalForceElasticBondBased
   const double pi = PeridigmNS::value_of_pi();
   double constant = 18.0*BULK_MODULUS/(pi*horizon*horizon*horizon*horizon);
 
-  for(int p=0 ; p<numOwnedPoints ; p++){
+  // Advance to the neighborhood list and bond data of the first point in the range
+  for(int p=0 ; p<firstPoint ; p++){
+    int numNeighbors = localNeighborList[neighborhoodIndex];
+    neighborhoodIndex += 1 + numNeighbors;
+    bondDamageIndex += numNeighbors;
+  }
+
+  for(int p=firstPoint ; p<lastPoint ; p++){
 
     X[0] = xOverlap[p*3];
     X[1] = xOverlap[p*3+1];
@@ -118,7 +145,7 @@ void computeInternalForceElasticBondBased
 }
 
 /** Explicit template instantiation for double. */
-template void computeInternalForceElasticBondBased<double>
+template void computeInternalForceElasticBondBased<double, const double*>
 (
 		const double* xOverlap,
 		const double* yOverlap,
@@ -132,7 +159,7 @@ template void computeInternalForceElasticBondBased<double>
  );
 
 /** Explicit template instantiation for Sacado::Fad::DFad<double>. */
-template void computeInternalForceElasticBondBased<Sacado::Fad::DFad<double> >
+template void computeInternalForceElasticBondBased<Sacado::Fad::DFad<double>, const double*>
 (
 		const double* xOverlap,
 		const Sacado::Fad::DFad<double>* yOverlap,
@@ -145,4 +172,92 @@ template void computeInternalForceElasticBondBased<Sacado::Fad::DFad<double> >
         double horizon
 );
 
+/** Explicit template instantiation for double. */
+template void computeInternalForceElasticBondBasedOnPoints<double, const double*>
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int firstPoint,
+		int lastPoint,
+		double BULK_MODULUS,
+        double horizon
+ );
+
+/** Explicit template instantiation for Sacado::Fad::DFad<double>. */
+template void computeInternalForceElasticBondBasedOnPoints<Sacado::Fad::DFad<double>, const double*>
+(
+		const double* xOverlap,
+		const Sacado::Fad::DFad<double>* yOverlap,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		Sacado::Fad::DFad<double>* fInternalOverlap,
+		const int*  localNeighborList,
+		int firstPoint,
+		int lastPoint,
+		double BULK_MODULUS,
+        double horizon
+);
+
+/** Explicit template instantiation for double with single-precision bond damage. */
+template void computeInternalForceElasticBondBased<double, const float*>
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double* volumeOverlap,
+		const float* bondDamage,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+        double horizon
+ );
+
+/** Explicit template instantiation for double with single-precision bond damage. */
+template void computeInternalForceElasticBondBasedOnPoints<double, const float*>
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double* volumeOverlap,
+		const float* bondDamage,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int firstPoint,
+		int lastPoint,
+		double BULK_MODULUS,
+        double horizon
+ );
+
+/** Explicit template instantiation for double with bit-packed bond damage. */
+template void computeInternalForceElasticBondBased<double, PeridigmNS::BitPackedBondView>
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double* volumeOverlap,
+		PeridigmNS::BitPackedBondView bondDamage,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+        double horizon
+ );
+
+/** Explicit template instantiation for double with bit-packed bond damage. */
+template void computeInternalForceElasticBondBasedOnPoints<double, PeridigmNS::BitPackedBondView>
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double* volumeOverlap,
+		PeridigmNS::BitPackedBondView bondDamage,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int firstPoint,
+		int lastPoint,
+		double BULK_MODULUS,
+        double horizon
+ );
+
 }
@@ -49,14 +49,14 @@
 
 namespace MATERIAL_EVALUATION {
 
-//! Computes contributions to the internal force resulting from owned points.
-template<typename ScalarT>
+//! Computes contributions to the internal force resulting from owned points; DamageT is any type indexable by bond (double or float array, or a bit-packed view).
+template<typename ScalarT, typename DamageT>
 void computeInternalForceElasticBondBased
 (
 		const double* xOverlapPtr,
 		const ScalarT* yOverlapPtr,
 		const double* volumeOverlapPtr,
-		const double* bondDamage,
+		DamageT bondDamage,
 		ScalarT* fInternalOverlapPtr,
 		const int* localNeighborList,
 		int numOwnedPoints,
@@ -64,6 +64,22 @@ void computeInternalForceElasticBondBased
         double horizon
 );
 
+//! Computes contributions to the internal force resulting from owned points firstPoint through lastPoint-1.
+template<typename ScalarT, typename DamageT>
+void computeInternalForceElasticBondBasedOnPoints
+(
+		const double* xOverlapPtr,
+		const ScalarT* yOverlapPtr,
+		const double* volumeOverlapPtr,
+		DamageT bondDamage,
+		ScalarT* fInternalOverlapPtr,
+		const int* localNeighborList,
+		int firstPoint,
+		int lastPoint,
+		double BULK_MODULUS,
+        double horizon
+);
+
 }
 
 #endif // ELASTIC_BOND_BASED_H
@@ -99,8 +99,8 @@ const double dt
 
       //thermal strains
       if (deltaTemperatureN && deltaTemperatureNP1) {
-        double thermalStrainN = alpha*deltaTemperatureN[iID];
-        double thermalStrainNP1 = alpha*deltaTemperatureNP1[iID];
+        ScalarT thermalStrainN = alpha*deltaTemperatureN[iID];
+        ScalarT thermalStrainNP1 = alpha*deltaTemperatureNP1[iID];
         dilatationInc -= 3.0*(thermalStrainNP1 - thermalStrainN);
       }
 
@@ -715,5 +715,18 @@ const double dt
 );
 
 /** Explicit template instantiation for Sacado::Fad::DFad<double>. */
+template void updateElasticCauchyStress<Sacado::Fad::DFad<double> >
+(
+const Sacado::Fad::DFad<double>* deltaTemperatureN,
+const Sacado::Fad::DFad<double>* deltaTemperatureNP1,
+const Sacado::Fad::DFad<double>* unrotatedRateOfDeformation,
+const Sacado::Fad::DFad<double>* unrotatedCauchyStressN,
+Sacado::Fad::DFad<double>* unrotatedCauchyStressNP1,
+int numPoints,
+double bulkMod,
+double shearMod,
+double alpha,
+double dt
+);
 
 }
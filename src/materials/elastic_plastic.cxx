@@ -47,7 +47,9 @@
 #include <cmath>
 #include <Sacado.hpp>
 #include "elastic_plastic.h"
+#include "material_utilities.h"
 #include "Peridigm_Constants.hpp"
+#include "Peridigm_ThreadForceBuffers.hpp"
 
 namespace MATERIAL_EVALUATION {
 
@@ -65,7 +67,8 @@ ScalarT computeDeviatoricForceStateNorm
 		const ScalarT *yOverlap,
 		const double *volumeOverlap,
 		double alpha,
-		double OMEGA
+		double OMEGA,
+		const ScalarT *bondGeometry
 )
 {
 	ScalarT norm=0.0;
@@ -76,16 +79,23 @@ ScalarT computeDeviatoricForceStateNorm
 	for(int n=0;n<numNeigh;n++, neighPtr++, bondDamage++, deviatoricPlasticExtensionState++){
 		int localId = *neighPtr;
 		cellVolume = v[localId];
-		const double *XP = &xOverlap[3*localId];
-		const ScalarT *YP = &yOverlap[3*localId];
-		dx_X = XP[0]-X[0];
-		dy_X = XP[1]-X[1];
-		dz_X = XP[2]-X[2];
-		zeta = sqrt(dx_X*dx_X+dy_X*dy_X+dz_X*dz_X);
-		dx_Y = YP[0]-Y[0];
-		dy_Y = YP[1]-Y[1];
-		dz_Y = YP[2]-Y[2];
-		dY = sqrt(dx_Y*dx_Y+dy_Y*dy_Y+dz_Y*dz_Y);
+		if(bondGeometry){
+			zeta = Sacado::ScalarValue<ScalarT>::eval(bondGeometry[0]);
+			dY = bondGeometry[4];
+			bondGeometry += BOND_GEOMETRY_SIZE;
+		}
+		else{
+			const double *XP = &xOverlap[3*localId];
+			const ScalarT *YP = &yOverlap[3*localId];
+			dx_X = XP[0]-X[0];
+			dy_X = XP[1]-X[1];
+			dz_X = XP[2]-X[2];
+			zeta = sqrt(dx_X*dx_X+dy_X*dy_X+dz_X*dz_X);
+			dx_Y = YP[0]-Y[0];
+			dy_Y = YP[1]-Y[1];
+			dz_Y = YP[2]-Y[2];
+			dY = sqrt(dx_Y*dx_Y+dy_Y*dy_Y+dz_Y*dz_Y);
+		}
 
 		/*
 		 * Deviatoric extension state
@@ -114,7 +124,7 @@ ScalarT computeDeviatoricForceStateNorm
 }
 
 template<typename ScalarT>
-void computeInternalForceIsotropicElasticPlastic
+void computeInternalForceIsotropicElasticPlasticRange
 (
 		const double* xOverlap,
 		const ScalarT* yNP1Overlap,
@@ -128,13 +138,15 @@ void computeInternalForceIsotropicElasticPlastic
 		ScalarT* lambdaNP1,
 		ScalarT* fInternalOverlap,
 		const int*  localNeighborList,
-		int numOwnedPoints,
+		int firstPoint,
+		int numPoints,
 		double BULK_MODULUS,
 		double SHEAR_MODULUS,
 		double HORIZON,
 		double yieldStress,
 		bool isPlanarProblem,
-		double thickness
+		double thickness,
+		const ScalarT* bondGeometry
 )
 {
 	/*
@@ -152,17 +164,19 @@ void computeInternalForceIsotropicElasticPlastic
 	if(isPlanarProblem)
     	yieldValue = 225.0 / 3. * yieldStress * yieldStress / 8 / PeridigmNS::value_of_pi() / THICKNESS / pow(DELTA,4);
 
-	const double *xOwned = xOverlap;
-	const ScalarT *yOwned = yNP1Overlap;
-	const double *m = mOwned;
+	const double *xOwned = xOverlap + 3*firstPoint;
+	const ScalarT *yOwned = yNP1Overlap + 3*firstPoint;
+	const double *m = mOwned + firstPoint;
 	const double *v = volumeOverlap;
-	const ScalarT *theta = dilatationOwned;
-	ScalarT *fOwned = fInternalOverlap;
+	const ScalarT *theta = dilatationOwned + firstPoint;
+	ScalarT *fOwned = fInternalOverlap + 3*firstPoint;
+	lambdaN += firstPoint;
+	lambdaNP1 += firstPoint;
 
 	const int *neighPtr = localNeighborList;
 	double cellVolume, alpha, dx_X, dy_X, dz_X, zeta, edpN;
     ScalarT dx_Y, dy_Y, dz_Y, dY, ed, tdTrial, t, ti, td;
-	for(int p=0;p<numOwnedPoints;p++, xOwned +=3, yOwned +=3, fOwned+=3, m++, theta++, lambdaN++, lambdaNP1++){
+	for(int p=firstPoint;p<firstPoint+numPoints;p++, xOwned +=3, yOwned +=3, fOwned+=3, m++, theta++, lambdaN++, lambdaNP1++){
 
 		int numNeigh = *neighPtr; neighPtr++;
 		const double *X = xOwned;
@@ -177,7 +191,7 @@ void computeInternalForceIsotropicElasticPlastic
 		 * Compute norm of trial stress
 		 */
 		ScalarT tdNorm = 0.0;
-		tdNorm = computeDeviatoricForceStateNorm(numNeigh,*theta,neighPtr,bondDamage,deviatoricPlasticExtensionStateN,X,Y,xOverlap,yNP1Overlap,v,alpha,OMEGA);
+		tdNorm = computeDeviatoricForceStateNorm(numNeigh,*theta,neighPtr,bondDamage,deviatoricPlasticExtensionStateN,X,Y,xOverlap,yNP1Overlap,v,alpha,OMEGA,bondGeometry);
 
 		/*
 		 * Evaluate yield function
@@ -201,16 +215,26 @@ void computeInternalForceIsotropicElasticPlastic
 		for(int n=0;n<numNeigh;n++,neighPtr++,bondDamage++, deviatoricPlasticExtensionStateN++, deviatoricPlasticExtensionStateNp1++){
 			int localId = *neighPtr;
 			cellVolume = v[localId];
-			const double *XP = &xOverlap[3*localId];
-			const ScalarT *YP = &yNP1Overlap[3*localId];
-			dx_X = XP[0]-X[0];
-			dy_X = XP[1]-X[1];
-			dz_X = XP[2]-X[2];
-			zeta = sqrt(dx_X*dx_X+dy_X*dy_X+dz_X*dz_X);
-			dx_Y = YP[0]-Y[0];
-			dy_Y = YP[1]-Y[1];
-			dz_Y = YP[2]-Y[2];
-			dY = sqrt(dx_Y*dx_Y+dy_Y*dy_Y+dz_Y*dz_Y);
+			if(bondGeometry){
+				zeta = Sacado::ScalarValue<ScalarT>::eval(bondGeometry[0]);
+				dx_Y = bondGeometry[1];
+				dy_Y = bondGeometry[2];
+				dz_Y = bondGeometry[3];
+				dY = bondGeometry[4];
+				bondGeometry += BOND_GEOMETRY_SIZE;
+			}
+			else{
+				const double *XP = &xOverlap[3*localId];
+				const ScalarT *YP = &yNP1Overlap[3*localId];
+				dx_X = XP[0]-X[0];
+				dy_X = XP[1]-X[1];
+				dz_X = XP[2]-X[2];
+				zeta = sqrt(dx_X*dx_X+dy_X*dy_X+dz_X*dz_X);
+				dx_Y = YP[0]-Y[0];
+				dy_Y = YP[1]-Y[1];
+				dz_Y = YP[2]-Y[2];
+				dY = sqrt(dx_Y*dx_Y+dy_Y*dy_Y+dz_Y*dz_Y);
+			}
 			/*
 			 * Deviatoric extension state
 			 */
@@ -279,6 +303,57 @@ void computeInternalForceIsotropicElasticPlastic
 	}
 }
 
+template<typename ScalarT>
+void computeInternalForceIsotropicElasticPlastic
+(
+		const double* xOverlap,
+		const ScalarT* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const ScalarT* dilatationOwned,
+		const double* bondDamage,
+		const double* deviatoricPlasticExtensionStateN,
+		ScalarT* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		ScalarT* lambdaNP1,
+		ScalarT* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		bool isPlanarProblem,
+		double thickness,
+		const ScalarT* bondGeometry,
+		PeridigmNS::ThreadForceBuffers<ScalarT>* threadForceBuffers
+)
+{
+#ifdef PERIDIGM_OPENMP
+	// Each thread evaluates a contiguous range of owned points; the plastic state updates are per point and per bond, so
+	// only the reaction forces need thread-private buffers
+	if(threadForceBuffers != 0 && threadForceBuffers->NumThreads() > 1){
+		#pragma omp parallel num_threads(threadForceBuffers->NumThreads())
+		{
+			int thread = omp_get_thread_num();
+			int bondOffset = threadForceBuffers->BondOffset(thread);
+			computeInternalForceIsotropicElasticPlasticRange(xOverlap,yNP1Overlap,mOwned,volumeOverlap,dilatationOwned,bondDamage+bondOffset,
+			                                                 deviatoricPlasticExtensionStateN+bondOffset,deviatoricPlasticExtensionStateNp1+bondOffset,
+			                                                 lambdaN,lambdaNP1,threadForceBuffers->ClearedBuffer(thread),
+			                                                 localNeighborList+threadForceBuffers->NeighborhoodListOffset(thread),
+			                                                 threadForceBuffers->FirstPoint(thread),threadForceBuffers->NumPoints(thread),
+			                                                 BULK_MODULUS,SHEAR_MODULUS,HORIZON,yieldStress,isPlanarProblem,thickness,
+			                                                 bondGeometry ? bondGeometry+BOND_GEOMETRY_SIZE*bondOffset : 0);
+		}
+		threadForceBuffers->ReduceInto(fInternalOverlap);
+		return;
+	}
+#endif
+	computeInternalForceIsotropicElasticPlasticRange(xOverlap,yNP1Overlap,mOwned,volumeOverlap,dilatationOwned,bondDamage,deviatoricPlasticExtensionStateN,deviatoricPlasticExtensionStateNp1,
+	                                                 lambdaN,lambdaNP1,fInternalOverlap,localNeighborList,0,numOwnedPoints,
+	                                                 BULK_MODULUS,SHEAR_MODULUS,HORIZON,yieldStress,isPlanarProblem,thickness,bondGeometry);
+}
+
 /** Explicit template instantiation for double. */
 template double computeDeviatoricForceStateNorm<double>
 (
@@ -293,7 +368,8 @@ template double computeDeviatoricForceStateNorm<double>
 		const double *yOverlap,
 		const double *volumeOverlap,
 		double alpha,
-		double OMEGA
+		double OMEGA,
+		const double *bondGeometry
 );
 
 /** Explicit template instantiation for double. */
@@ -317,7 +393,9 @@ template void computeInternalForceIsotropicElasticPlastic<double>
 		double HORIZON,
 		double yieldStress,
 		bool isPlanarProblem,
-		double thickness
+		double thickness,
+		const double* bondGeometry,
+		PeridigmNS::ThreadForceBuffers<double>* threadForceBuffers
 );
 
 /** Explicit template instantiation for Sacado::Fad::DFad<double>. */
@@ -334,7 +412,8 @@ template Sacado::Fad::DFad<double> computeDeviatoricForceStateNorm<Sacado::Fad::
 		const Sacado::Fad::DFad<double> *yOverlap,
 		const double *volumeOverlap,
 		double alpha,
-		double OMEGA
+		double OMEGA,
+		const Sacado::Fad::DFad<double> *bondGeometry
 );
 
 /** Explicit template instantiation for Sacado::Fad::DFad<double>. */
@@ -358,7 +437,113 @@ template void computeInternalForceIsotropicElasticPlastic<Sacado::Fad::DFad<doub
 		double HORIZON,
 		double yieldStress,
 		bool isPlanarProblem,
-		double thickness
+		double thickness,
+		const Sacado::Fad::DFad<double>* bondGeometry,
+		PeridigmNS::ThreadForceBuffers<Sacado::Fad::DFad<double> >* threadForceBuffers
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,64>. */
+template void computeInternalForceIsotropicElasticPlastic<Sacado::Fad::SLFad<double,64> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,64>* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,64>* dilatationOwned,
+		const double* bondDamage,
+		const double* deviatoricPlasticExtensionStateN,
+		Sacado::Fad::SLFad<double,64>* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		Sacado::Fad::SLFad<double,64>* lambdaNP1,
+		Sacado::Fad::SLFad<double,64>* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		bool isPlanarProblem,
+		double thickness,
+		const Sacado::Fad::SLFad<double,64>* bondGeometry,
+		PeridigmNS::ThreadForceBuffers<Sacado::Fad::SLFad<double,64> >* threadForceBuffers
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,128>. */
+template void computeInternalForceIsotropicElasticPlastic<Sacado::Fad::SLFad<double,128> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,128>* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,128>* dilatationOwned,
+		const double* bondDamage,
+		const double* deviatoricPlasticExtensionStateN,
+		Sacado::Fad::SLFad<double,128>* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		Sacado::Fad::SLFad<double,128>* lambdaNP1,
+		Sacado::Fad::SLFad<double,128>* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		bool isPlanarProblem,
+		double thickness,
+		const Sacado::Fad::SLFad<double,128>* bondGeometry,
+		PeridigmNS::ThreadForceBuffers<Sacado::Fad::SLFad<double,128> >* threadForceBuffers
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,256>. */
+template void computeInternalForceIsotropicElasticPlastic<Sacado::Fad::SLFad<double,256> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,256>* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,256>* dilatationOwned,
+		const double* bondDamage,
+		const double* deviatoricPlasticExtensionStateN,
+		Sacado::Fad::SLFad<double,256>* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		Sacado::Fad::SLFad<double,256>* lambdaNP1,
+		Sacado::Fad::SLFad<double,256>* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		bool isPlanarProblem,
+		double thickness,
+		const Sacado::Fad::SLFad<double,256>* bondGeometry,
+		PeridigmNS::ThreadForceBuffers<Sacado::Fad::SLFad<double,256> >* threadForceBuffers
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,512>. */
+template void computeInternalForceIsotropicElasticPlastic<Sacado::Fad::SLFad<double,512> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,512>* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,512>* dilatationOwned,
+		const double* bondDamage,
+		const double* deviatoricPlasticExtensionStateN,
+		Sacado::Fad::SLFad<double,512>* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		Sacado::Fad::SLFad<double,512>* lambdaNP1,
+		Sacado::Fad::SLFad<double,512>* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		bool isPlanarProblem,
+		double thickness,
+		const Sacado::Fad::SLFad<double,512>* bondGeometry,
+		PeridigmNS::ThreadForceBuffers<Sacado::Fad::SLFad<double,512> >* threadForceBuffers
 );
 
 }
@@ -48,6 +48,10 @@
 #ifndef ELASTIC_PLASTIC_H
 #define ELASTIC_PLASTIC_H
 
+namespace PeridigmNS {
+  template<typename ScalarT> class ThreadForceBuffers;
+}
+
 namespace MATERIAL_EVALUATION {
 
 /**
@@ -63,6 +67,7 @@ namespace MATERIAL_EVALUATION {
  * @param volumeOverlap  -- pointer to volume overlap vector; use this to get volume of neighboring points
  * @param alpha          -- material property (alpha = 15 mu / m
  * @param OMEGA          -- weight function at point
+ * @param bondGeometry   -- bond geometry cached by computeDilatation() for the first bond of the point, or NULL
  */
 template<typename ScalarT>
 ScalarT computeDeviatoricForceStateNorm
@@ -78,9 +83,12 @@ ScalarT computeDeviatoricForceStateNorm
 		const ScalarT *yOverlap,
 		const double *volumeOverlap,
 		double alpha,
-		double OMEGA
+		double OMEGA,
+		const ScalarT *bondGeometry = 0
 );
 
+//! Computes the internal force and updates the plastic state for the owned points.
+//! If threadForceBuffers is not NULL and has been set up for more than one thread, the owned points are evaluated in parallel.
 template<typename ScalarT>
 void computeInternalForceIsotropicElasticPlastic
 (
@@ -102,7 +110,9 @@ void computeInternalForceIsotropicElasticPlastic
 		double HORIZON,
 		double yieldStress,
 		bool isPlanarProblem,
-		double thickness
+		double thickness,
+		const ScalarT* bondGeometry = 0,
+		PeridigmNS::ThreadForceBuffers<ScalarT>* threadForceBuffers = 0
 );
 
 }
@@ -49,6 +49,7 @@
 #include <float.h>
 #include "elastic_plastic.h"
 #include "elastic_plastic_hardening.h"
+#include "material_utilities.h"
 #include <complex>
 #include "Peridigm_Constants.hpp"
 
@@ -80,7 +81,8 @@ void computeInternalForceIsotropicHardeningPlastic
 		double SHEAR_MODULUS,
 		double HORIZON,
 		double yieldStress,
-		double HARD_MODULUS
+		double HARD_MODULUS,
+		const ScalarT* bondGeometry
 )
 {
 
@@ -129,7 +131,7 @@ void computeInternalForceIsotropicHardeningPlastic
 		 * Compute norm of trial stress
 		 */
 		ScalarT tdNorm = 0.0;
-		tdNorm = computeDeviatoricForceStateNorm(numNeigh,*theta,neighPtr,bondDamage,deviatoricPlasticExtensionStateN,X,Y,xOverlap,yNP1Overlap,v,alpha,OMEGA);
+		tdNorm = computeDeviatoricForceStateNorm(numNeigh,*theta,neighPtr,bondDamage,deviatoricPlasticExtensionStateN,X,Y,xOverlap,yNP1Overlap,v,alpha,OMEGA,bondGeometry);
 
 		/*
 		 * Evaluate yield function
@@ -173,16 +175,26 @@ void computeInternalForceIsotropicHardeningPlastic
 		for(int n=0;n<numNeigh;n++,neighPtr++,bondDamage++, deviatoricPlasticExtensionStateN++, deviatoricPlasticExtensionStateNp1++){
 			int localId = *neighPtr;
 			cellVolume = v[localId];
-			const double *XP = &xOverlap[3*localId];
-			const ScalarT *YP = &yNP1Overlap[3*localId];
-			dx_X = XP[0]-X[0];
-			dy_X = XP[1]-X[1];
-			dz_X = XP[2]-X[2];
-			zeta = sqrt(dx_X*dx_X+dy_X*dy_X+dz_X*dz_X);
-			dx_Y = YP[0]-Y[0];
-			dy_Y = YP[1]-Y[1];
-			dz_Y = YP[2]-Y[2];
-			dY = sqrt(dx_Y*dx_Y+dy_Y*dy_Y+dz_Y*dz_Y);
+			if(bondGeometry){
+				zeta = Sacado::ScalarValue<ScalarT>::eval(bondGeometry[0]);
+				dx_Y = bondGeometry[1];
+				dy_Y = bondGeometry[2];
+				dz_Y = bondGeometry[3];
+				dY = bondGeometry[4];
+				bondGeometry += BOND_GEOMETRY_SIZE;
+			}
+			else{
+				const double *XP = &xOverlap[3*localId];
+				const ScalarT *YP = &yNP1Overlap[3*localId];
+				dx_X = XP[0]-X[0];
+				dy_X = XP[1]-X[1];
+				dz_X = XP[2]-X[2];
+				zeta = sqrt(dx_X*dx_X+dy_X*dy_X+dz_X*dz_X);
+				dx_Y = YP[0]-Y[0];
+				dy_Y = YP[1]-Y[1];
+				dz_Y = YP[2]-Y[2];
+				dY = sqrt(dx_Y*dx_Y+dy_Y*dy_Y+dz_Y*dz_Y);
+			}
 			/*
 			 * Deviatoric extension state
 			 */
@@ -347,7 +359,8 @@ template void computeInternalForceIsotropicHardeningPlastic<double>
 		double SHEAR_MODULUS,
 		double HORIZON,
 		double yieldStress,
-		double HARD_MODULUS
+		double HARD_MODULUS,
+		const double* bondGeometry
 );
 
 /** Explicit template instantiation for Sacado::Fad::DFad<double>. */
@@ -371,7 +384,108 @@ template void computeInternalForceIsotropicHardeningPlastic<Sacado::Fad::DFad<do
 		double SHEAR_MODULUS,
 		double HORIZON,
 		double yieldStress,
-		double HARD_MODULUS
+		double HARD_MODULUS,
+		const Sacado::Fad::DFad<double>* bondGeometry
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,64>. */
+template void computeInternalForceIsotropicHardeningPlastic<Sacado::Fad::SLFad<double,64> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,64>* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,64>* dilatationOwned,
+		const double* bondDamage,
+		const double* scfOwned,
+		const double* deviatoricPlasticExtensionStateN,
+		Sacado::Fad::SLFad<double,64>* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		Sacado::Fad::SLFad<double,64>* lambdaNP1,
+		Sacado::Fad::SLFad<double,64>* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		double HARD_MODULUS,
+		const Sacado::Fad::SLFad<double,64>* bondGeometry
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,128>. */
+template void computeInternalForceIsotropicHardeningPlastic<Sacado::Fad::SLFad<double,128> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,128>* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,128>* dilatationOwned,
+		const double* bondDamage,
+		const double* scfOwned,
+		const double* deviatoricPlasticExtensionStateN,
+		Sacado::Fad::SLFad<double,128>* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		Sacado::Fad::SLFad<double,128>* lambdaNP1,
+		Sacado::Fad::SLFad<double,128>* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		double HARD_MODULUS,
+		const Sacado::Fad::SLFad<double,128>* bondGeometry
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,256>. */
+template void computeInternalForceIsotropicHardeningPlastic<Sacado::Fad::SLFad<double,256> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,256>* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,256>* dilatationOwned,
+		const double* bondDamage,
+		const double* scfOwned,
+		const double* deviatoricPlasticExtensionStateN,
+		Sacado::Fad::SLFad<double,256>* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		Sacado::Fad::SLFad<double,256>* lambdaNP1,
+		Sacado::Fad::SLFad<double,256>* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		double HARD_MODULUS,
+		const Sacado::Fad::SLFad<double,256>* bondGeometry
+);
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,512>. */
+template void computeInternalForceIsotropicHardeningPlastic<Sacado::Fad::SLFad<double,512> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,512>* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const Sacado::Fad::SLFad<double,512>* dilatationOwned,
+		const double* bondDamage,
+		const double* scfOwned,
+		const double* deviatoricPlasticExtensionStateN,
+		Sacado::Fad::SLFad<double,512>* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		Sacado::Fad::SLFad<double,512>* lambdaNP1,
+		Sacado::Fad::SLFad<double,512>* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		double HARD_MODULUS,
+		const Sacado::Fad::SLFad<double,512>* bondGeometry
 );
 
 /** Explicit template instantiation for int. */
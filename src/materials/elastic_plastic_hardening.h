@@ -88,7 +88,8 @@ void computeInternalForceIsotropicHardeningPlastic
 		double SHEAR_MODULUS,
 		double HORIZON,
 		double yieldStress,
-		double HARD_MODULUS
+		double HARD_MODULUS,
+		const ScalarT* bondGeometry = 0
 );
 
 }
@@ -52,15 +52,15 @@
 
 namespace MATERIAL_EVALUATION {
 
-template<typename ScalarT>
-void computeDilatationLinearLPS
+template<typename ScalarT, typename InfluenceFunctionT>
+void computeDilatationLinearLPSKernel
 (
  const double* xOverlapPtr,
  const ScalarT* yOverlapPtr,
  const double* volumeOverlapPtr,
  const double* weightedVolumePtr,
  double horizon,
- const FunctionPointer influenceFunction,
+ const InfluenceFunctionT influenceFunction,
  const double* selfVolumePtr,
  const double* neighborVolumePtr,
  const double* influenceFunctionValues,
@@ -117,8 +117,8 @@ void computeDilatationLinearLPS
   }
 }
 
-template<typename ScalarT>
-void computeInternalForceLinearLPS
+template<typename ScalarT, typename InfluenceFunctionT>
+void computeInternalForceLinearLPSKernel
 (
  const double* xOverlapPtr,
  const ScalarT* yOverlapPtr,
@@ -126,7 +126,7 @@ void computeInternalForceLinearLPS
  const double* weightedVolumePtr,
  const ScalarT* dilatationPtr,
  double horizon,
- const FunctionPointer influenceFunction,
+ const InfluenceFunctionT influenceFunction,
  const double* selfVolumePtr,
  const double* neighborVolumePtr,
  const double* influenceFunctionValues,
@@ -204,6 +204,105 @@ void computeInternalForceLinearLPS
   }
 }
 
+template<typename ScalarT>
+struct ComputeDilatationLinearLPS {
+  const double* xOverlapPtr;
+  const ScalarT* yOverlapPtr;
+  const double* volumeOverlapPtr;
+  const double* weightedVolumePtr;
+  double horizon;
+  const double* selfVolumePtr;
+  const double* neighborVolumePtr;
+  const double* influenceFunctionValues;
+  const double* bondDamage;
+  ScalarT* dilatationOwnedPtr;
+  const int* localNeighborList;
+  int numOwnedPoints;
+
+  template<typename InfluenceFunctionT>
+  void operator()(const InfluenceFunctionT influenceFunction) const {
+    computeDilatationLinearLPSKernel(xOverlapPtr, yOverlapPtr, volumeOverlapPtr, weightedVolumePtr, horizon, influenceFunction, selfVolumePtr, neighborVolumePtr, influenceFunctionValues, bondDamage, dilatationOwnedPtr, localNeighborList, numOwnedPoints);
+  }
+};
+
+template<typename ScalarT>
+void computeDilatationLinearLPS
+(
+ const double* xOverlapPtr,
+ const ScalarT* yOverlapPtr,
+ const double* volumeOverlapPtr,
+ const double* weightedVolumePtr,
+ double horizon,
+ const FunctionPointer influenceFunction,
+ const double* selfVolumePtr,
+ const double* neighborVolumePtr,
+ const double* influenceFunctionValues,
+ const double* bondDamage,
+ ScalarT* dilatationOwnedPtr,
+ const int* localNeighborList,
+ int numOwnedPoints
+)
+{
+  ComputeDilatationLinearLPS<ScalarT> kernel = {xOverlapPtr, yOverlapPtr, volumeOverlapPtr, weightedVolumePtr, horizon, selfVolumePtr, neighborVolumePtr, influenceFunctionValues, bondDamage, dilatationOwnedPtr, localNeighborList, numOwnedPoints};
+  // precomputed influence function values bypass the built-in functions altogether
+  if(influenceFunctionValues != 0)
+    kernel(influenceFunction);
+  else
+    PeridigmNS::InfluenceFunction::dispatch(influenceFunction, kernel);
+}
+
+template<typename ScalarT>
+struct ComputeInternalForceLinearLPS {
+  const double* xOverlapPtr;
+  const ScalarT* yOverlapPtr;
+  const double* volumeOverlapPtr;
+  const double* weightedVolumePtr;
+  const ScalarT* dilatationPtr;
+  double horizon;
+  const double* selfVolumePtr;
+  const double* neighborVolumePtr;
+  const double* influenceFunctionValues;
+  const double* bondDamage;
+  ScalarT* forceOverlapPtr;
+  const int* localNeighborList;
+  int numOwnedPoints;
+  double bulkModulus;
+  double shearModulus;
+
+  template<typename InfluenceFunctionT>
+  void operator()(const InfluenceFunctionT influenceFunction) const {
+    computeInternalForceLinearLPSKernel(xOverlapPtr, yOverlapPtr, volumeOverlapPtr, weightedVolumePtr, dilatationPtr, horizon, influenceFunction, selfVolumePtr, neighborVolumePtr, influenceFunctionValues, bondDamage, forceOverlapPtr, localNeighborList, numOwnedPoints, bulkModulus, shearModulus);
+  }
+};
+
+template<typename ScalarT>
+void computeInternalForceLinearLPS
+(
+ const double* xOverlapPtr,
+ const ScalarT* yOverlapPtr,
+ const double* volumeOverlapPtr,
+ const double* weightedVolumePtr,
+ const ScalarT* dilatationPtr,
+ double horizon,
+ const FunctionPointer influenceFunction,
+ const double* selfVolumePtr,
+ const double* neighborVolumePtr,
+ const double* influenceFunctionValues,
+ const double* bondDamage,
+ ScalarT* forceOverlapPtr,
+ const int* localNeighborList,
+ int numOwnedPoints,
+ double bulkModulus,
+ double shearModulus
+)
+{
+  ComputeInternalForceLinearLPS<ScalarT> kernel = {xOverlapPtr, yOverlapPtr, volumeOverlapPtr, weightedVolumePtr, dilatationPtr, horizon, selfVolumePtr, neighborVolumePtr, influenceFunctionValues, bondDamage, forceOverlapPtr, localNeighborList, numOwnedPoints, bulkModulus, shearModulus};
+  if(influenceFunctionValues != 0)
+    kernel(influenceFunction);
+  else
+    PeridigmNS::InfluenceFunction::dispatch(influenceFunction, kernel);
+}
+
 /** Explicit template instantiation for double. */
 template void computeDilatationLinearLPS<double>
 (
@@ -158,14 +158,15 @@ double scalarInfluenceFunction
   return influenceFunction(zeta, horizon);
 }
 
-double computeWeightedVolume
+template<typename InfluenceFunctionT>
+double computeWeightedVolumeKernel
 (
 		const double *X,
 		const double *xOverlap,
 		const double* volumeOverlap,
 		const int* localNeighborList,
         double horizon,
-		const FunctionPointer omega
+		const InfluenceFunctionT omega
 ){
 
 	double m=0.0;
@@ -187,6 +188,18 @@ double computeWeightedVolume
 	return m;
 }
 
+double computeWeightedVolume
+(
+		const double *X,
+		const double *xOverlap,
+		const double* volumeOverlap,
+		const int* localNeighborList,
+        double horizon,
+		const FunctionPointer omega
+){
+	return computeWeightedVolumeKernel(X,xOverlap,volumeOverlap,localNeighborList,horizon,omega);
+}
+
 void computeDeviatoricDilatation
 (
 		const double* xOverlap,
@@ -232,8 +245,8 @@ void computeDeviatoricDilatation
 	}
 }
 
-template<typename ScalarT>
-void computeDilatation
+template<typename ScalarT, typename InfluenceFunctionT>
+void computeDilatationKernel
 (
 		const double* xOverlap,
 		const ScalarT* yOverlap,
@@ -244,9 +257,10 @@ void computeDilatation
 		const int* localNeighborList,
 		int numOwnedPoints,
         double horizon,
-		const FunctionPointer OMEGA,
+		const InfluenceFunctionT OMEGA,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        ScalarT* bondGeometry
 )
 {
 	const double *xOwned = xOverlap;
@@ -277,6 +291,14 @@ void computeDilatation
 			ScalarT dY = Y_dx*Y_dx+Y_dy*Y_dy+Y_dz*Y_dz;
 			double d = sqrt(zetaSquared);
 			ScalarT e = sqrt(dY);
+			if(bondGeometry){
+				bondGeometry[0] = d;
+				bondGeometry[1] = Y_dx;
+				bondGeometry[2] = Y_dy;
+				bondGeometry[3] = Y_dz;
+				bondGeometry[4] = e;
+				bondGeometry += BOND_GEOMETRY_SIZE;
+			}
 			e -= d;
 			if(deltaTemperature)
 			  e -= thermalExpansionCoefficient*(*deltaT)*d;
@@ -287,6 +309,49 @@ void computeDilatation
 	}
 }
 
+template<typename ScalarT>
+struct ComputeDilatation {
+	const double* xOverlap;
+	const ScalarT* yOverlap;
+	const double *mOwned;
+	const double* volumeOverlap;
+	const double* bondDamage;
+	ScalarT* dilatationOwned;
+	const int* localNeighborList;
+	int numOwnedPoints;
+	double horizon;
+	double thermalExpansionCoefficient;
+	const double* deltaTemperature;
+	ScalarT* bondGeometry;
+
+	template<typename InfluenceFunctionT>
+	void operator()(const InfluenceFunctionT OMEGA) const {
+		computeDilatationKernel(xOverlap,yOverlap,mOwned,volumeOverlap,bondDamage,dilatationOwned,localNeighborList,numOwnedPoints,horizon,OMEGA,thermalExpansionCoefficient,deltaTemperature,bondGeometry);
+	}
+};
+
+template<typename ScalarT>
+void computeDilatation
+(
+		const double* xOverlap,
+		const ScalarT* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		ScalarT* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+		const FunctionPointer OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        ScalarT* bondGeometry
+)
+{
+	ComputeDilatation<ScalarT> kernel = {xOverlap,yOverlap,mOwned,volumeOverlap,bondDamage,dilatationOwned,localNeighborList,numOwnedPoints,horizon,thermalExpansionCoefficient,deltaTemperature,bondGeometry};
+	PeridigmNS::InfluenceFunction::dispatch(OMEGA, kernel);
+}
+
 /** Explicit template instantiation for double. */
 template
 void computeDilatation<double>
@@ -302,7 +367,8 @@ void computeDilatation<double>
         double horizon,
 		const FunctionPointer OMEGA,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        double* bondGeometry
  );
 
 
@@ -321,7 +387,84 @@ void computeDilatation<Sacado::Fad::DFad<double> >
         double horizon,
 		const FunctionPointer OMEGA,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        Sacado::Fad::DFad<double>* bondGeometry
+ );
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,64>. */
+template
+void computeDilatation<Sacado::Fad::SLFad<double,64> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,64>* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		Sacado::Fad::SLFad<double,64>* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+		const FunctionPointer OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        Sacado::Fad::SLFad<double,64>* bondGeometry
+ );
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,128>. */
+template
+void computeDilatation<Sacado::Fad::SLFad<double,128> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,128>* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		Sacado::Fad::SLFad<double,128>* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+		const FunctionPointer OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        Sacado::Fad::SLFad<double,128>* bondGeometry
+ );
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,256>. */
+template
+void computeDilatation<Sacado::Fad::SLFad<double,256> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,256>* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		Sacado::Fad::SLFad<double,256>* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+		const FunctionPointer OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        Sacado::Fad::SLFad<double,256>* bondGeometry
+ );
+
+/** Explicit template instantiation for Sacado::Fad::SLFad<double,512>. */
+template
+void computeDilatation<Sacado::Fad::SLFad<double,512> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::SLFad<double,512>* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		Sacado::Fad::SLFad<double,512>* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+		const FunctionPointer OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        Sacado::Fad::SLFad<double,512>* bondGeometry
  );
 
 /**
@@ -498,7 +641,8 @@ void computeShearCorrectionFactor
 	}
 }
 
-void computeWeightedVolume
+template<typename InfluenceFunctionT>
+void computeWeightedVolumeKernel
 (
 		const double* xOverlap,
 		const double* volumeOverlap,
@@ -506,7 +650,7 @@ void computeWeightedVolume
 		int myNumPoints,
 		const int* localNeighborList,
         double horizon,
-        const FunctionPointer OMEGA
+        const InfluenceFunctionT OMEGA
 ){
 	double *m = mOwned;
 	const double *xOwned = xOverlap;
@@ -514,11 +658,39 @@ void computeWeightedVolume
 	for(int p=0;p<myNumPoints;p++, xOwned+=3, m++){
 		int numNeigh = *neighPtr;
 		const double *X = xOwned;
-		*m=MATERIAL_EVALUATION::computeWeightedVolume(X,xOverlap,volumeOverlap,neighPtr,horizon);
+		*m=computeWeightedVolumeKernel(X,xOverlap,volumeOverlap,neighPtr,horizon,OMEGA);
 		neighPtr+=(numNeigh+1);
 	}
 }
 
+struct ComputeWeightedVolume {
+	const double* xOverlap;
+	const double* volumeOverlap;
+	double *mOwned;
+	int myNumPoints;
+	const int* localNeighborList;
+	double horizon;
+
+	template<typename InfluenceFunctionT>
+	void operator()(const InfluenceFunctionT OMEGA) const {
+		computeWeightedVolumeKernel(xOverlap,volumeOverlap,mOwned,myNumPoints,localNeighborList,horizon,OMEGA);
+	}
+};
+
+void computeWeightedVolume
+(
+		const double* xOverlap,
+		const double* volumeOverlap,
+		double *mOwned,
+		int myNumPoints,
+		const int* localNeighborList,
+        double horizon,
+        const FunctionPointer OMEGA
+){
+	ComputeWeightedVolume kernel = {xOverlap,volumeOverlap,mOwned,myNumPoints,localNeighborList,horizon};
+	PeridigmNS::InfluenceFunction::dispatch(OMEGA, kernel);
+}
+
 
 namespace WITH_BOND_VOLUME {
 
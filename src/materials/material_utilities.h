@@ -193,6 +193,15 @@ void computeDeviatoricDilatation
         const FunctionPointer OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction()
 );
 
+//! Number of values stored per bond by computeDilatation() when bond geometry is cached.
+const int BOND_GEOMETRY_SIZE = 5;
+
+/**
+ * If bondGeometry is not NULL, the bond geometry evaluated during the dilatation
+ * sweep is stored for reuse by the force evaluation, BOND_GEOMETRY_SIZE values per bond:
+ * the reference bond length, the three components of the deformed bond vector, and the
+ * deformed bond length.
+ */
 template<typename ScalarT>
 void computeDilatation
 (
@@ -207,7 +216,8 @@ void computeDilatation
         double horizon,
         const FunctionPointer OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),
         double thermalExpansionCoefficient = 0,
-        const double* deltaTemperature = 0
+        const double* deltaTemperature = 0,
+        ScalarT* bondGeometry = 0
  );
 
 namespace WITH_BOND_VOLUME {
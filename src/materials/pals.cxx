@@ -846,6 +846,142 @@ void computeInternalForcePals
 
 }
 
+void computeBondInfluence
+(
+	const double *xOverlap,
+	const std::vector<const double *>& _omega_multipliers,
+	const double *omega_constant,
+	const std::vector<const double *>& _sigma_multipliers,
+	const double *sigma_constant,
+	double *bond_length,
+	double *omega_bond,
+	double *sigma_bond,
+	const int *localNeighborList,
+	int numOwnedPoints,
+	double horizon,
+	const FunctionPointer OMEGA_0,
+	const FunctionPointer SIGMA_0
+)
+{
+	double bond[3];
+	const double *xOwned = xOverlap;
+	double lambda_X[NUM_LAGRANGE_MULTIPLIERS];
+	const double *oc=omega_constant;
+	double tau_X[NUM_LAGRANGE_MULTIPLIERS];
+	const double *sc=sigma_constant;
+	const int *neighPtr = localNeighborList;
+	for(int q=0; q<numOwnedPoints;q++, xOwned+=3, oc++, sc++){
+		int numNeigh = *neighPtr; neighPtr++;
+		const double *X = xOwned;
+		// Collect computed Lagrange multipliers for this point
+		for(int i=0;i<NUM_LAGRANGE_MULTIPLIERS;i++){
+			lambda_X[i]=_omega_multipliers[i][q];
+			tau_X[i]=_sigma_multipliers[i][q];
+		}
+		pals_influence<dilatation_influence> OMEGA(OMEGA_0,*oc,lambda_X);
+		pals_influence<deviatoric_influence> SIGMA(SIGMA_0,*sc,tau_X);
+		for(int n=0;n<numNeigh;n++,neighPtr++,bond_length++,omega_bond++,sigma_bond++){
+			int localId = *neighPtr;
+			const double *XP = &xOverlap[3*localId];
+			bond[0]=XP[0]-X[0];
+			bond[1]=XP[1]-X[1];
+			bond[2]=XP[2]-X[2];
+			*bond_length = sqrt(bond[0]*bond[0]+bond[1]*bond[1]+bond[2]*bond[2]);
+			*omega_bond = OMEGA(bond,horizon);
+			*sigma_bond = SIGMA(bond,horizon);
+		}
+	}
+}
+
+void computeDilatationPalsPressureAndInternalForce
+(
+	const double *yOverlap,
+	const double *volumeOverlap,
+	const double *bond_length,
+	const double *omega_bond,
+	const double *sigma_bond,
+	const double *weighted_volume,
+	double *dilatation,
+	double *pals_pressure,
+	double *fInternalOverlap,
+	const int *localNeighborList,
+	int numOwnedPoints,
+	double BULK_MODULUS,
+	double SHEAR_MODULUS
+)
+{
+	double K = BULK_MODULUS;
+	double TWO_MU = 2.0 * SHEAR_MODULUS;
+	const double *yOwned = yOverlap;
+	const double *m=weighted_volume;
+	double *theta = dilatation;
+	double *p = pals_pressure;
+	double *fOwned = fInternalOverlap;
+
+	/*
+	 * Deformed bond vector, length and extension are kept from the
+	 * dilatation/pressure sweep for use in the force sweep
+	 */
+	vector<double> deformed_bond;
+
+	double a, b, c;
+	double xi, dY, e, eps, omega, sigma, t;
+	double fx, fy, fz;
+	double cell_volume;
+	const int *neighPtr = localNeighborList;
+	for(int q=0; q<numOwnedPoints;q++, yOwned+=3, fOwned+=3, m++, theta++, p++){
+		int numNeigh = *neighPtr; neighPtr++;
+		const double *Y = yOwned;
+		if((int)deformed_bond.size() < 5*numNeigh)
+			deformed_bond.resize(5*numNeigh);
+
+		*theta = double(0.0);
+		*p = double(0.0);
+		for(int n=0;n<numNeigh;n++){
+			int localId = neighPtr[n];
+			cell_volume = volumeOverlap[localId];
+			const double *YP = &yOverlap[3*localId];
+			a = YP[0]-Y[0];
+			b = YP[1]-Y[1];
+			c = YP[2]-Y[2];
+			xi = bond_length[n];
+			dY = sqrt(a*a+b*b+c*c);
+			e = dY-xi;
+			double *d = &deformed_bond[5*n];
+			d[0]=a; d[1]=b; d[2]=c; d[3]=dY; d[4]=e;
+			double omega_x=omega_bond[n]*xi;
+			double sigma_x=sigma_bond[n]*xi;
+			*theta+=omega_x*e*cell_volume;
+			*p+=-(TWO_MU*sigma_x/3.0)*e*cell_volume;
+		}
+		// Final piece of pals_pressure requires dilatation that is only ready here
+		*p+=(K+TWO_MU*(*m)/9.0)*(*theta);
+
+		double self_cell_volume = volumeOverlap[q];
+		for(int n=0;n<numNeigh;n++,neighPtr++,bond_length++,omega_bond++,sigma_bond++){
+			int localId = *neighPtr;
+			const double *d = &deformed_bond[5*n];
+			dY = d[3];
+			e = d[4];
+			xi = *bond_length;
+			eps=e-(*theta)*xi/3.0;
+			omega = *omega_bond;
+			sigma = *sigma_bond;
+			t=(*p)*omega*xi+TWO_MU*sigma*eps;
+			fx = t * d[0] / dY;
+			fy = t * d[1] / dY;
+			fz = t * d[2] / dY;
+			cell_volume= volumeOverlap[localId];
+			*(fOwned+0) += fx*cell_volume;
+			*(fOwned+1) += fy*cell_volume;
+			*(fOwned+2) += fz*cell_volume;
+			fInternalOverlap[3*localId+0] -= fx*self_cell_volume;
+			fInternalOverlap[3*localId+1] -= fy*self_cell_volume;
+			fInternalOverlap[3*localId+2] -= fz*self_cell_volume;
+		}
+	}
+}
+
 }
 
 
@@ -236,6 +236,50 @@ void computeInternalForcePals
 	const FunctionPointer SIGMA_0
 );
 
+/*
+ * Computes the reference bond length and the dilatation and deviatoric
+ * influence functions (including Lagrange multipliers) for every bond.
+ * These depend only on the reference configuration and may be cached.
+ */
+void computeBondInfluence
+(
+	const double *xOverlap,
+	const std::vector<const double *>& _omega_multipliers,
+	const double *omega_constant,
+	const std::vector<const double *>& _sigma_multipliers,
+	const double *sigma_constant,
+	double *bond_length,
+	double *omega_bond,
+	double *sigma_bond,
+	const int *localNeighborList,
+	int numOwnedPoints,
+	double horizon,
+	const FunctionPointer OMEGA_0,
+	const FunctionPointer SIGMA_0
+);
+
+/*
+ * Same result as computeDilatationAndPalsPressure() followed by
+ * computeInternalForcePals(), but in a single sweep over the bonds
+ * using the bond values cached by computeBondInfluence()
+ */
+void computeDilatationPalsPressureAndInternalForce
+(
+	const double *yOverlap,
+	const double *volumeOverlap,
+	const double *bond_length,
+	const double *omega_bond,
+	const double *sigma_bond,
+	const double *weighted_volume,
+	double *dilatation,
+	double *pals_pressure,
+	double *fInternalOverlap,
+	const int *localNeighborList,
+	int numOwnedPoints,
+	double BULK_MODULUS,
+	double SHEAR_MODULUS
+);
+
 }
 
 }
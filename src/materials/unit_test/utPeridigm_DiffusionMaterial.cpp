@@ -0,0 +1,226 @@
+/*! \file utPeridigm_DiffusionMaterial.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_DiffusionMaterial.hpp"
+#include "Peridigm_DegreesOfFreedomManager.hpp"
+#include "Peridigm_SerialMatrix.hpp"
+#include "Peridigm_Field.hpp"
+#include <Epetra_SerialComm.h>
+#include <Epetra_FECrsMatrix.h>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace PeridigmNS;
+using namespace Teuchos;
+
+//! Diffusion material that evaluates its Jacobian by central finite difference, used as the reference for the analytic Jacobian.
+class FiniteDifferenceDiffusionMaterial : public DiffusionMaterial {
+public:
+  FiniteDifferenceDiffusionMaterial(const ParameterList& params) : DiffusionMaterial(params) {}
+  virtual void
+  computeJacobian(const double dt,
+                  const int numOwnedPoints,
+                  const int* ownedIDs,
+                  const int* neighborhoodList,
+                  PeridigmNS::DataManager& dataManager,
+                  PeridigmNS::SerialMatrix& jacobian,
+                  PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const {
+    computeFiniteDifferenceJacobian(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager, jacobian, CENTRAL_DIFFERENCE, jacobianType);
+  }
+};
+
+//! Computes the Jacobian for a 3 by 3 by 2 grid with nonuniform volumes and temperatures; returns the dense Jacobian.
+template<class MaterialT>
+void computeGridJacobian(PeridigmNS::Material::JacobianType jacobianType, vector<double>& jacobian)
+{
+  // temperature is the only unknown
+  static bool dofManagerInitialized = false;
+  if(!dofManagerInitialized){
+    ParameterList solverParams;
+    solverParams.set("Solve For Displacement", false);
+    solverParams.set("Solve For Temperature", true);
+    PeridigmNS::DegreesOfFreedomManager::self().initialize(solverParams);
+    dofManagerInitialized = true;
+  }
+
+  ParameterList params;
+  params.set("Horizon", 1.5);
+  params.set("Coefficient", 2.5);
+  params.set("Finite Difference Probe Length", 1.0e-3);
+  MaterialT mat(params);
+
+  const int nx(3), ny(3), nz(2);
+  int numPoints = nx*ny*nz;
+
+  // bond each point to the points within the horizon, which gives neighborhoods of different sizes
+  vector<double> position(3*numPoints);
+  for(int k=0 ; k<nz ; ++k){
+    for(int j=0 ; j<ny ; ++j){
+      for(int i=0 ; i<nx ; ++i){
+        int id = i + nx*(j + ny*k);
+        position[3*id] = i; position[3*id+1] = j; position[3*id+2] = k;
+      }
+    }
+  }
+  vector<int> neighborhoodList, numNeighbors(numPoints, 0);
+  for(int i=0 ; i<numPoints ; ++i){
+    int numNeighborsIndex = neighborhoodList.size();
+    neighborhoodList.push_back(0);
+    for(int j=0 ; j<numPoints ; ++j){
+      double dx = position[3*j] - position[3*i];
+      double dy = position[3*j+1] - position[3*i+1];
+      double dz = position[3*j+2] - position[3*i+2];
+      if(j != i && std::sqrt(dx*dx + dy*dy + dz*dz) < 1.5){
+        neighborhoodList.push_back(j);
+        numNeighbors[i] += 1;
+      }
+    }
+    neighborhoodList[numNeighborsIndex] = numNeighbors[i];
+  }
+
+  Epetra_SerialComm comm;
+  Epetra_BlockMap scalarPointMap(numPoints, 1, 0, comm);
+  Epetra_BlockMap vectorPointMap(numPoints, 3, 0, comm);
+  vector<int> myGlobalElements(numPoints);
+  for(int i=0 ; i<numPoints ; ++i)
+    myGlobalElements[i] = i;
+  Epetra_BlockMap bondMap(numPoints, numPoints, &myGlobalElements[0], &numNeighbors[0], 0, comm);
+  Epetra_Map tangentMap(numPoints, 0, comm);
+
+  double dt = 1.0;
+  int numOwnedPoints = numPoints;
+  vector<int> ownedIDs(myGlobalElements);
+
+  PeridigmNS::DataManager dataManager;
+  dataManager.setMaps(Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&bondMap, false));
+  dataManager.allocateData(mat.FieldIds());
+
+  // allocate a dense global tangent
+  Teuchos::RCP<Epetra_FECrsMatrix> tangentFECrsMatrix = Teuchos::rcp(new Epetra_FECrsMatrix(Copy, tangentMap, 0, false));
+  vector<double> zeros(numPoints, 0.0);
+  for(int i=0 ; i<numPoints ; ++i){
+    int err = tangentFECrsMatrix->InsertGlobalValues(i, numPoints, &zeros[0], &myGlobalElements[0]);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err < 0, "**** InsertGlobalValues() returned negative error code.\n");
+  }
+  int err = tangentFECrsMatrix->GlobalAssemble();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** GlobalAssemble() returned nonzero error code.\n");
+  PeridigmNS::SerialMatrix tangentSerialMatrix(tangentFECrsMatrix);
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  Epetra_Vector& x = *dataManager.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE);
+  Epetra_Vector& cellVolume = *dataManager.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE);
+  Epetra_Vector& temperature = *dataManager.getData(fieldManager.getFieldId("Temperature"), PeridigmField::STEP_NP1);
+  for(int i=0 ; i<numPoints ; ++i){
+    x[3*i] = position[3*i]; x[3*i+1] = position[3*i+1]; x[3*i+2] = position[3*i+2];
+    cellVolume[i] = 1.0 + 0.1*(i%3);
+    temperature[i] = 300.0 + 5.0*((7*i)%4);
+  }
+
+  mat.initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+  mat.computeJacobian(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager, tangentSerialMatrix, jacobianType);
+
+  jacobian.assign(numPoints*numPoints, 0.0);
+  vector<double> rowValues(numPoints);
+  vector<int> rowIndices(numPoints);
+  for(int row=0 ; row<numPoints ; ++row){
+    int numEntries;
+    tangentFECrsMatrix->ExtractGlobalRowCopy(row, numPoints, numEntries, &rowValues[0], &rowIndices[0]);
+    for(int i=0 ; i<numEntries ; ++i)
+      jacobian[row*numPoints + rowIndices[i]] = rowValues[i];
+  }
+}
+
+//! Tests the analytic Jacobian against the finite-difference Jacobian; the flux divergence is linear, so only round-off separates them.
+TEUCHOS_UNIT_TEST(DiffusionMaterial, FullJacobian) {
+  vector<double> jacobian, finiteDifferenceJacobian;
+  computeGridJacobian<DiffusionMaterial>(PeridigmNS::Material::FULL_MATRIX, jacobian);
+  computeGridJacobian<FiniteDifferenceDiffusionMaterial>(PeridigmNS::Material::FULL_MATRIX, finiteDifferenceJacobian);
+
+  TEST_EQUALITY(jacobian.size(), finiteDifferenceJacobian.size());
+  double maxEntry(0.0);
+  for(unsigned int i=0 ; i<finiteDifferenceJacobian.size() ; ++i)
+    maxEntry = std::max(maxEntry, std::abs(finiteDifferenceJacobian[i]));
+  TEST_COMPARE(maxEntry, >, 0.0);
+  for(unsigned int i=0 ; i<jacobian.size() ; ++i)
+    TEST_COMPARE(std::abs(jacobian[i] - finiteDifferenceJacobian[i]), <=, 1.0e-8*maxEntry);
+}
+
+//! Tests that the block-diagonal Jacobian is the diagonal of the full analytic Jacobian.
+TEUCHOS_UNIT_TEST(DiffusionMaterial, BlockDiagonalJacobian) {
+  vector<double> jacobian, blockDiagonalJacobian;
+  computeGridJacobian<DiffusionMaterial>(PeridigmNS::Material::FULL_MATRIX, jacobian);
+  computeGridJacobian<DiffusionMaterial>(PeridigmNS::Material::BLOCK_DIAGONAL, blockDiagonalJacobian);
+
+  TEST_EQUALITY(jacobian.size(), blockDiagonalJacobian.size());
+  int numPoints = static_cast<int>(std::sqrt(static_cast<double>(jacobian.size())) + 0.5);
+  for(int row=0 ; row<numPoints ; ++row){
+    for(int col=0 ; col<numPoints ; ++col){
+      if(col == row){
+        TEST_COMPARE(std::abs(jacobian[row*numPoints + col]), >, 0.0);
+        TEST_EQUALITY(blockDiagonalJacobian[row*numPoints + col], jacobian[row*numPoints + col]);
+      }
+      else
+        TEST_EQUALITY_CONST(blockDiagonalJacobian[row*numPoints + col], 0.0);
+    }
+  }
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,220 @@
+/*! \file utPeridigm_ElasticBondBasedMaterial.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_ElasticBondBasedMaterial.hpp"
+#include "Peridigm_BitPackedBondData.hpp"
+#include "Peridigm_SerialMatrix.hpp"
+#include "Peridigm_Field.hpp"
+#include <Epetra_SerialComm.h>
+#include <Epetra_FECrsMatrix.h>
+#include <cmath>
+#include <iostream>
+
+
+using namespace std;
+using namespace PeridigmNS;
+using namespace Teuchos;
+
+//! Storage formats for the bond damage field.
+enum BondDamageStorage { DOUBLE_PRECISION, SINGLE_PRECISION, BIT_PACKED };
+
+/*! \brief Evaluates the finite-difference Jacobian for a three-point row with the bond between the end points broken.
+ *
+ *  The bond damage is stored in the given format, and the Jacobian is returned as a dense row-major array.
+ */
+vector<double> computeThreePointJacobian(BondDamageStorage storage)
+{
+  // instantiate the material model
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Horizon", 2.5);
+  params.set("Finite Difference Probe Length", 1.0e-7);
+  ElasticBondBasedMaterial mat(params);
+
+  const int numPoints = 3;
+  const int numDof = 3*numPoints;
+
+  // arguments for calls to material model
+  Epetra_SerialComm comm;
+  Epetra_BlockMap scalarPointMap(numPoints, 1, 0, comm);
+  Epetra_BlockMap vectorPointMap(numPoints, 3, 0, comm);
+  Epetra_BlockMap bondMap(numPoints, numPoints-1, 0, comm);
+  Epetra_Map tangentMap(numDof, 0, comm);
+
+  // set up discretization, every point is bonded to every other point
+  int numOwnedPoints = numPoints;
+  vector<int> ownedIDs(numOwnedPoints);
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numPoints ; ++i){
+    ownedIDs[i] = i;
+    neighborhoodList.push_back(numPoints-1);
+    for(int j=0 ; j<numPoints ; ++j){
+      if(j != i)
+        neighborhoodList.push_back(j);
+    }
+  }
+
+  // create the data manager
+  // in serial, the overlap and non-overlap maps are the same
+  FieldManager& fieldManager = FieldManager::self();
+  int bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+  PeridigmNS::DataManager dataManager;
+  if(storage == SINGLE_PRECISION)
+    dataManager.setSinglePrecisionFieldIds(mat.SinglePrecisionBondFieldIds());
+  else if(storage == BIT_PACKED)
+    dataManager.setBitPackedFieldIds(mat.BitPackedBondFieldIds());
+  dataManager.setMaps(Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&bondMap, false));
+  dataManager.allocateData(mat.FieldIds());
+
+  // Create the global tangent matrix
+  Epetra_DataAccess CV = Copy;
+  int numEntriesPerRow = 0;  // Indicates allocation will take place during the insertion phase
+  bool ignoreNonLocalEntries = false;
+  Teuchos::RCP<Epetra_FECrsMatrix> tangentFECrsMatrix = Teuchos::rcp(new Epetra_FECrsMatrix(CV, tangentMap, numEntriesPerRow, ignoreNonLocalEntries));
+  vector<double> zeros(numDof);
+  vector<int> indices(numDof);
+  for(unsigned int i=0 ; i<indices.size() ; ++i)
+    indices[i] = i;
+  for(int i=0 ; i<numDof ; ++i){
+    // Allocate space in the global matrix
+    int err = tangentFECrsMatrix->InsertGlobalValues(i, numDof, (const double*)&zeros[0], (const int*)&indices[0]);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err < 0, "**** InsertGlobalValues() returned negative error code.\n");
+  }
+  int err = tangentFECrsMatrix->GlobalAssemble();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** GlobalAssemble() returned nonzero error code.\n");
+
+  // create the SerialMatrix that is fed to the material model
+  PeridigmNS::SerialMatrix tangentSerialMatrix(tangentFECrsMatrix);
+
+  Epetra_Vector& cellVolume = *dataManager.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE);
+  Epetra_Vector& x = *dataManager.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE);
+  Epetra_Vector& y = *dataManager.getData(fieldManager.getFieldId("Coordinates"), PeridigmField::STEP_NP1);
+
+  double dt = 1.0; // time step
+
+  for(int i=0 ; i<numPoints ; ++i){
+    cellVolume[i] = 1.0;
+    x[3*i] = i; x[3*i+1] = 0.0; x[3*i+2] = 0.0;
+    y[3*i] = 1.01*i; y[3*i+1] = 0.002*i*i; y[3*i+2] = 0.0;
+  }
+
+  // break the bond between points 0 and 2, which is bond 1 of point 0 and bond 0 of point 2
+  const int brokenBonds[2] = {1, 4};
+  for(int i=0 ; i<2 ; ++i){
+    if(storage == DOUBLE_PRECISION)
+      (*dataManager.getData(bondDamageFieldId, PeridigmField::STEP_NP1))[brokenBonds[i]] = 1.0;
+    else if(storage == SINGLE_PRECISION)
+      dataManager.getSinglePrecisionData(bondDamageFieldId, PeridigmField::STEP_NP1)[brokenBonds[i]] = 1.0f;
+    else
+      setBondBit(dataManager.getBitPackedData(bondDamageFieldId, PeridigmField::STEP_NP1), brokenBonds[i], true);
+  }
+
+  mat.initialize(dt,
+                 numOwnedPoints,
+                 &ownedIDs[0],
+                 &neighborhoodList[0],
+                 dataManager);
+
+  mat.computeJacobian(dt,
+                      numOwnedPoints,
+                      &ownedIDs[0],
+                      &neighborhoodList[0],
+                      dataManager,
+                      tangentSerialMatrix);
+
+  vector<double> jacobian(numDof*numDof, 0.0);
+  vector<double> values(numDof);
+  int numEntries;
+  for(int row=0 ; row<numDof ; ++row){
+    tangentFECrsMatrix->ExtractGlobalRowCopy(row, numDof, numEntries, &values[0], &indices[0]);
+    for(int i=0 ; i<numEntries ; ++i)
+      jacobian[row*numDof + indices[i]] = values[i];
+  }
+  return jacobian;
+}
+
+//! Checks that the finite-difference Jacobian honors single-precision and bit-packed bond damage.
+TEUCHOS_UNIT_TEST(ElasticBondBasedMaterial, compactBondDamageTangentStiffnessMatrix) {
+
+  const int numDof = 9;
+  vector<double> doublePrecisionJacobian = computeThreePointJacobian(DOUBLE_PRECISION);
+
+  // the intact bonds couple the neighboring points, the broken bond leaves the end points uncoupled
+  double maxValue = 0.0;
+  for(unsigned int i=0 ; i<doublePrecisionJacobian.size() ; ++i)
+    maxValue = std::max(maxValue, std::abs(doublePrecisionJacobian[i]));
+  TEST_COMPARE(maxValue, >, 0.0);
+  TEST_COMPARE(std::abs(doublePrecisionJacobian[0*numDof + 3]), >, 0.0);
+  for(int i=0 ; i<3 ; ++i){
+    for(int j=0 ; j<3 ; ++j){
+      TEST_EQUALITY_CONST(doublePrecisionJacobian[i*numDof + 6+j], 0.0);
+      TEST_EQUALITY_CONST(doublePrecisionJacobian[(6+i)*numDof + j], 0.0);
+    }
+  }
+
+  // damage values of zero and one are exact in every format, so the Jacobians agree exactly
+  vector<double> singlePrecisionJacobian = computeThreePointJacobian(SINGLE_PRECISION);
+  vector<double> bitPackedJacobian = computeThreePointJacobian(BIT_PACKED);
+  for(unsigned int i=0 ; i<doublePrecisionJacobian.size() ; ++i){
+    TEST_EQUALITY(singlePrecisionJacobian[i], doublePrecisionJacobian[i]);
+    TEST_EQUALITY(bitPackedJacobian[i], doublePrecisionJacobian[i]);
+  }
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
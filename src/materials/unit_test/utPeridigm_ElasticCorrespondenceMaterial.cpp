@@ -0,0 +1,387 @@
+/*! \file utPeridigm_ElasticCorrespondenceMaterial.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_ElasticCorrespondenceMaterial.hpp"
+#include "Peridigm_SerialMatrix.hpp"
+#include "Peridigm_Field.hpp"
+#include "correspondence.h"
+#include <Sacado.hpp>
+#include <Epetra_SerialComm.h>
+#include <Epetra_FECrsMatrix.h>
+#include <cmath>
+#include <iostream>
+
+
+using namespace std;
+using namespace PeridigmNS;
+using namespace Teuchos;
+
+//! Evaluates the Jacobian for a five-point system in which every point is bonded to every other point.
+Teuchos::RCP<Epetra_FECrsMatrix> computeFivePointJacobian(bool applyAutomaticDifferentiationJacobian)
+{
+  // instantiate the material model
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Hourglass Coefficient", 0.02);
+  params.set("Finite Difference Probe Length", 1.0e-7);
+  params.set("Apply Automatic Differentiation Jacobian", applyAutomaticDifferentiationJacobian);
+  ElasticCorrespondenceMaterial mat(params);
+
+  const int numPoints = 5;
+  const int numDof = 3*numPoints;
+
+  // arguments for calls to material model
+  Epetra_SerialComm comm;
+  Epetra_BlockMap scalarPointMap(numPoints, 1, 0, comm);
+  Epetra_BlockMap vectorPointMap(numPoints, 3, 0, comm);
+  Epetra_BlockMap bondMap(numPoints, numPoints-1, 0, comm);
+  Epetra_Map tangentMap(numDof, 0, comm);
+
+  // set up discretization
+  int numOwnedPoints = numPoints;
+  vector<int> ownedIDs(numOwnedPoints);
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numPoints ; ++i){
+    ownedIDs[i] = i;
+    neighborhoodList.push_back(numPoints-1);
+    for(int j=0 ; j<numPoints ; ++j){
+      if(j != i)
+        neighborhoodList.push_back(j);
+    }
+  }
+
+  // create the data manager
+  // in serial, the overlap and non-overlap maps are the same
+  PeridigmNS::DataManager dataManager;
+  dataManager.setMaps(Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&bondMap, false));
+  dataManager.allocateData(mat.FieldIds());
+
+  // Create the global tangent matrix
+  Epetra_DataAccess CV = Copy;
+  int numEntriesPerRow = 0;  // Indicates allocation will take place during the insertion phase
+  bool ignoreNonLocalEntries = false;
+  Teuchos::RCP<Epetra_FECrsMatrix> tangentFECrsMatrix = Teuchos::rcp(new Epetra_FECrsMatrix(CV, tangentMap, numEntriesPerRow, ignoreNonLocalEntries));
+  vector<double> zeros(numDof);
+  vector<int> indices(numDof);
+  for(unsigned int i=0 ; i<indices.size() ; ++i)
+    indices[i] = i;
+  for(int i=0 ; i<numDof ; ++i){
+    // Allocate space in the global matrix
+    int err = tangentFECrsMatrix->InsertGlobalValues(i, numDof, (const double*)&zeros[0], (const int*)&indices[0]);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err < 0, "**** InsertGlobalValues() returned negative error code.\n");
+  }
+  int err = tangentFECrsMatrix->GlobalAssemble();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** GlobalAssemble() returned nonzero error code.\n");
+
+  // create the SerialMatrix that is fed to the material model
+  PeridigmNS::SerialMatrix tangentSerialMatrix(tangentFECrsMatrix);
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  int horizonFieldId = fieldManager.getFieldId("Horizon");
+  int volumeFieldId = fieldManager.getFieldId("Volume");
+  int modelCoordinatesFieldId = fieldManager.getFieldId("Model_Coordinates");
+  int coordinatesFieldId = fieldManager.getFieldId("Coordinates");
+  int velocityFieldId = fieldManager.getFieldId("Velocity");
+
+  Epetra_Vector& horizon = *dataManager.getData(horizonFieldId, PeridigmField::STEP_NONE);
+  Epetra_Vector& cellVolume = *dataManager.getData(volumeFieldId, PeridigmField::STEP_NONE);
+  Epetra_Vector& x = *dataManager.getData(modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+  Epetra_Vector& y = *dataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+  Epetra_Vector& v = *dataManager.getData(velocityFieldId, PeridigmField::STEP_NP1);
+
+  double dt = 1.0; // time step
+
+  x[0]  = 0.0; x[1]  = 0.0; x[2]  = 0.0;
+  x[3]  = 1.0; x[4]  = 0.0; x[5]  = 0.0;
+  x[6]  = 0.0; x[7]  = 1.0; x[8]  = 0.0;
+  x[9]  = 0.0; x[10] = 0.0; x[11] = 1.0;
+  x[12] = 1.0; x[13] = 1.0; x[14] = 1.0;
+  for(int i=0 ; i<numPoints ; ++i){
+    horizon[i] = 2.0;
+    cellVolume[i] = 1.0;
+  }
+  for(int i=0 ; i<numDof ; ++i)
+    y[i] = x[i];
+
+  mat.initialize(dt,
+                 numOwnedPoints,
+                 &ownedIDs[0],
+                 &neighborhoodList[0],
+                 dataManager);
+
+  // apply a stretch plus a small shear, and the corresponding velocity
+  for(int i=0 ; i<numPoints ; ++i){
+    y[3*i]   = 1.01*x[3*i] + 0.005*x[3*i+1];
+    y[3*i+1] = 0.99*x[3*i+1];
+    y[3*i+2] = x[3*i+2] + 0.002*x[3*i];
+  }
+  for(int i=0 ; i<numDof ; ++i)
+    v[i] = (y[i] - x[i])/dt;
+
+  mat.computeJacobian(dt,
+                      numOwnedPoints,
+                      &ownedIDs[0],
+                      &neighborhoodList[0],
+                      dataManager,
+                      tangentSerialMatrix);
+
+  return tangentFECrsMatrix;
+}
+
+//! Compares the automatic differentiation Jacobian to the finite-difference Jacobian.
+TEUCHOS_UNIT_TEST(ElasticCorrespondenceMaterial, fivePointTangentStiffnessMatrix) {
+
+  Teuchos::RCP<Epetra_FECrsMatrix> finiteDifferenceJacobian = computeFivePointJacobian(false);
+  Teuchos::RCP<Epetra_FECrsMatrix> automaticDifferentiationJacobian = computeFivePointJacobian(true);
+
+  const int numDof = 15;
+  int numEntries;
+  vector<double> fdValues(numDof), adValues(numDof);
+  vector<int> fdIndices(numDof), adIndices(numDof);
+
+  double maxValue = 0.0;
+  for(int row=0 ; row<numDof ; ++row){
+    finiteDifferenceJacobian->ExtractGlobalRowCopy(row, numDof, numEntries, &fdValues[0], &fdIndices[0]);
+    for(int i=0 ; i<numEntries ; ++i)
+      maxValue = std::max(maxValue, std::abs(fdValues[i]));
+  }
+  TEST_COMPARE(maxValue, >, 0.0);
+
+  for(int row=0 ; row<numDof ; ++row){
+    finiteDifferenceJacobian->ExtractGlobalRowCopy(row, numDof, numEntries, &fdValues[0], &fdIndices[0]);
+    TEST_EQUALITY(numEntries, numDof);
+    automaticDifferentiationJacobian->ExtractGlobalRowCopy(row, numDof, numEntries, &adValues[0], &adIndices[0]);
+    TEST_EQUALITY(numEntries, numDof);
+    for(int i=0 ; i<numDof ; ++i){
+      TEST_EQUALITY(fdIndices[i], adIndices[i]);
+      TEST_COMPARE(std::abs(adValues[i] - fdValues[i]), <=, 1.0e-5*maxValue);
+    }
+  }
+}
+
+//! Deterministic pseudo-random value in [-1, 1].
+double randomValue(unsigned int& seed)
+{
+  seed = 1103515245u*seed + 12345u;
+  return 2.0*((seed/65536u)%32768u)/32767.0 - 1.0;
+}
+
+void setRandom(double& x, unsigned int& seed)
+{
+  x = randomValue(seed);
+}
+
+void setRandom(Sacado::Fad::DFad<double>& x, unsigned int& seed)
+{
+  x = Sacado::Fad::DFad<double>(2, randomValue(seed));
+  x.fastAccessDx(0) = randomValue(seed);
+  x.fastAccessDx(1) = randomValue(seed);
+}
+
+bool sameValue(double a, double b)
+{
+  return a == b;
+}
+
+bool sameValue(const Sacado::Fad::DFad<double>& a, const Sacado::Fad::DFad<double>& b)
+{
+  if(a.val() != b.val() || a.size() != b.size())
+    return false;
+  for(int i=0 ; i<a.size() ; ++i){
+    if(a.dx(i) != b.dx(i))
+      return false;
+  }
+  return true;
+}
+
+//! Compares the batched tensor kernels to their scalar counterparts, point by point, with a partial final batch.
+//! The comparison is exact; it assumes the compiler does not contract multiply-adds into FMAs differently in the two forms.
+template<typename ScalarT>
+void checkTensorBatches(Teuchos::FancyOStream& out, bool& success)
+{
+  using namespace CORRESPONDENCE;
+  const int B = TENSOR_BATCH_SIZE;
+  const int numPoints = 2*B + 3;
+  TEST_COMPARE(numPoints%B, !=, 0);
+  unsigned int seed = 12345;
+
+  vector<ScalarT> a(9*numPoints), b(9*numPoints), alpha(numPoints);
+  for(int i=0 ; i<9*numPoints ; ++i){
+    setRandom(a[i], seed);
+    setRandom(b[i], seed);
+  }
+  for(int iID=0 ; iID<numPoints ; ++iID){
+    if(iID%3 == 0)
+      alpha[iID] = 1.0;
+    else
+      setRandom(alpha[iID], seed);
+  }
+  // a singular matrix in the first batch
+  a[27] = 0.0; a[28] = 0.0; a[29] = 0.0;
+
+  // Flanagan & Taylor inputs:  a velocity gradient, a left stretch near the identity, and a rotation
+  // the velocity gradient of point 5 is symmetric and its left stretch is the identity, so it does not rotate
+  vector<ScalarT> velGrad(9*numPoints), leftStretchN(9*numPoints), rotTensorN(9*numPoints);
+  const int transpose[9] = {0, 3, 6, 1, 4, 7, 2, 5, 8};
+  for(int iID=0 ; iID<numPoints ; ++iID){
+    for(int k=0 ; k<9 ; ++k){
+      setRandom(velGrad[9*iID+k], seed);
+      setRandom(rotTensorN[9*iID+k], seed);
+    }
+    for(int k=0 ; k<9 ; ++k){
+      double identity = (k == 0 || k == 4 || k == 8) ? 1.0 : 0.0;
+      leftStretchN[9*iID+k] = identity + 0.05*(b[9*iID+k] + b[9*iID+transpose[k]]);
+    }
+  }
+  for(int k=0 ; k<9 ; ++k){
+    velGrad[45+k] = 0.5*(a[45+k] + a[45+transpose[k]]);
+    leftStretchN[45+k] = (k == 0 || k == 4 || k == 8) ? 1.0 : 0.0;
+  }
+  double dt = 0.01;
+
+  // batched results, scattered back to one tensor per point
+  vector<ScalarT> roundTrip(9*numPoints), inverse(9*numPoints), determinant(numPoints);
+  vector<ScalarT> product(8*9*numPoints);
+  vector<ScalarT> leftStretchNP1(9*numPoints), rotTensorNP1(9*numPoints), unrotRateOfDef(9*numPoints);
+  vector<int> inversionReturnCode(numPoints);
+
+  ScalarT aBatch[9*B], bBatch[9*B], resultBatch[9*B], determinantBatch[B];
+  ScalarT velGradBatch[9*B], leftStretchNBatch[9*B], rotTensorNBatch[9*B];
+  ScalarT leftStretchNP1Batch[9*B], rotTensorNP1Batch[9*B], unrotRateOfDefBatch[9*B];
+  for(int firstID=0 ; firstID<numPoints ; firstID+=B){
+
+    int numLanes = numPoints - firstID < B ? numPoints - firstID : B;
+
+    gatherTensorBatch(&a[9*firstID], aBatch, numLanes);
+    gatherTensorBatch(&b[9*firstID], bBatch, numLanes);
+    scatterTensorBatch(aBatch, &roundTrip[9*firstID], numLanes);
+
+    int returnCode = Invert3by3MatrixBatch(aBatch, determinantBatch, resultBatch, numLanes);
+    scatterTensorBatch(resultBatch, &inverse[9*firstID], numLanes);
+    for(int l=0 ; l<numLanes ; ++l){
+      determinant[firstID+l] = determinantBatch[l];
+      inversionReturnCode[firstID+l] = returnCode;
+    }
+
+    for(int op=0 ; op<8 ; ++op){
+      bool transA = (op & 1) != 0;
+      bool transB = (op & 2) != 0;
+      const ScalarT* alphaBatch = (op & 4) != 0 ? &alpha[firstID] : 0;
+      MatrixMultiplyBatch(transA, transB, alphaBatch, aBatch, bBatch, resultBatch, numLanes);
+      scatterTensorBatch(resultBatch, &product[op*9*numPoints + 9*firstID], numLanes);
+    }
+
+    gatherTensorBatch(&velGrad[9*firstID], velGradBatch, numLanes);
+    gatherTensorBatch(&leftStretchN[9*firstID], leftStretchNBatch, numLanes);
+    gatherTensorBatch(&rotTensorN[9*firstID], rotTensorNBatch, numLanes);
+    updateLeftStretchRotationAndUnrotatedRateOfDeformationBatch(velGradBatch, leftStretchNBatch, rotTensorNBatch,
+                                                                leftStretchNP1Batch, rotTensorNP1Batch, unrotRateOfDefBatch,
+                                                                dt, numLanes);
+    scatterTensorBatch(leftStretchNP1Batch, &leftStretchNP1[9*firstID], numLanes);
+    scatterTensorBatch(rotTensorNP1Batch, &rotTensorNP1[9*firstID], numLanes);
+    scatterTensorBatch(unrotRateOfDefBatch, &unrotRateOfDef[9*firstID], numLanes);
+  }
+
+  // scalar results
+  TEST_EQUALITY(inversionReturnCode[0], 1);
+  TEST_EQUALITY(inversionReturnCode[numPoints-1], 0);
+  ScalarT expected[9], expectedStretch[9], expectedRotation[9], scalarDeterminant;
+  for(int iID=0 ; iID<numPoints ; ++iID){
+
+    for(int k=0 ; k<9 ; ++k)
+      TEST_ASSERT(sameValue(roundTrip[9*iID+k], a[9*iID+k]));
+
+    Invert3by3Matrix(&a[9*iID], scalarDeterminant, expected);
+    TEST_ASSERT(sameValue(determinant[iID], scalarDeterminant));
+    for(int k=0 ; k<9 ; ++k)
+      TEST_ASSERT(sameValue(inverse[9*iID+k], expected[k]));
+
+    for(int op=0 ; op<8 ; ++op){
+      bool transA = (op & 1) != 0;
+      bool transB = (op & 2) != 0;
+      ScalarT scale = (op & 4) != 0 ? alpha[iID] : ScalarT(1.0);
+      MatrixMultiply(transA, transB, scale, &a[9*iID], &b[9*iID], expected);
+      for(int k=0 ; k<9 ; ++k)
+        TEST_ASSERT(sameValue(product[op*9*numPoints + 9*iID+k], expected[k]));
+    }
+
+    updateLeftStretchRotationAndUnrotatedRateOfDeformation(&velGrad[9*iID], &leftStretchN[9*iID], &rotTensorN[9*iID],
+                                                           expectedStretch, expectedRotation, expected, dt);
+    for(int k=0 ; k<9 ; ++k){
+      TEST_ASSERT(sameValue(leftStretchNP1[9*iID+k], expectedStretch[k]));
+      TEST_ASSERT(sameValue(rotTensorNP1[9*iID+k], expectedRotation[k]));
+      TEST_ASSERT(sameValue(unrotRateOfDef[9*iID+k], expected[k]));
+    }
+  }
+
+  // the point without rotation keeps its rotation tensor
+  for(int k=0 ; k<9 ; ++k)
+    TEST_ASSERT(sameValue(rotTensorNP1[45+k], rotTensorN[45+k]));
+}
+
+TEUCHOS_UNIT_TEST(CorrespondenceTensorBatch, double) {
+  checkTensorBatches<double>(out, success);
+}
+
+TEUCHOS_UNIT_TEST(CorrespondenceTensorBatch, DFad) {
+  checkTensorBatches< Sacado::Fad::DFad<double> >(out, success);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
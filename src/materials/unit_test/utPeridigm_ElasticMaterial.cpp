@@ -49,9 +49,20 @@
 #include <Teuchos_UnitTestHarness.hpp>
 #include "Teuchos_UnitTestRepository.hpp"
 #include "Peridigm_ElasticMaterial.hpp"
+#include "Peridigm_ElasticPlasticMaterial.hpp"
+#include "Peridigm_ElasticPlasticHardeningMaterial.hpp"
+#include "Peridigm_ViscoelasticMaterial.hpp"
 #include "Peridigm_SerialMatrix.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_ThreadForceBuffers.hpp"
+#include "elastic.h"
+#include "material_utilities.h"
 #include <Epetra_SerialComm.h>
+#include <Epetra_FECrsMatrix.h>
+#include <Sacado.hpp>
+#include <vector>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 
@@ -184,6 +195,131 @@ TEUCHOS_UNIT_TEST(ElasticMaterial, testTwoPts) {
   delete[] neighborhoodList;
 }
 
+//! Evaluates the three-point configuration of testThreePts over two steps; returns the dilatation, force, and the given bond field at the final step.
+template<class MaterialT>
+void evaluateThreePts(ParameterList params,
+                      bool cacheBondGeometry,
+                      const string& bondFieldName,
+                      vector<double>& dilatation,
+                      vector<double>& force,
+                      vector<double>& bondField)
+{
+  params.set("Cache Bond Geometry", cacheBondGeometry);
+  MaterialT mat(params);
+
+  Epetra_SerialComm comm;
+  Epetra_Map nodeMap(3, 0, comm);
+  Epetra_Map unknownMap(9, 0, comm);
+  Epetra_Map bondMap(6, 0, comm);
+  double dt = 1.0;
+  int numOwnedPoints = 3;
+  int ownedIDs[3] = {0, 1, 2};
+  int neighborhoodList[9] = {2, 1, 2, 2, 0, 2, 2, 0, 1};
+
+  PeridigmNS::DataManager dataManager;
+  dataManager.setMaps(Teuchos::rcp(&nodeMap, false),
+                      Teuchos::rcp(&nodeMap, false),
+                      Teuchos::rcp(&unknownMap, false),
+                      Teuchos::rcp(&unknownMap, false),
+                      Teuchos::rcp(&bondMap, false));
+  dataManager.allocateData(mat.FieldIds());
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  Epetra_Vector& x = *dataManager.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE);
+  Epetra_Vector& cellVolume = *dataManager.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE);
+
+  double initialPosition[9] = {1.1, 2.6, -0.1, -2.0, 0.9, -0.3, 0.0, 0.01, 1.8};
+  double currentPosition[9] = {1.2, 2.4, -0.1, -1.9, 0.7, -0.8, 0.1, 0.21, 1.6};
+  for(int i=0 ; i<9 ; ++i)
+    x[i] = initialPosition[i];
+  cellVolume[0] = 0.9;
+  cellVolume[1] = 1.1;
+  cellVolume[2] = 0.8;
+
+  mat.initialize(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager);
+
+  // half of the deformation in the first step, the remainder in the second
+  for(int step=1 ; step<=2 ; ++step){
+    Epetra_Vector& y = *dataManager.getData(fieldManager.getFieldId("Coordinates"), PeridigmField::STEP_NP1);
+    for(int i=0 ; i<9 ; ++i)
+      y[i] = initialPosition[i] + 0.5*step*(currentPosition[i] - initialPosition[i]);
+    mat.computeForce(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager);
+    if(step == 1)
+      dataManager.updateState();
+  }
+
+  Epetra_Vector& dilatationNP1 = *dataManager.getData(fieldManager.getFieldId("Dilatation"), PeridigmField::STEP_NP1);
+  dilatation.assign(&dilatationNP1[0], &dilatationNP1[0] + dilatationNP1.MyLength());
+  Epetra_Vector& forceNP1 = *dataManager.getData(fieldManager.getFieldId("Force_Density"), PeridigmField::STEP_NP1);
+  force.assign(&forceNP1[0], &forceNP1[0] + forceNP1.MyLength());
+  bondField.clear();
+  if(!bondFieldName.empty()){
+    Epetra_Vector& bondFieldNP1 = *dataManager.getData(fieldManager.getFieldId(bondFieldName), PeridigmField::STEP_NP1);
+    bondField.assign(&bondFieldNP1[0], &bondFieldNP1[0] + bondFieldNP1.MyLength());
+  }
+}
+
+//! Requires the cached and uncached bond geometry to give identical results for the three-point configuration.
+template<class MaterialT>
+void compareCachedBondGeometry(const ParameterList& params,
+                               const string& bondFieldName,
+                               Teuchos::FancyOStream& out,
+                               bool& success)
+{
+  vector<double> dilatation, force, bondField;
+  vector<double> cachedDilatation, cachedForce, cachedBondField;
+  evaluateThreePts<MaterialT>(params, false, bondFieldName, dilatation, force, bondField);
+  evaluateThreePts<MaterialT>(params, true, bondFieldName, cachedDilatation, cachedForce, cachedBondField);
+
+  TEST_EQUALITY(cachedDilatation.size(), dilatation.size());
+  for(unsigned int i=0 ; i<dilatation.size() ; ++i)
+    TEST_EQUALITY(cachedDilatation[i], dilatation[i]);
+  TEST_EQUALITY(cachedForce.size(), force.size());
+  for(unsigned int i=0 ; i<force.size() ; ++i){
+    TEST_COMPARE(std::abs(force[i]), >, 0.0);
+    TEST_EQUALITY(cachedForce[i], force[i]);
+  }
+  TEST_EQUALITY(cachedBondField.size(), bondField.size());
+  double maxBondField(0.0);
+  for(unsigned int i=0 ; i<bondField.size() ; ++i){
+    maxBondField = std::max(maxBondField, std::abs(bondField[i]));
+    TEST_EQUALITY(cachedBondField[i], bondField[i]);
+  }
+  // the bond state must have evolved for the comparison to cover it
+  if(!bondField.empty())
+    TEST_COMPARE(maxBondField, >, 0.0);
+}
+
+TEUCHOS_UNIT_TEST(ElasticMaterial, testThreePtsCachedBondGeometry) {
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Horizon", 10.0);
+  compareCachedBondGeometry<ElasticMaterial>(params, "", out, success);
+}
+
+TEUCHOS_UNIT_TEST(ElasticPlasticMaterial, testThreePtsCachedBondGeometry) {
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Horizon", 10.0);
+  params.set("Yield Stress", 1.0e6);
+  compareCachedBondGeometry<ElasticPlasticMaterial>(params, "Deviatoric_Plastic_Extension", out, success);
+}
+
+TEUCHOS_UNIT_TEST(ViscoelasticMaterial, testThreePtsCachedBondGeometry) {
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Horizon", 10.0);
+  params.set("lambda_i", 0.5);
+  params.set("tau b", 0.5);
+  compareCachedBondGeometry<ViscoelasticMaterial>(params, "Deviatoric_Back_Extension", out, success);
+}
+
 //! Tests eight-cell block under compression against hand calculations.
 
 TEUCHOS_UNIT_TEST(ElasticMaterial, testEightPts) {
@@ -841,6 +977,299 @@ TEUCHOS_UNIT_TEST(ElasticMaterial, twoPointTangentStiffnessMatrixJAM) {
 //   jacobian.print(cout);
 }
 
+//! Elastic material that evaluates every neighborhood of the tangent with DFad, used as the reference for the static-storage Fad types.
+class DFadElasticMaterial : public ElasticMaterial {
+public:
+  DFadElasticMaterial(const ParameterList& params) : ElasticMaterial(params) {}
+protected:
+  virtual void evaluateAutomaticDifferentiationJacobianBlock(const int numDof,
+                                                             const double* x,
+                                                             const double* y,
+                                                             const double* cellVolume,
+                                                             const double* weightedVolume,
+                                                             const double* bondDamage,
+                                                             const double* deltaTemperature,
+                                                             const int* tempNeighborhoodList) const {
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::DFad<double> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature, tempNeighborhoodList);
+  }
+};
+
+//! Elastic-plastic material that evaluates every neighborhood of the tangent with DFad.
+class DFadElasticPlasticMaterial : public ElasticPlasticMaterial {
+public:
+  DFadElasticPlasticMaterial(const ParameterList& params) : ElasticPlasticMaterial(params) {}
+protected:
+  virtual void evaluateAutomaticDifferentiationJacobianBlock(const int numDof,
+                                                             const double* x,
+                                                             const double* y,
+                                                             const double* cellVolume,
+                                                             const double* weightedVolume,
+                                                             const double* bondDamage,
+                                                             const double* edpN,
+                                                             const double* lambdaN,
+                                                             const int numBonds,
+                                                             const int* tempNeighborhoodList) const {
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::DFad<double> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, edpN, lambdaN, numBonds, tempNeighborhoodList);
+  }
+};
+
+//! Elastic-plastic hardening material that evaluates every neighborhood of the tangent with DFad.
+class DFadElasticPlasticHardeningMaterial : public ElasticPlasticHardeningMaterial {
+public:
+  DFadElasticPlasticHardeningMaterial(const ParameterList& params) : ElasticPlasticHardeningMaterial(params) {}
+protected:
+  virtual void evaluateAutomaticDifferentiationJacobianBlock(const int numDof,
+                                                             const double* x,
+                                                             const double* y,
+                                                             const double* cellVolume,
+                                                             const double* weightedVolume,
+                                                             const double* bondDamage,
+                                                             const double* ownedShearCorrectionFactor,
+                                                             const double* edpN,
+                                                             const double* lambdaN,
+                                                             const int numBonds,
+                                                             const int* tempNeighborhoodList) const {
+    computeAutomaticDifferentiationJacobianBlock< Sacado::Fad::DFad<double> >(numDof, x, y, cellVolume, weightedVolume, bondDamage, ownedShearCorrectionFactor, edpN, lambdaN, numBonds, tempNeighborhoodList);
+  }
+};
+
+//! Computes the automatic differentiation tangent for a deformed nx by ny by nz lattice in which every point is bonded to every other point; returns the dense tangent.
+template<class MaterialT>
+void computeLatticeTangent(int nx, int ny, int nz, const ParameterList& materialParams, vector<double>& tangent)
+{
+  ParameterList params(materialParams);
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Horizon", 2.0*(nx+ny+nz));
+  MaterialT mat(params);
+
+  int numPoints = nx*ny*nz;
+  int numDof = 3*numPoints;
+  Epetra_SerialComm comm;
+  Epetra_BlockMap scalarPointMap(numPoints, 1, 0, comm);
+  Epetra_BlockMap vectorPointMap(numPoints, 3, 0, comm);
+  vector<int> myGlobalElements(numPoints), elementSizes(numPoints, numPoints-1);
+  for(int i=0 ; i<numPoints ; ++i)
+    myGlobalElements[i] = i;
+  Epetra_BlockMap bondMap(numPoints, numPoints, &myGlobalElements[0], &elementSizes[0], 0, comm);
+  Epetra_Map tangentMap(numDof, 0, comm);
+
+  double dt = 1.0;
+  int numOwnedPoints = numPoints;
+  vector<int> ownedIDs(myGlobalElements);
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numPoints ; ++i){
+    neighborhoodList.push_back(numPoints-1);
+    for(int j=0 ; j<numPoints ; ++j)
+      if(j != i)
+        neighborhoodList.push_back(j);
+  }
+
+  PeridigmNS::DataManager dataManager;
+  dataManager.setMaps(Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&bondMap, false));
+  dataManager.allocateData(mat.FieldIds());
+
+  // allocate a dense global tangent
+  Teuchos::RCP<Epetra_FECrsMatrix> tangentFECrsMatrix = Teuchos::rcp(new Epetra_FECrsMatrix(Copy, tangentMap, 0, false));
+  vector<double> zeros(numDof, 0.0);
+  vector<int> indices(numDof);
+  for(int i=0 ; i<numDof ; ++i)
+    indices[i] = i;
+  for(int i=0 ; i<numDof ; ++i){
+    int err = tangentFECrsMatrix->InsertGlobalValues(i, numDof, &zeros[0], &indices[0]);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err < 0, "**** InsertGlobalValues() returned negative error code.\n");
+  }
+  int err = tangentFECrsMatrix->GlobalAssemble();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** GlobalAssemble() returned nonzero error code.\n");
+  PeridigmNS::SerialMatrix tangentSerialMatrix(tangentFECrsMatrix);
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  Epetra_Vector& x = *dataManager.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE);
+  Epetra_Vector& y = *dataManager.getData(fieldManager.getFieldId("Coordinates"), PeridigmField::STEP_NP1);
+  Epetra_Vector& cellVolume = *dataManager.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE);
+  for(int k=0 ; k<nz ; ++k){
+    for(int j=0 ; j<ny ; ++j){
+      for(int i=0 ; i<nx ; ++i){
+        int id = i + nx*(j + ny*k);
+        x[3*id] = i; x[3*id+1] = j; x[3*id+2] = k;
+        cellVolume[id] = 1.0;
+      }
+    }
+  }
+
+  mat.initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+
+  // stretch the lattice and perturb each point so that the bonds deform nonuniformly
+  for(int i=0 ; i<numDof ; ++i)
+    y[i] = 1.01*x[i] + 0.001*((7*i)%5);
+
+  mat.computeJacobian(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager, tangentSerialMatrix);
+
+  tangent.assign(numDof*numDof, 0.0);
+  vector<double> rowValues(numDof);
+  vector<int> rowIndices(numDof);
+  for(int row=0 ; row<numDof ; ++row){
+    int numEntries;
+    tangentFECrsMatrix->ExtractGlobalRowCopy(row, numDof, numEntries, &rowValues[0], &rowIndices[0]);
+    for(int i=0 ; i<numEntries ; ++i)
+      tangent[row*numDof + rowIndices[i]] = rowValues[i];
+  }
+}
+
+//! Requires the tangent of a fully-bonded lattice to match the DFad tangent.
+template<class MaterialT, class DFadMaterialT>
+void compareLatticeTangentWithDFad(int nx, int ny, int nz,
+                                   const ParameterList& materialParams,
+                                   Teuchos::FancyOStream& out,
+                                   bool& success)
+{
+  vector<double> tangent, dfadTangent;
+  computeLatticeTangent<MaterialT>(nx, ny, nz, materialParams, tangent);
+  computeLatticeTangent<DFadMaterialT>(nx, ny, nz, materialParams, dfadTangent);
+
+  TEST_EQUALITY(tangent.size(), dfadTangent.size());
+  double maxEntry(0.0);
+  for(unsigned int i=0 ; i<dfadTangent.size() ; ++i)
+    maxEntry = std::max(maxEntry, std::abs(dfadTangent[i]));
+  TEST_COMPARE(maxEntry, >, 0.0);
+  double maxDifference(0.0);
+  for(unsigned int i=0 ; i<dfadTangent.size() ; ++i)
+    maxDifference = std::max(maxDifference, std::abs(tangent[i] - dfadTangent[i]));
+  TEST_COMPARE(maxDifference, <=, 1.0e-12*maxEntry);
+}
+
+//! Tests the tangent for neighborhoods of 27 points (81 degrees of freedom), which are evaluated with SLFad<double,128>.
+TEUCHOS_UNIT_TEST(ElasticMaterial, tangentStiffnessMatrixStaticFad) {
+  compareLatticeTangentWithDFad<ElasticMaterial, DFadElasticMaterial>(3, 3, 3, ParameterList(), out, success);
+}
+
+//! Tests the tangent for neighborhoods of 180 points (540 degrees of freedom), which fall back to DFad.
+TEUCHOS_UNIT_TEST(ElasticMaterial, tangentStiffnessMatrixDynamicFad) {
+  compareLatticeTangentWithDFad<ElasticMaterial, DFadElasticMaterial>(6, 6, 5, ParameterList(), out, success);
+}
+
+//! Tests the elastic-plastic tangent with SLFad<double,128>; the yield stress is chosen so that some of the points yield.
+TEUCHOS_UNIT_TEST(ElasticPlasticMaterial, tangentStiffnessMatrixStaticFad) {
+  ParameterList params;
+  params.set("Yield Stress", 1.0e11);
+  compareLatticeTangentWithDFad<ElasticPlasticMaterial, DFadElasticPlasticMaterial>(3, 3, 3, params, out, success);
+}
+
+//! Tests the elastic-plastic tangent for neighborhoods that fall back to DFad; most of the points yield.
+TEUCHOS_UNIT_TEST(ElasticPlasticMaterial, tangentStiffnessMatrixDynamicFad) {
+  ParameterList params;
+  params.set("Yield Stress", 3.0e10);
+  compareLatticeTangentWithDFad<ElasticPlasticMaterial, DFadElasticPlasticMaterial>(6, 6, 5, params, out, success);
+}
+
+//! Tests the elastic-plastic hardening tangent with SLFad<double,128>.
+TEUCHOS_UNIT_TEST(ElasticPlasticHardeningMaterial, tangentStiffnessMatrixStaticFad) {
+  ParameterList params;
+  params.set("Yield Stress", 1.0e11);
+  params.set("Hardening Modulus", 1.0e9);
+  compareLatticeTangentWithDFad<ElasticPlasticHardeningMaterial, DFadElasticPlasticHardeningMaterial>(3, 3, 3, params, out, success);
+}
+
+#ifdef PERIDIGM_OPENMP
+
+//! Evaluates computeInternalForceLinearElastic() for an irregular 5 by 5 by 4 lattice, threaded if threadForceBuffers is not NULL.
+void evaluateLatticeInternalForce(bool cacheBondGeometry,
+                                  PeridigmNS::ThreadForceBuffers<double>* threadForceBuffers,
+                                  vector<double>& force,
+                                  vector<double>& partialStress)
+{
+  const int nx(5), ny(5), nz(4);
+  int numPoints = nx*ny*nz;
+  double horizon = 2.1;
+
+  vector<double> x(3*numPoints), y(3*numPoints), volume(numPoints);
+  for(int k=0 ; k<nz ; ++k){
+    for(int j=0 ; j<ny ; ++j){
+      for(int i=0 ; i<nx ; ++i){
+        int id = i + nx*(j + ny*k);
+        x[3*id] = i; x[3*id+1] = j; x[3*id+2] = k;
+        volume[id] = 1.0 + 0.1*(id%3);
+      }
+    }
+  }
+  for(int i=0 ; i<3*numPoints ; ++i)
+    y[i] = 1.01*x[i] + 0.001*((7*i)%5);
+
+  // the neighborhoods are truncated at the lattice boundary, so the number of bonds varies from point to point
+  vector<int> neighborhoodList;
+  int numBonds = 0;
+  for(int i=0 ; i<numPoints ; ++i){
+    int numNeighborsIndex = neighborhoodList.size();
+    neighborhoodList.push_back(0);
+    for(int j=0 ; j<numPoints ; ++j){
+      double dx = x[3*j] - x[3*i];
+      double dy = x[3*j+1] - x[3*i+1];
+      double dz = x[3*j+2] - x[3*i+2];
+      if(j != i && std::sqrt(dx*dx + dy*dy + dz*dz) < horizon){
+        neighborhoodList.push_back(j);
+        neighborhoodList[numNeighborsIndex] += 1;
+      }
+    }
+    numBonds += neighborhoodList[numNeighborsIndex];
+  }
+  vector<double> bondDamage(numBonds, 0.0);
+  for(int i=0 ; i<numBonds ; i+=7)
+    bondDamage[i] = 0.5;
+
+  vector<double> weightedVolume(numPoints), dilatation(numPoints);
+  vector<double> bondGeometry(MATERIAL_EVALUATION::BOND_GEOMETRY_SIZE*numBonds);
+  double* bondGeometryPtr = cacheBondGeometry ? &bondGeometry[0] : 0;
+  MATERIAL_EVALUATION::computeWeightedVolume(&x[0], &volume[0], &weightedVolume[0], numPoints, &neighborhoodList[0], horizon);
+  MATERIAL_EVALUATION::computeDilatation(&x[0], &y[0], &weightedVolume[0], &volume[0], &bondDamage[0], &dilatation[0], &neighborhoodList[0], numPoints, horizon,
+                                         PeridigmNS::InfluenceFunction::self().getInfluenceFunction(), 0.0, 0, bondGeometryPtr);
+
+  force.assign(3*numPoints, 0.0);
+  partialStress.assign(9*numPoints, 0.0);
+  if(threadForceBuffers != 0)
+    threadForceBuffers->Setup(numPoints, &neighborhoodList[0], 3*numPoints, 4);
+  MATERIAL_EVALUATION::computeInternalForceLinearElastic(&x[0], &y[0], &weightedVolume[0], &volume[0], &dilatation[0], &bondDamage[0], &force[0], &partialStress[0],
+                                                         &neighborhoodList[0], numPoints, 130.0e9, 78.0e9, horizon, 0.0, 0, bondGeometryPtr, threadForceBuffers);
+}
+
+//! Requires the threaded evaluation to match the serial evaluation.
+void compareThreadedInternalForce(bool cacheBondGeometry,
+                                  Teuchos::FancyOStream& out,
+                                  bool& success)
+{
+  vector<double> force, partialStress, threadedForce, threadedPartialStress;
+  PeridigmNS::ThreadForceBuffers<double> threadForceBuffers;
+  evaluateLatticeInternalForce(cacheBondGeometry, 0, force, partialStress);
+  evaluateLatticeInternalForce(cacheBondGeometry, &threadForceBuffers, threadedForce, threadedPartialStress);
+  TEST_EQUALITY(threadForceBuffers.NumThreads(), 4);
+
+  // the reaction forces are summed in a different order, so the forces agree to round-off
+  double maxForce(0.0);
+  for(unsigned int i=0 ; i<force.size() ; ++i)
+    maxForce = std::max(maxForce, std::abs(force[i]));
+  TEST_COMPARE(maxForce, >, 0.0);
+  for(unsigned int i=0 ; i<force.size() ; ++i)
+    TEST_COMPARE(std::abs(threadedForce[i] - force[i]), <=, 1.0e-12*maxForce);
+
+  // each thread writes the partial stress of its own points in the serial order
+  for(unsigned int i=0 ; i<partialStress.size() ; ++i)
+    TEST_EQUALITY(threadedPartialStress[i], partialStress[i]);
+}
+
+TEUCHOS_UNIT_TEST(ElasticMaterial, threadedInternalForce) {
+  compareThreadedInternalForce(false, out, success);
+}
+
+TEUCHOS_UNIT_TEST(ElasticMaterial, threadedInternalForceCachedBondGeometry) {
+  compareThreadedInternalForce(true, out, success);
+}
+
+#endif
+
 int main
 (int argc, char* argv[])
 {
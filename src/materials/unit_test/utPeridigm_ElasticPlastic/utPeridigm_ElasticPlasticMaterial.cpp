@@ -55,9 +55,12 @@
 #include "Array.h"
 #include "material_utilities.h"
 #include "elastic_plastic.h"
+#include "Peridigm_ThreadForceBuffers.hpp"
 #include <math.h>
 
 #include <fstream>
+#include <algorithm>
+#include <cmath>
 
 using namespace std;
 using namespace MATERIAL_EVALUATION;
@@ -454,6 +457,106 @@ TEUCHOS_UNIT_TEST(ElasticPlasticMaterial,RunPureShear) {
 
 }
 
+#ifdef PERIDIGM_OPENMP
+
+//! Evaluates computeInternalForceIsotropicElasticPlastic() for an irregular 5 by 5 by 4 lattice, threaded if threadForceBuffers is not NULL.
+void evaluateLatticeElasticPlasticForce(PeridigmNS::ThreadForceBuffers<double>* threadForceBuffers,
+                                        vector<double>& force,
+                                        vector<double>& edpNP1,
+                                        vector<double>& lambdaNP1)
+{
+  const int nx(5), ny(5), nz(4);
+  int numPoints = nx*ny*nz;
+  double horizon = 2.1;
+
+  vector<double> x(3*numPoints), y(3*numPoints), volume(numPoints);
+  for(int k=0 ; k<nz ; ++k){
+    for(int j=0 ; j<ny ; ++j){
+      for(int i=0 ; i<nx ; ++i){
+        int id = i + nx*(j + ny*k);
+        x[3*id] = i; x[3*id+1] = j; x[3*id+2] = k;
+        volume[id] = 1.0 + 0.1*(id%3);
+      }
+    }
+  }
+  // the shear grows across the lattice, so some points stay elastic and others yield
+  for(int id=0 ; id<numPoints ; ++id){
+    y[3*id] = x[3*id] + 0.002*x[3*id+1]*x[3*id+2];
+    y[3*id+1] = x[3*id+1];
+    y[3*id+2] = x[3*id+2];
+  }
+
+  // the neighborhoods are truncated at the lattice boundary, so the number of bonds varies from point to point
+  vector<int> neighborhoodList;
+  int numBonds = 0;
+  for(int i=0 ; i<numPoints ; ++i){
+    int numNeighborsIndex = neighborhoodList.size();
+    neighborhoodList.push_back(0);
+    for(int j=0 ; j<numPoints ; ++j){
+      double dx = x[3*j] - x[3*i];
+      double dy = x[3*j+1] - x[3*i+1];
+      double dz = x[3*j+2] - x[3*i+2];
+      if(j != i && std::sqrt(dx*dx + dy*dy + dz*dz) < horizon){
+        neighborhoodList.push_back(j);
+        neighborhoodList[numNeighborsIndex] += 1;
+      }
+    }
+    numBonds += neighborhoodList[numNeighborsIndex];
+  }
+  vector<double> bondDamage(numBonds, 0.0), edpN(numBonds, 0.0);
+  for(int i=0 ; i<numBonds ; i+=7)
+    bondDamage[i] = 0.5;
+  for(int i=0 ; i<numBonds ; ++i)
+    edpN[i] = 1.0e-4*((3*i)%5);
+  vector<double> lambdaN(numPoints, 1.0e-3);
+
+  vector<double> weightedVolume(numPoints), dilatation(numPoints);
+  MATERIAL_EVALUATION::computeWeightedVolume(&x[0], &volume[0], &weightedVolume[0], numPoints, &neighborhoodList[0], horizon);
+  MATERIAL_EVALUATION::computeDilatation(&x[0], &y[0], &weightedVolume[0], &volume[0], &bondDamage[0], &dilatation[0], &neighborhoodList[0], numPoints, horizon,
+                                         PeridigmNS::InfluenceFunction::self().getInfluenceFunction());
+
+  force.assign(3*numPoints, 0.0);
+  edpNP1.assign(numBonds, 0.0);
+  lambdaNP1.assign(numPoints, 0.0);
+  if(threadForceBuffers != 0)
+    threadForceBuffers->Setup(numPoints, &neighborhoodList[0], 3*numPoints, 4);
+  MATERIAL_EVALUATION::computeInternalForceIsotropicElasticPlastic<double>(&x[0], &y[0], &weightedVolume[0], &volume[0], &dilatation[0], &bondDamage[0], &edpN[0], &edpNP1[0],
+                                                                           &lambdaN[0], &lambdaNP1[0], &force[0], &neighborhoodList[0], numPoints,
+                                                                           130.0e9, 78.0e9, horizon, 800.0e6, false, 1.0, 0, threadForceBuffers);
+}
+
+TEUCHOS_UNIT_TEST(ElasticPlasticMaterial, ThreadedInternalForce) {
+
+  vector<double> force, edpNP1, lambdaNP1, threadedForce, threadedEdpNP1, threadedLambdaNP1;
+  PeridigmNS::ThreadForceBuffers<double> threadForceBuffers;
+  evaluateLatticeElasticPlasticForce(0, force, edpNP1, lambdaNP1);
+  evaluateLatticeElasticPlasticForce(&threadForceBuffers, threadedForce, threadedEdpNP1, threadedLambdaNP1);
+  TEST_EQUALITY(threadForceBuffers.NumThreads(), 4);
+
+  // the lattice must exercise both the elastic and the plastic branch
+  int numPlasticPoints = 0;
+  for(unsigned int i=0 ; i<lambdaNP1.size() ; ++i)
+    if(lambdaNP1[i] != 1.0e-3)
+      numPlasticPoints++;
+  TEST_COMPARE(numPlasticPoints, >, 0);
+  TEST_COMPARE(numPlasticPoints, <, (int)lambdaNP1.size());
+
+  // the reaction forces are summed in a different order, so the forces agree to round-off
+  double maxForce(0.0);
+  for(unsigned int i=0 ; i<force.size() ; ++i)
+    maxForce = std::max(maxForce, std::abs(force[i]));
+  TEST_COMPARE(maxForce, >, 0.0);
+  for(unsigned int i=0 ; i<force.size() ; ++i)
+    TEST_COMPARE(std::abs(threadedForce[i] - force[i]), <=, 1.0e-12*maxForce);
+
+  // each thread updates the plastic state of its own points and bonds in the serial order
+  for(unsigned int i=0 ; i<edpNP1.size() ; ++i)
+    TEST_EQUALITY(threadedEdpNP1[i], edpNP1[i]);
+  for(unsigned int i=0 ; i<lambdaNP1.size() ; ++i)
+    TEST_EQUALITY(threadedLambdaNP1[i], lambdaNP1[i]);
+}
+
+#endif
 
 int main
 (int argc, char* argv[])
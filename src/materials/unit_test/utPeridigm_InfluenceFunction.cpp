@@ -0,0 +1,147 @@
+/*! \file utPeridigm_InfluenceFunction.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_InfluenceFunction.hpp"
+#include "material_utilities.h"
+#include "linear_lps_pv.h"
+#include <vector>
+#include <cmath>
+#include <iostream>
+
+
+using namespace std;
+using namespace PeridigmNS;
+using namespace Teuchos;
+
+// Wrappers that are not recognized as built-in influence functions, so the kernels are called through the function pointer
+double one(double zeta, double horizon){ return PeridigmInfluenceFunction::one(zeta, horizon); }
+double parabolicDecay(double zeta, double horizon){ return PeridigmInfluenceFunction::parabolicDecay(zeta, horizon); }
+double gaussian(double zeta, double horizon){ return PeridigmInfluenceFunction::gaussian(zeta, horizon); }
+
+//! Evaluates the weighted volume, dilatation, and force for eight points at the corners of a cube, each bonded to every other point.
+void evaluateCube(InfluenceFunction::functionPointer influenceFunction,
+                  vector<double>& weightedVolume,
+                  vector<double>& dilatation,
+                  vector<double>& lpsDilatation,
+                  vector<double>& lpsForce)
+{
+  const int numPoints = 8;
+  const double horizon = 1.8;
+  vector<double> x(3*numPoints), y(3*numPoints), volume(numPoints, 1.0);
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numPoints ; ++i){
+    x[3*i]   = i%2;
+    x[3*i+1] = (i/2)%2;
+    x[3*i+2] = i/4;
+    y[3*i]   = 1.01*x[3*i] + 0.002*i;
+    y[3*i+1] = x[3*i+1] - 0.003*x[3*i+2];
+    y[3*i+2] = 0.98*x[3*i+2] + 0.001*i*i;
+    neighborhoodList.push_back(numPoints-1);
+    for(int j=0 ; j<numPoints ; ++j){
+      if(j != i)
+        neighborhoodList.push_back(j);
+    }
+  }
+  vector<double> bondDamage(numPoints*(numPoints-1), 0.0);
+  bondDamage[3] = 0.5;
+
+  weightedVolume.assign(numPoints, 0.0);
+  dilatation.assign(numPoints, 0.0);
+  lpsDilatation.assign(numPoints, 0.0);
+  lpsForce.assign(3*numPoints, 0.0);
+
+  MATERIAL_EVALUATION::computeWeightedVolume(&x[0], &volume[0], &weightedVolume[0], numPoints, &neighborhoodList[0], horizon, influenceFunction);
+  MATERIAL_EVALUATION::computeDilatation(&x[0], &y[0], &weightedVolume[0], &volume[0], &bondDamage[0], &dilatation[0], &neighborhoodList[0], numPoints, horizon, influenceFunction);
+  MATERIAL_EVALUATION::computeDilatationLinearLPS(&x[0], &y[0], &volume[0], &weightedVolume[0], horizon, influenceFunction, (const double*)0, (const double*)0, (const double*)0, &bondDamage[0], &lpsDilatation[0], &neighborhoodList[0], numPoints);
+  MATERIAL_EVALUATION::computeInternalForceLinearLPS(&x[0], &y[0], &volume[0], &weightedVolume[0], &lpsDilatation[0], horizon, influenceFunction, (const double*)0, (const double*)0, (const double*)0, &bondDamage[0], &lpsForce[0], &neighborhoodList[0], numPoints, 130.0e9, 78.0e9);
+}
+
+//! Requires the specialized and function-pointer paths to agree exactly for the given built-in influence function.
+void compareDispatch(InfluenceFunction::functionPointer builtIn,
+                     InfluenceFunction::functionPointer wrapper,
+                     InfluenceFunction::Type type,
+                     Teuchos::FancyOStream& out,
+                     bool& success)
+{
+  TEST_EQUALITY(InfluenceFunction::getInfluenceFunctionType(builtIn), type);
+  TEST_EQUALITY(InfluenceFunction::getInfluenceFunctionType(wrapper), InfluenceFunction::USER_DEFINED);
+
+  vector<double> weightedVolume, dilatation, lpsDilatation, lpsForce;
+  vector<double> wrapperWeightedVolume, wrapperDilatation, wrapperLpsDilatation, wrapperLpsForce;
+  evaluateCube(builtIn, weightedVolume, dilatation, lpsDilatation, lpsForce);
+  evaluateCube(wrapper, wrapperWeightedVolume, wrapperDilatation, wrapperLpsDilatation, wrapperLpsForce);
+
+  for(unsigned int i=0 ; i<weightedVolume.size() ; ++i){
+    TEST_COMPARE(weightedVolume[i], >, 0.0);
+    TEST_EQUALITY(weightedVolume[i], wrapperWeightedVolume[i]);
+    TEST_COMPARE(std::abs(dilatation[i]), >, 0.0);
+    TEST_EQUALITY(dilatation[i], wrapperDilatation[i]);
+    TEST_EQUALITY(lpsDilatation[i], wrapperLpsDilatation[i]);
+  }
+  for(unsigned int i=0 ; i<lpsForce.size() ; ++i)
+    TEST_EQUALITY(lpsForce[i], wrapperLpsForce[i]);
+}
+
+TEUCHOS_UNIT_TEST(InfluenceFunction, OneDispatch) {
+  compareDispatch(&PeridigmInfluenceFunction::one, &one, InfluenceFunction::ONE, out, success);
+}
+
+TEUCHOS_UNIT_TEST(InfluenceFunction, ParabolicDecayDispatch) {
+  compareDispatch(&PeridigmInfluenceFunction::parabolicDecay, &parabolicDecay, InfluenceFunction::PARABOLIC_DECAY, out, success);
+}
+
+TEUCHOS_UNIT_TEST(InfluenceFunction, GaussianDispatch) {
+  compareDispatch(&PeridigmInfluenceFunction::gaussian, &gaussian, InfluenceFunction::GAUSSIAN, out, success);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,188 @@
+/*! \file utPeridigm_PalsModel.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_Pals_Model.hpp"
+#include "Peridigm_Field.hpp"
+#include <Epetra_SerialComm.h>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace PeridigmNS;
+using namespace Teuchos;
+
+//! Evaluates the Pals model for a sheared 4 by 4 by 3 lattice; returns the dilatation, pressure, and force.
+void evaluateLattice(bool cacheBondInfluence,
+                     vector<double>& dilatation,
+                     vector<double>& pressure,
+                     vector<double>& force)
+{
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Horizon", 2.1);
+  params.set("Dilatation Influence Function", "Parabolic Decay");
+  params.set("Deviatoric Influence Function", "One");
+  params.set("Cache Bond Influence", cacheBondInfluence);
+  Pals_Model mat(params);
+
+  const int nx(4), ny(4), nz(3);
+  int numPoints = nx*ny*nz;
+  double horizon = 2.1;
+
+  vector<double> position(3*numPoints);
+  for(int k=0 ; k<nz ; ++k){
+    for(int j=0 ; j<ny ; ++j){
+      for(int i=0 ; i<nx ; ++i){
+        int id = i + nx*(j + ny*k);
+        position[3*id] = i; position[3*id+1] = j; position[3*id+2] = k;
+      }
+    }
+  }
+
+  // the neighborhoods are truncated at the lattice boundary, so the number of bonds varies from point to point
+  vector<int> neighborhoodList, numNeighbors(numPoints, 0);
+  for(int i=0 ; i<numPoints ; ++i){
+    int numNeighborsIndex = neighborhoodList.size();
+    neighborhoodList.push_back(0);
+    for(int j=0 ; j<numPoints ; ++j){
+      double dx = position[3*j] - position[3*i];
+      double dy = position[3*j+1] - position[3*i+1];
+      double dz = position[3*j+2] - position[3*i+2];
+      if(j != i && std::sqrt(dx*dx + dy*dy + dz*dz) < horizon){
+        neighborhoodList.push_back(j);
+        numNeighbors[i] += 1;
+      }
+    }
+    neighborhoodList[numNeighborsIndex] = numNeighbors[i];
+  }
+
+  Epetra_SerialComm comm;
+  Epetra_BlockMap scalarPointMap(numPoints, 1, 0, comm);
+  Epetra_BlockMap vectorPointMap(numPoints, 3, 0, comm);
+  vector<int> myGlobalElements(numPoints);
+  for(int i=0 ; i<numPoints ; ++i)
+    myGlobalElements[i] = i;
+  Epetra_BlockMap bondMap(numPoints, numPoints, &myGlobalElements[0], &numNeighbors[0], 0, comm);
+
+  double dt = 1.0;
+  int numOwnedPoints = numPoints;
+  vector<int> ownedIDs(myGlobalElements);
+
+  PeridigmNS::DataManager dataManager;
+  dataManager.setMaps(Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&bondMap, false));
+  dataManager.allocateData(mat.FieldIds());
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  Epetra_Vector& x = *dataManager.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE);
+  Epetra_Vector& y = *dataManager.getData(fieldManager.getFieldId("Coordinates"), PeridigmField::STEP_NP1);
+  Epetra_Vector& cellVolume = *dataManager.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE);
+  for(int i=0 ; i<numPoints ; ++i){
+    x[3*i] = position[3*i]; x[3*i+1] = position[3*i+1]; x[3*i+2] = position[3*i+2];
+    cellVolume[i] = 1.0 + 0.1*(i%3);
+  }
+
+  mat.initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+
+  // simple shear plus a stretch and a perturbation of each point
+  for(int i=0 ; i<numPoints ; ++i){
+    y[3*i]   = 1.01*x[3*i] + 0.02*x[3*i+1] + 0.001*((7*i)%5);
+    y[3*i+1] = x[3*i+1] + 0.001*((3*i)%4);
+    y[3*i+2] = 0.99*x[3*i+2];
+  }
+
+  mat.computeForce(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+
+  Epetra_Vector& dilatationNP1 = *dataManager.getData(fieldManager.getFieldId("Dilatation"), PeridigmField::STEP_NP1);
+  dilatation.assign(&dilatationNP1[0], &dilatationNP1[0] + dilatationNP1.MyLength());
+  Epetra_Vector& pressureNP1 = *dataManager.getData(fieldManager.getFieldId("Pals_Pressure"), PeridigmField::STEP_NP1);
+  pressure.assign(&pressureNP1[0], &pressureNP1[0] + pressureNP1.MyLength());
+  Epetra_Vector& forceNP1 = *dataManager.getData(fieldManager.getFieldId("Force_Density"), PeridigmField::STEP_NP1);
+  force.assign(&forceNP1[0], &forceNP1[0] + forceNP1.MyLength());
+}
+
+//! Tests that caching the bond influence functions gives the same results, to round-off, as evaluating them at every step.
+TEUCHOS_UNIT_TEST(Pals_Model, CacheBondInfluence) {
+  vector<double> dilatation, pressure, force;
+  vector<double> cachedDilatation, cachedPressure, cachedForce;
+  evaluateLattice(false, dilatation, pressure, force);
+  evaluateLattice(true, cachedDilatation, cachedPressure, cachedForce);
+
+  TEST_EQUALITY(cachedDilatation.size(), dilatation.size());
+  double maxDilatation(0.0);
+  for(unsigned int i=0 ; i<dilatation.size() ; ++i){
+    maxDilatation = std::max(maxDilatation, std::abs(dilatation[i]));
+    TEST_FLOATING_EQUALITY(cachedDilatation[i], dilatation[i], 1.0e-14);
+  }
+  TEST_COMPARE(maxDilatation, >, 0.0);
+  TEST_EQUALITY(cachedPressure.size(), pressure.size());
+  for(unsigned int i=0 ; i<pressure.size() ; ++i)
+    TEST_FLOATING_EQUALITY(cachedPressure[i], pressure[i], 1.0e-14);
+  TEST_EQUALITY(cachedForce.size(), force.size());
+  double maxForce(0.0);
+  for(unsigned int i=0 ; i<force.size() ; ++i){
+    maxForce = std::max(maxForce, std::abs(force[i]));
+    TEST_FLOATING_EQUALITY(cachedForce[i], force[i], 1.0e-14);
+  }
+  TEST_COMPARE(maxForce, >, 0.0);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
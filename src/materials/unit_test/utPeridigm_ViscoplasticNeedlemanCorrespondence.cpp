@@ -0,0 +1,170 @@
+/*! \file utPeridigm_ViscoplasticNeedlemanCorrespondence.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "viscoplastic_needleman_correspondence.h"
+#include <cmath>
+#include <iostream>
+
+
+using namespace std;
+using namespace Teuchos;
+
+// Material parameters from the ViscoplasticNeedlemanFullyPrescribedTension verification tests
+const double yieldStress = 460.0e6;
+const double shearMod = 105.5e9;
+const double strainHardExp = 0.1;
+const double rateHardExp = 0.01;
+const double refStrainRate = 0.001;
+const double refStrain0 = 0.00218;
+const double refStrain1 = 0.436;
+const double dt = 1.0e-8;
+
+//! The bisection loop that ViscoplasticNeedlemanSolveDeltaLambda() replaced, with a configurable relative tolerance.
+double bisectionDeltaLambda(double eqpsN,
+                            double scalarDeviatoricStrainInc,
+                            double deviatoricStressMagnitudeN,
+                            double tolerance)
+{
+  double a = 0.0;
+  double b = 1.0;
+  double c = (a+b)/2.0;
+  double deltaLambda = 1.0;
+  double deltaLambdaOld;
+
+  for(int iter = 0; iter < 100000; iter++){
+
+    double yfb = CORRESPONDENCE::ViscoplasticNeedlemanYieldFunction(b, eqpsN + b, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+    double yfc = CORRESPONDENCE::ViscoplasticNeedlemanYieldFunction(c, eqpsN + c, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+
+    double fb = scalarDeviatoricStrainInc - b - 1.0 / 2.0 / shearMod * (sqrt(2.0/3.0) * yfb - deviatoricStressMagnitudeN);
+    double fc = scalarDeviatoricStrainInc - c - 1.0 / 2.0 / shearMod * (sqrt(2.0/3.0) * yfc - deviatoricStressMagnitudeN);
+
+    if((fb > 0.0 && fc > 0.0) || (fb < 0.0 && fc < 0.0))
+      b = c;
+    else
+      a = c;
+
+    deltaLambdaOld = c;
+    c = (a+b)/2.0;
+    deltaLambda = c;
+
+    if(fabs(deltaLambda - deltaLambdaOld)/fabs(deltaLambda) < tolerance)
+      break;
+  }
+
+  return deltaLambda;
+}
+
+TEUCHOS_UNIT_TEST(ViscoplasticNeedlemanCorrespondence, YieldFunctionAndDerivatives) {
+
+  const double deltaLambdaValues[3] = {1.0e-11, 1.0e-6, 1.0e-3};
+  const double eqpsValues[3] = {0.0, 2.0e-3, 0.5};
+
+  for(int i=0 ; i<3 ; ++i){
+    for(int j=0 ; j<3 ; ++j){
+
+      double deltaLambda = deltaLambdaValues[i];
+      double eqps = eqpsValues[j];
+      double dYield_dDeltaLambda, dYield_dEqps;
+
+      double yield = CORRESPONDENCE::ViscoplasticNeedlemanYieldFunctionAndDerivatives(deltaLambda, eqps, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt, dYield_dDeltaLambda, dYield_dEqps);
+
+      // the value is the one the derivative-free function returns
+      TEST_EQUALITY(yield, CORRESPONDENCE::ViscoplasticNeedlemanYieldFunction(deltaLambda, eqps, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt));
+
+      // central differences
+      double h = 1.0e-6*deltaLambda;
+      double yieldPlus = CORRESPONDENCE::ViscoplasticNeedlemanYieldFunction(deltaLambda + h, eqps, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+      double yieldMinus = CORRESPONDENCE::ViscoplasticNeedlemanYieldFunction(deltaLambda - h, eqps, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+      TEST_FLOATING_EQUALITY(dYield_dDeltaLambda, (yieldPlus - yieldMinus)/(2.0*h), 1.0e-6);
+
+      h = 1.0e-6*(eqps + refStrain0);
+      yieldPlus = CORRESPONDENCE::ViscoplasticNeedlemanYieldFunction(deltaLambda, eqps + h, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+      yieldMinus = CORRESPONDENCE::ViscoplasticNeedlemanYieldFunction(deltaLambda, eqps - h, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+      TEST_FLOATING_EQUALITY(dYield_dEqps, (yieldPlus - yieldMinus)/(2.0*h), 1.0e-6);
+    }
+  }
+}
+
+TEUCHOS_UNIT_TEST(ViscoplasticNeedlemanCorrespondence, SolveDeltaLambda) {
+
+  // A plastic point at the current flow stress
+  const double eqpsN = 1.0e-3;
+  const double scalarDeviatoricStrainInc = 2.0e-5;
+  const double deviatoricStressMagnitudeN = sqrt(2.0/3.0) * yieldStress * pow(1.0 + eqpsN/refStrain0, strainHardExp) / (1.0 + pow(eqpsN/refStrain1, 2.0));
+
+  // the old bisection result agrees with the root to its 1e-6 relative tolerance
+  double bisection = bisectionDeltaLambda(eqpsN, scalarDeviatoricStrainInc, deviatoricStressMagnitudeN, 1.0e-6);
+  double root = bisectionDeltaLambda(eqpsN, scalarDeviatoricStrainInc, deviatoricStressMagnitudeN, 1.0e-14);
+  TEST_FLOATING_EQUALITY(bisection, root, 1.0e-6);
+
+  // cold start; the first Newton steps leave the bracket and fall back to bisection
+  int coldIterations;
+  double deltaLambda = CORRESPONDENCE::ViscoplasticNeedlemanSolveDeltaLambda(eqpsN, scalarDeviatoricStrainInc, deviatoricStressMagnitudeN, 0.0, yieldStress, shearMod, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt, coldIterations);
+  TEST_FLOATING_EQUALITY(deltaLambda, root, 1.0e-12);
+  TEST_FLOATING_EQUALITY(deltaLambda, bisection, 1.0e-6);
+
+  // warm start near the root, as from the previous step
+  int warmIterations;
+  deltaLambda = CORRESPONDENCE::ViscoplasticNeedlemanSolveDeltaLambda(eqpsN, scalarDeviatoricStrainInc, deviatoricStressMagnitudeN, 1.01*bisection, yieldStress, shearMod, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt, warmIterations);
+  TEST_FLOATING_EQUALITY(deltaLambda, root, 1.0e-12);
+  TEST_COMPARE(warmIterations, <, coldIterations);
+
+  // warm start well above the root; the residual is convex, so the first Newton step overshoots below zero and falls back to bisection
+  int overshootIterations;
+  deltaLambda = CORRESPONDENCE::ViscoplasticNeedlemanSolveDeltaLambda(eqpsN, scalarDeviatoricStrainInc, deviatoricStressMagnitudeN, 3.0*bisection, yieldStress, shearMod, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt, overshootIterations);
+  TEST_FLOATING_EQUALITY(deltaLambda, root, 1.0e-12);
+  TEST_COMPARE(overshootIterations, <, coldIterations);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
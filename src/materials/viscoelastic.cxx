@@ -48,6 +48,7 @@
 #include <cmath>
 #include <iostream>
 #include "viscoelastic.h"
+#include "material_utilities.h"
 using std::cout;
 using std::endl;
 namespace MATERIAL_EVALUATION {
@@ -71,7 +72,8 @@ void computeInternalForceViscoelasticStandardLinearSolid
    double BULK_MODULUS,
    double SHEAR_MODULUS,
    double m_lambda_i,
-   double m_tau_b_i
+   double m_tau_b_i,
+   const double* bondGeometry
 )
 {
 
@@ -115,10 +117,15 @@ void computeInternalForceViscoelasticStandardLinearSolid
 			const double *XP    = &xOverlap[3*localId];
 			const double *YPN   = &yNOverlap[3*localId];
 			const double *YPNP1 = &yNP1Overlap[3*localId];
-			dx = XP[0]-X[0];
-			dy = XP[1]-X[1];
-			dz = XP[2]-X[2];
-			zeta = sqrt(dx*dx+dy*dy+dz*dz);
+			if(bondGeometry){
+				zeta = bondGeometry[0];
+			}
+			else{
+				dx = XP[0]-X[0];
+				dy = XP[1]-X[1];
+				dz = XP[2]-X[2];
+				zeta = sqrt(dx*dx+dy*dy+dz*dz);
+			}
 
 			/*
 			 * JAM:damage state
@@ -156,10 +163,19 @@ void computeInternalForceViscoelasticStandardLinearSolid
 			/*
 			 * COMPUTE edNp1
 			 */
-			dx = YPNP1[0]-YNP1[0];
-			dy = YPNP1[1]-YNP1[1];
-			dz = YPNP1[2]-YNP1[2];
-			dYNp1 = sqrt(dx*dx+dy*dy+dz*dz);
+			if(bondGeometry){
+				dx = bondGeometry[1];
+				dy = bondGeometry[2];
+				dz = bondGeometry[3];
+				dYNp1 = bondGeometry[4];
+				bondGeometry += BOND_GEOMETRY_SIZE;
+			}
+			else{
+				dx = YPNP1[0]-YNP1[0];
+				dy = YPNP1[1]-YNP1[1];
+				dz = YPNP1[2]-YNP1[2];
+				dYNp1 = sqrt(dx*dx+dy*dy+dz*dz);
+			}
 			edNp1 = damageNp1 * (dYNp1 - zeta) - eiNp1;
 
 			/*
@@ -56,6 +56,7 @@ namespace MATERIAL_EVALUATION {
  * Output:
  *   * force
  *   * edbNP1 -- deviatoric back strain at end of step
+ * If bondGeometry is not NULL, the step N+1 bond geometry cached by computeDilatation() is used.
  */
 void computeInternalForceViscoelasticStandardLinearSolid
   (double delta_t,
@@ -75,7 +76,8 @@ void computeInternalForceViscoelasticStandardLinearSolid
    double m_bulkModulus,
    double m_shearModulus,
    double m_lambda_i,
-   double m_tau_b_i
+   double m_tau_b_i,
+   const double* bondGeometry = 0
    );
 
 }
@@ -50,6 +50,7 @@
 #include "material_utilities.h"
 #include <Sacado.hpp>
 #include <math.h>
+#include <iostream>
 
 namespace CORRESPONDENCE {
 
@@ -63,6 +64,9 @@ ScalarT* cauchyStressNP1,
 ScalarT* vonMisesStress,
 const ScalarT* equivalentPlasticStrainN,
 ScalarT* equivalentPlasticStrainNP1,
+const ScalarT* plasticMultiplierIncrementN,
+ScalarT* plasticMultiplierIncrementNP1,
+double* returnMapIterations,
 const int numPoints, 
 const double bulkMod,
 const double shearMod,
@@ -91,6 +95,11 @@ const double dt
   const ScalarT* eqpsN = equivalentPlasticStrainN;
   ScalarT* eqpsNP1 = equivalentPlasticStrainNP1;
 
+  const ScalarT* deltaLambdaN = plasticMultiplierIncrementN;
+  ScalarT* deltaLambdaNP1 = plasticMultiplierIncrementNP1;
+  double* iterations = returnMapIterations;
+  int numIterations;
+
   ScalarT strainInc[9];
   ScalarT deviatoricStrainInc[9];
   ScalarT deviatoricStressN[9];
@@ -111,14 +120,6 @@ const double dt
   ScalarT yieldFunctionVal;
 
   ScalarT deltaLambda;
-  ScalarT deltaLambdaOld = 0.0;
-  ScalarT a;
-  ScalarT b;
-  ScalarT c;
-  ScalarT fb;
-  ScalarT fc;
-  ScalarT yfb;
-  ScalarT yfc;
 
   double reducedYieldStress;
   const double* modelCoord = modelCoordinates;
@@ -126,7 +127,10 @@ const double dt
 
   for(int iID=0 ; iID<numPoints ; ++iID, modelCoord+=3, 
         rateOfDef+=9, stressN+=9, stressNP1+=9,
-        ++vmStress,++eqpsN,++eqpsNP1){
+        ++vmStress,++eqpsN,++eqpsNP1,++deltaLambdaN,++deltaLambdaNP1){
+
+      numIterations = 0;
+      *deltaLambdaNP1 = 0.0;
 
       //strainInc = dt * rateOfDef
       for (int i = 0; i < 9; i++) {
@@ -231,50 +235,22 @@ const double dt
 
           deviatoricStressMagnitudeN = sqrt(tempScalar);
 
-          //Verbose bi-section method to solve for deltaLambda
-          //TODO: Implement a ``smarter'' faster root solve here, i.e. Brent's
-          //method
-          deltaLambda = 1.0;
-          deltaLambdaOld = 0.0;
-          a = 0.0;
-          b = 1.0;
-          c = (a+b)/2.0;
-
-          //Bisection loop
-          for(int iter = 0; iter < 100000; iter++){
-
-              *eqpsNP1 = *eqpsN + b;
-              yfb = ViscoplasticNeedlemanYieldFunction(b, *eqpsNP1, reducedYieldStress, strainHardExp, rateHardExp, refStrainRate,refStrain0, refStrain1, dt);
-              *eqpsNP1 = *eqpsN + c;
-              yfc = ViscoplasticNeedlemanYieldFunction(c, *eqpsNP1, reducedYieldStress, strainHardExp, rateHardExp, refStrainRate,refStrain0, refStrain1, dt);
-       
-              fb = scalarDeviatoricStrainInc - b - 1.0 / 2.0 / shearMod * (sqrt(2.0/3.0) * yfb - deviatoricStressMagnitudeN);
-              fc = scalarDeviatoricStrainInc - c - 1.0 / 2.0 / shearMod * (sqrt(2.0/3.0) * yfc - deviatoricStressMagnitudeN);
-              
-              if(fb > 0.0 && fc > 0.0) {
-                  b = c;
-              } 
-              else if(fb < 0.0 && fc < 0.0){
-                  b = c;
-              }
-              else{
-                  a = c;
-              }
-
-              deltaLambdaOld = c;
-              c = (a+b)/2.0;
-              deltaLambda = c;
-
-              if(fabs(deltaLambda - deltaLambdaOld)/fabs(deltaLambda) < 1.0e-6){
-                  //We're converged, stop
-                  break;
-              }
-              else if (iter == 99999){
-                  //Error message here!
-                  std::cout << "Bisection method failed to converge in 1e6 iterations" << std::endl;
-                  break;
-              }
-          }
+          // Solve for deltaLambda, starting from the value found at this
+          // point in the previous step
+          deltaLambda = ViscoplasticNeedlemanSolveDeltaLambda(*eqpsN,
+                                                              scalarDeviatoricStrainInc,
+                                                              deviatoricStressMagnitudeN,
+                                                              *deltaLambdaN,
+                                                              reducedYieldStress,
+                                                              shearMod,
+                                                              strainHardExp,
+                                                              rateHardExp,
+                                                              refStrainRate,
+                                                              refStrain0,
+                                                              refStrain1,
+                                                              dt,
+                                                              numIterations);
+          *deltaLambdaNP1 = deltaLambda;
 
           //Increment the plastic strain for the purposes of evaluating the
           //yield surface
@@ -381,6 +357,9 @@ const double dt
               *eqpsNP1 = *eqpsN;
           }
       }
+
+      if(iterations != 0)
+        iterations[iID] = numIterations;
   }
 }
 
@@ -405,6 +384,131 @@ ScalarT ViscoplasticNeedlemanYieldFunction
   return (hardTerm * rateTerm);
 }
 
+// Needleman yield function and its partial derivatives with respect to
+// deltaLambda and eqps
+template <typename ScalarT>
+ScalarT ViscoplasticNeedlemanYieldFunctionAndDerivatives
+(
+ const ScalarT deltaLambda,
+ const ScalarT eqps,
+ const double yieldStress,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ ScalarT& dYieldFunction_dDeltaLambda,
+ ScalarT& dYieldFunction_dEqps
+)
+{
+  ScalarT hardTerm = yieldStress * pow(1.0 + eqps/refStrain0, strainHardExp) / (1.0 + pow(eqps/refStrain1,2.0));
+  ScalarT rateTerm = pow(sqrt(2.0/3.0) * deltaLambda / dt / refStrainRate, rateHardExp);
+
+  // d(hardTerm)/d(eqps) = hardTerm * ( n/(eps0 + eqps) - 2 eqps/(eps1^2 + eqps^2) )
+  dYieldFunction_dEqps = hardTerm * rateTerm * ( strainHardExp/(refStrain0 + eqps) - 2.0*eqps/(refStrain1*refStrain1 + eqps*eqps) );
+
+  // d(rateTerm)/d(deltaLambda) = m * rateTerm / deltaLambda
+  dYieldFunction_dDeltaLambda = hardTerm * rateHardExp * rateTerm / deltaLambda;
+
+  return (hardTerm * rateTerm);
+}
+
+// Solves the consistency condition for deltaLambda on the interval [0,1]
+// using Newton's method safeguarded by bisection.  The residual is
+//
+//   R(deltaLambda) = de - deltaLambda - ( sqrt(2/3) Y(deltaLambda, eqpsN + deltaLambda) - |S_N| ) / (2 mu)
+//
+// The interval is narrowed on every evaluation, exactly as the bisection
+// method would, and any Newton step that leaves the interval is replaced by
+// a bisection step.
+template <typename ScalarT>
+ScalarT ViscoplasticNeedlemanSolveDeltaLambda
+(
+ const ScalarT eqpsN,
+ const ScalarT scalarDeviatoricStrainInc,
+ const ScalarT deviatoricStressMagnitudeN,
+ const ScalarT initialGuess,
+ const double yieldStress,
+ const double shearMod,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ int& numIterations
+)
+{
+  const int maxIterations = 200;
+
+  ScalarT yieldFunction, dYield_dDeltaLambda, dYield_dEqps;
+  ScalarT residual, residualDerivative;
+
+  // The yield function is non-negative, so the root cannot lie above
+  // de + |S_N|/(2 mu); use that bound to tighten the initial interval
+  ScalarT a = 0.0;
+  ScalarT b = 1.0;
+  ScalarT upperBound = scalarDeviatoricStrainInc + 1.0 / 2.0 / shearMod * deviatoricStressMagnitudeN;
+  if(upperBound > a && upperBound < b)
+    b = upperBound;
+
+  // Residual at the upper end of the interval
+  yieldFunction = ViscoplasticNeedlemanYieldFunction(b, eqpsN + b, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+  ScalarT fb = scalarDeviatoricStrainInc - b - 1.0 / 2.0 / shearMod * (sqrt(2.0/3.0) * yieldFunction - deviatoricStressMagnitudeN);
+  numIterations = 1;
+
+  // Warm start, falling back to the midpoint of the interval
+  ScalarT deltaLambda = initialGuess;
+  if(!(deltaLambda > a && deltaLambda < b))
+    deltaLambda = (a+b)/2.0;
+
+  ScalarT deltaLambdaOld;
+  bool converged = false;
+
+  while(!converged && numIterations < maxIterations){
+
+    numIterations++;
+
+    yieldFunction = ViscoplasticNeedlemanYieldFunctionAndDerivatives(deltaLambda, eqpsN + deltaLambda, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt, dYield_dDeltaLambda, dYield_dEqps);
+
+    residual = scalarDeviatoricStrainInc - deltaLambda - 1.0 / 2.0 / shearMod * (sqrt(2.0/3.0) * yieldFunction - deviatoricStressMagnitudeN);
+    residualDerivative = -1.0 - 1.0 / 2.0 / shearMod * sqrt(2.0/3.0) * (dYield_dDeltaLambda + dYield_dEqps);
+
+    if(residual == 0.0){
+      converged = true;
+      break;
+    }
+
+    // Keep the root bracketed
+    if((fb > 0.0 && residual > 0.0) || (fb < 0.0 && residual < 0.0)){
+      b = deltaLambda;
+      fb = residual;
+    }
+    else{
+      a = deltaLambda;
+    }
+
+    deltaLambdaOld = deltaLambda;
+
+    // Newton step, or bisection if the step leaves the interval
+    if(residualDerivative != 0.0)
+      deltaLambda = deltaLambdaOld - residual / residualDerivative;
+    if(residualDerivative == 0.0 || !(deltaLambda > a && deltaLambda < b))
+      deltaLambda = (a+b)/2.0;
+
+    if(fabs(deltaLambda - deltaLambdaOld)/fabs(deltaLambda) < 1.0e-6)
+      converged = true;
+  }
+
+  if(!converged){
+    //Error message here!
+    std::cout << "ViscoplasticNeedlemanSolveDeltaLambda() failed to converge in " << maxIterations << " iterations" << std::endl;
+  }
+
+  return deltaLambda;
+}
+
 
 template <typename ScalarT>
 ScalarT ViscoplasticNeedlemanFindRoot
@@ -587,6 +691,9 @@ double* cauchyStressNP1,
 double* vonMisesStress,
 const double* equivalentPlasticStrainN,
 double* equivalentPlasticStrainNP1,
+const double* plasticMultiplierIncrementN,
+double* plasticMultiplierIncrementNP1,
+double* returnMapIterations,
 const int numPoints, 
 const double bulkMod,
 const double shearMod,
@@ -605,6 +712,38 @@ const double m_flawMagnitude,
 const double dt
 );
 
+template double ViscoplasticNeedlemanYieldFunctionAndDerivatives<double>
+(
+ const double deltaLambda,
+ const double eqps,
+ const double yieldStress,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ double& dYieldFunction_dDeltaLambda,
+ double& dYieldFunction_dEqps
+);
+
+template double ViscoplasticNeedlemanSolveDeltaLambda<double>
+(
+ const double eqpsN,
+ const double scalarDeviatoricStrainInc,
+ const double deviatoricStressMagnitudeN,
+ const double initialGuess,
+ const double yieldStress,
+ const double shearMod,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ int& numIterations
+);
+
 template double ViscoplasticNeedlemanYieldFunction<double>
 (
  const double deltaLambda,
@@ -649,6 +788,38 @@ template Sacado::Fad::DFad<double> ViscoplasticNeedlemanFindRoot<Sacado::Fad::DF
  const double dt
 );
 
+template Sacado::Fad::DFad<double> ViscoplasticNeedlemanYieldFunctionAndDerivatives<Sacado::Fad::DFad<double> >
+(
+ const Sacado::Fad::DFad<double> deltaLambda,
+ const Sacado::Fad::DFad<double> eqps,
+ const double yieldStress,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ Sacado::Fad::DFad<double>& dYieldFunction_dDeltaLambda,
+ Sacado::Fad::DFad<double>& dYieldFunction_dEqps
+);
+
+template Sacado::Fad::DFad<double> ViscoplasticNeedlemanSolveDeltaLambda<Sacado::Fad::DFad<double> >
+(
+ const Sacado::Fad::DFad<double> eqpsN,
+ const Sacado::Fad::DFad<double> scalarDeviatoricStrainInc,
+ const Sacado::Fad::DFad<double> deviatoricStressMagnitudeN,
+ const Sacado::Fad::DFad<double> initialGuess,
+ const double yieldStress,
+ const double shearMod,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ int& numIterations
+);
+
 template Sacado::Fad::DFad<double> ViscoplasticNeedlemanYieldFunction<Sacado::Fad::DFad<double> >
 (
  const Sacado::Fad::DFad<double> deltaLambda,
@@ -671,6 +842,9 @@ Sacado::Fad::DFad<double>* cauchyStressNP1,
 Sacado::Fad::DFad<double>* vonMisesStress,
 const Sacado::Fad::DFad<double>* equivalentPlasticStrainN,
 Sacado::Fad::DFad<double>* equivalentPlasticStrainNP1,
+const Sacado::Fad::DFad<double>* plasticMultiplierIncrementN,
+Sacado::Fad::DFad<double>* plasticMultiplierIncrementNP1,
+double* returnMapIterations,
 const int numPoints, 
 const double bulkMod,
 const double shearMod,
@@ -59,6 +59,9 @@ ScalarT* cauchyStressNP1,
 ScalarT* vonMisesStress,
 const ScalarT* equivalentPlasticStrainN,
 ScalarT* equivalentPlasticStrainNP1,
+const ScalarT* plasticMultiplierIncrementN,
+ScalarT* plasticMultiplierIncrementNP1,
+double* returnMapIterations,
 const int numPoints, 
 const double bulkMod,
 const double shearMod,
@@ -107,6 +110,40 @@ ScalarT ViscoplasticNeedlemanYieldFunction
  const double dt
 );
 
+template <typename ScalarT>
+ScalarT ViscoplasticNeedlemanYieldFunctionAndDerivatives
+(
+ const ScalarT deltaLambda,
+ const ScalarT eqps,
+ const double yieldStress,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ ScalarT& dYieldFunction_dDeltaLambda,
+ ScalarT& dYieldFunction_dEqps
+);
+
+template <typename ScalarT>
+ScalarT ViscoplasticNeedlemanSolveDeltaLambda
+(
+ const ScalarT eqpsN,
+ const ScalarT scalarDeviatoricStrainInc,
+ const ScalarT deviatoricStressMagnitudeN,
+ const ScalarT initialGuess,
+ const double yieldStress,
+ const double shearMod,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ int& numIterations
+);
+
 }
 
 #endif // VISCO_PLASTIC_NEEDLEMAN_CORRESPONDENCE_H